@@ -12,6 +12,7 @@
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/common/common.hpp"
@@ -101,6 +102,9 @@ public:
 
 	idx_t NumRows();
 	idx_t NumRowGroups();
+	//! Returns the order in which the row groups are scanned. If there is a dynamic filter the row groups whose
+	//! statistics are most likely to tighten it are scanned first, otherwise they are scanned in file order.
+	const vector<idx_t> &GetRowGroupScanOrder();
 
 	const duckdb_parquet::format::FileMetaData *GetFileMetadata();
 
@@ -144,6 +148,8 @@ private:
 
 private:
 	unique_ptr<FileHandle> file_handle;
+	//! The order in which the row groups are scanned (lazily initialized)
+	vector<idx_t> row_group_scan_order;
 };
 
 } // namespace duckdb
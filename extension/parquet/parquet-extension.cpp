@@ -158,6 +158,11 @@ BindInfo ParquetGetBatchInfo(const FunctionData *bind_data) {
 	return bind_info;
 }
 
+vector<string> ParquetGetFiles(const FunctionData *bind_data) {
+	auto &parquet_bind = bind_data->Cast<ParquetReadBindData>();
+	return parquet_bind.files;
+}
+
 class ParquetScanFunction {
 public:
 	static TableFunctionSet GetFunctionSet() {
@@ -174,10 +179,12 @@ public:
 		table_function.serialize = ParquetScanSerialize;
 		table_function.deserialize = ParquetScanDeserialize;
 		table_function.get_batch_info = ParquetGetBatchInfo;
+		table_function.get_files = ParquetGetFiles;
 
 		table_function.projection_pushdown = true;
 //		table_function.filter_pushdown = true;
 //		table_function.filter_prune = true;
+		table_function.dynamic_filter_pushdown = true;
 		table_function.pushdown_complex_filter = ParquetComplexFilterPushdown;
 		return MultiFileReader::CreateFunctionSet(table_function);
 	}
@@ -362,9 +369,20 @@ public:
 		auto &bind_data = (ParquetReadBindData &)*input.bind_data;
 		auto result = make_uniq<ParquetReadGlobalState>();
 
-        int max_threads = std::stoi(ConfigFactory::Instance().getProperty("parquet.threads"));
-        if (max_threads <= 0) {
+        int max_threads;
+        if (ClientConfig::GetConfig(context).adaptive_parallelism) {
+            // the pipeline launches tasks based on the observed throughput: parquet.threads only bounds the
+            // parallelism if it is set, otherwise every file can be scanned in parallel
             max_threads = ParquetScanMaxThreads(context, input.bind_data.get());
+            int configured_threads = std::stoi(ConfigFactory::Instance().getProperty("parquet.threads"));
+            if (configured_threads > 0 && configured_threads < max_threads) {
+                max_threads = configured_threads;
+            }
+        } else {
+            max_threads = std::stoi(ConfigFactory::Instance().getProperty("parquet.threads"));
+            if (max_threads <= 0) {
+                max_threads = ParquetScanMaxThreads(context, input.bind_data.get());
+            }
         }
         //	result->max_threads = ParquetScanMaxThreads(context, input.bind_data.get());
         result->max_threads = max_threads;
@@ -517,7 +535,8 @@ public:
 				    parallel_state.readers[device_id][parallel_state.file_index[device_id]]->NumRowGroups()) {
 					// The current reader has rowgroups left to be scanned
 					scan_data.reader = parallel_state.readers[device_id][parallel_state.file_index[device_id]];
-					vector<idx_t> group_indexes {parallel_state.row_group_index[device_id]};
+					auto &scan_order = scan_data.reader->GetRowGroupScanOrder();
+					vector<idx_t> group_indexes {scan_order[parallel_state.row_group_index[device_id]]};
 					scan_data.reader->InitializeScan(scan_data.scan_state, group_indexes);
 					scan_data.batch_index = parallel_state.batch_index++;
 					scan_data.file_index = parallel_state.file_index[device_id];
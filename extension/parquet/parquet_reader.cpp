@@ -618,6 +618,51 @@ idx_t ParquetReader::NumRowGroups() {
 	return GetFileMetadata()->row_groups.size();
 }
 
+const vector<idx_t> &ParquetReader::GetRowGroupScanOrder() {
+	auto row_group_count = NumRowGroups();
+	if (row_group_scan_order.size() == row_group_count) {
+		return row_group_scan_order;
+	}
+	row_group_scan_order.clear();
+	for (idx_t row_group_idx = 0; row_group_idx < row_group_count; row_group_idx++) {
+		row_group_scan_order.push_back(row_group_idx);
+	}
+	if (!reader_data.filters) {
+		return row_group_scan_order;
+	}
+	for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+		// filters contain output chunk index, not file col idx!
+		auto filter_entry = reader_data.filters->filters.find(reader_data.column_mapping[col_idx]);
+		if (filter_entry == reader_data.filters->filters.end() ||
+		    filter_entry->second->filter_type != TableFilterType::DYNAMIC_FILTER) {
+			continue;
+		}
+		auto &dynamic_filter = (DynamicFilter &)*filter_entry->second;
+		auto comparison_type = dynamic_filter.filter_data->comparison_type;
+		bool ascending = comparison_type == ExpressionType::COMPARE_LESSTHAN ||
+		                 comparison_type == ExpressionType::COMPARE_LESSTHANOREQUALTO;
+
+		// the values that the filter can be tightened to by every row group: its min (or max)
+		auto file_meta_data = GetFileMetadata();
+		auto root_reader = CreateReader();
+		auto column_reader = ((StructColumnReader *)root_reader.get())->GetChildReader(reader_data.column_ids[col_idx]);
+		vector<Value> bounds;
+		for (idx_t row_group_idx = 0; row_group_idx < row_group_count; row_group_idx++) {
+			auto &row_group = file_meta_data->row_groups[row_group_idx];
+			auto stats = column_reader->Stats(row_group_idx, row_group.columns);
+			if (!stats || stats->GetStatsType() != StatisticsType::NUMERIC_STATS || !NumericStats::HasMinMax(*stats)) {
+				return row_group_scan_order;
+			}
+			bounds.push_back(ascending ? NumericStats::Min(*stats) : NumericStats::Max(*stats));
+		}
+		std::stable_sort(row_group_scan_order.begin(), row_group_scan_order.end(), [&](idx_t a, idx_t b) {
+			return ascending ? bounds[a] < bounds[b] : bounds[a] > bounds[b];
+		});
+		break;
+	}
+	return row_group_scan_order;
+}
+
 void ParquetReader::InitializeScan(ParquetReaderScanState &state, vector<idx_t> groups_to_read) {
 	state.current_group = -1;
 	state.finished = false;
@@ -817,6 +862,14 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 	case TableFilterType::IS_NULL:
 		FilterIsNull(v, filter_mask, count);
 		break;
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto &dynamic_filter = (DynamicFilter &)filter;
+		auto constant_filter = dynamic_filter.filter_data->GetFilter();
+		if (constant_filter) {
+			ApplyFilter(v, *constant_filter, filter_mask, count);
+		}
+		break;
+	}
 	default:
 		D_ASSERT(0);
 		break;
@@ -16,6 +16,7 @@
 #include "duckdb/parser/constraints/list.hpp"
 #include "duckdb/function/table/table_scan.hpp"
 #include "duckdb/storage/table_storage_info.hpp"
+#include "duckdb/main/plan_cache.hpp"
 
 namespace duckdb {
 
@@ -711,6 +712,8 @@ const vector<unique_ptr<BoundConstraint>> &DuckTableEntry::GetBoundConstraints()
 
 TableFunction DuckTableEntry::GetScanFunction(ClientContext &context, unique_ptr<FunctionData> &bind_data) {
 	bind_data = make_uniq<TableScanBindData>(*this);
+	// a cached plan of the scan has to be replanned when data is written to the table
+	PlanCache::Get(context).RecordTable(*storage);
 	return TableScanFunction::GetFunction();
 }
 
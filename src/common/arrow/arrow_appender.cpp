@@ -31,6 +31,8 @@ struct ArrowAppendData {
 
 	// child data (if any)
 	vector<unique_ptr<ArrowAppendData>> child_data;
+	//! the vector whose memory is referenced by the arrow array instead of the buffers above (if any)
+	unique_ptr<Vector> reference;
 
 	//! the arrow array C API data, only set after Finalize
 	unique_ptr<ArrowArray> array;
@@ -594,11 +596,70 @@ struct ArrowMapData {
 //! Append a data chunk to the underlying arrow array
 void ArrowAppender::Append(DataChunk &input, idx_t from, idx_t to, idx_t input_size) {
 	D_ASSERT(types == input.GetTypes());
+	if (zero_copy) {
+		throw InternalException("ArrowAppender::Append called after ArrowAppender::AppendZeroCopy");
+	}
 	for (idx_t i = 0; i < input.ColumnCount(); i++) {
 		root_data[i]->append_vector(*root_data[i], input.data[i], from, to, input_size);
 	}
 	row_count += to - from;
 }
+
+void ArrowAppender::AppendZeroCopy(Allocator &allocator, DataChunk &input) {
+	D_ASSERT(types == input.GetTypes());
+	if (zero_copy || row_count > 0) {
+		throw InternalException("ArrowAppender::AppendZeroCopy can only be called on an empty appender");
+	}
+	zero_copy = true;
+	auto count = input.size();
+	for (idx_t i = 0; i < input.ColumnCount(); i++) {
+		auto &append_data = *root_data[i];
+		if (LayoutMatches(types[i])) {
+			auto reference = make_uniq<Vector>(types[i], nullptr);
+			if (input.TryDetachVector(allocator, i, *reference)) {
+				auto &validity = FlatVector::Validity(*reference);
+				append_data.row_count = count;
+				append_data.null_count = validity.AllValid() ? 0 : count - validity.CountValid(count);
+				append_data.reference = std::move(reference);
+				continue;
+			}
+		}
+		// the vector memory cannot be referenced: copy it
+		append_data.append_vector(append_data, input.data[i], 0, count, count);
+	}
+	row_count = count;
+}
+
+bool ArrowAppender::LayoutMatches(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::HUGEINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::TIMESTAMP_TZ:
+	case LogicalTypeId::TIME_TZ:
+		return true;
+	case LogicalTypeId::DECIMAL:
+		// arrow decimals are always 128-bit
+		return type.InternalType() == PhysicalType::INT128;
+	default:
+		// booleans are bit-packed in arrow, strings use offsets instead of pointers, and other types are converted
+		return false;
+	}
+}
 //===--------------------------------------------------------------------===//
 // Initialize Arrow Child
 //===--------------------------------------------------------------------===//
@@ -750,7 +811,14 @@ ArrowArray *FinalizeArrowChild(const LogicalType &type, ArrowAppendData &append_
 	result->length = append_data.row_count;
 	result->buffers[0] = append_data.validity.data();
 
-	if (append_data.finalize) {
+	if (append_data.reference) {
+		// the array points directly at the memory of the vector - the validity mask of DuckDB uses the same
+		// (least-significant bit first) layout as the arrow validity bitmap
+		auto &validity = FlatVector::Validity(*append_data.reference);
+		result->n_buffers = 2;
+		result->buffers[0] = validity.AllValid() ? nullptr : validity.GetData();
+		result->buffers[1] = FlatVector::GetData(*append_data.reference);
+	} else if (append_data.finalize) {
 		append_data.finalize(append_data, type, result.get());
 	}
 
@@ -0,0 +1,80 @@
+#include "duckdb/common/arrow/arrow_query_result.hpp"
+
+#include "duckdb/common/to_string.hpp"
+
+namespace duckdb {
+
+ArrowQueryResult::ArrowQueryResult(StatementType statement_type, StatementProperties properties,
+                                   vector<string> names_p, vector<LogicalType> types_p,
+                                   ClientProperties client_properties, idx_t batch_size)
+    : QueryResult(QueryResultType::ARROW_RESULT, statement_type, std::move(properties), std::move(types_p),
+                  std::move(names_p), std::move(client_properties)),
+      batch_size(batch_size), next_array(0) {
+}
+
+ArrowQueryResult::ArrowQueryResult(PreservedError error)
+    : QueryResult(QueryResultType::ARROW_RESULT, std::move(error)), batch_size(0), next_array(0) {
+}
+
+unique_ptr<DataChunk> ArrowQueryResult::Fetch() {
+	throw NotImplementedException("Fetching DataChunks from an ArrowQueryResult is not supported, consume the arrow "
+	                              "record batches instead");
+}
+
+unique_ptr<DataChunk> ArrowQueryResult::FetchRaw() {
+	return Fetch();
+}
+
+string ArrowQueryResult::ToString() {
+	if (!success) {
+		return GetError() + "\n";
+	}
+	string result = HeaderToString();
+	result += "[ Rows: " + to_string(RowCount()) + ", Record batches: " + to_string(arrays.size() - next_array) +
+	          "]\n";
+	return result;
+}
+
+idx_t ArrowQueryResult::BatchSize() const {
+	return batch_size;
+}
+
+idx_t ArrowQueryResult::RowCount() const {
+	idx_t count = 0;
+	for (idx_t i = next_array; i < arrays.size(); i++) {
+		count += arrays[i]->arrow_array.length;
+	}
+	return count;
+}
+
+vector<unique_ptr<ArrowArrayWrapper>> ArrowQueryResult::ConsumeArrays() {
+	if (HasError()) {
+		throw InvalidInputException("Attempting to fetch arrays from an unsuccessful query result\nError: %s",
+		                            GetError());
+	}
+	vector<unique_ptr<ArrowArrayWrapper>> result;
+	for (idx_t i = next_array; i < arrays.size(); i++) {
+		result.push_back(std::move(arrays[i]));
+	}
+	arrays.clear();
+	next_array = 0;
+	return result;
+}
+
+unique_ptr<ArrowArrayWrapper> ArrowQueryResult::ConsumeNextArray() {
+	if (HasError()) {
+		throw InvalidInputException("Attempting to fetch arrays from an unsuccessful query result\nError: %s",
+		                            GetError());
+	}
+	if (next_array >= arrays.size()) {
+		return nullptr;
+	}
+	return std::move(arrays[next_array++]);
+}
+
+void ArrowQueryResult::SetArrays(vector<unique_ptr<ArrowArrayWrapper>> arrays_p) {
+	arrays = std::move(arrays_p);
+	next_array = 0;
+}
+
+} // namespace duckdb
@@ -1,5 +1,6 @@
 #include "duckdb/common/arrow/arrow_wrapper.hpp"
 #include "duckdb/common/arrow/arrow_converter.hpp"
+#include "duckdb/common/arrow/arrow_query_result.hpp"
 
 #include "duckdb/common/assert.hpp"
 #include "duckdb/common/exception.hpp"
@@ -186,6 +187,21 @@ bool ArrowUtil::TryFetchNext(QueryResult &result, unique_ptr<DataChunk> &chunk,
 bool ArrowUtil::TryFetchChunk(QueryResult *result, idx_t chunk_size, ArrowArray *out, idx_t &count,
                               PreservedError &error) {
 	count = 0;
+	if (result->type == QueryResultType::ARROW_RESULT) {
+		// the record batches were already produced while executing the query
+		auto &arrow_result = (ArrowQueryResult &)*result;
+		if (arrow_result.HasError()) {
+			error = arrow_result.GetErrorObject();
+			return false;
+		}
+		auto array = arrow_result.ConsumeNextArray();
+		if (array) {
+			count = array->arrow_array.length;
+			*out = array->arrow_array;
+			array->arrow_array.release = nullptr;
+		}
+		return true;
+	}
 	ArrowAppender appender(result->types, chunk_size);
 	auto &current_chunk = result->current_chunk;
 	if (current_chunk.Valid()) {
@@ -19,6 +19,7 @@ static DefaultOptimizerType internal_optimizer_types[] = {
     {"join_order", OptimizerType::JOIN_ORDER},
     {"deliminator", OptimizerType::DELIMINATOR},
     {"unnest_rewriter", OptimizerType::UNNEST_REWRITER},
+    {"aggregate_pushdown", OptimizerType::AGGREGATE_PUSHDOWN},
     {"unused_columns", OptimizerType::UNUSED_COLUMNS},
     {"statistics_propagation", OptimizerType::STATISTICS_PROPAGATION},
     {"common_subexpressions", OptimizerType::COMMON_SUBEXPRESSIONS},
@@ -5,6 +5,7 @@
 #include "duckdb/common/file_opener.hpp"
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/trace_recorder.hpp"
 #include "duckdb/common/windows.hpp"
 #include "duckdb/function/scalar/string_functions.hpp"
 #include "duckdb/main/client_context.hpp"
@@ -397,7 +398,14 @@ FileHandle::~FileHandle() {
 }
 
 int64_t FileHandle::Read(void *buffer, idx_t nr_bytes) {
-	return file_system.Read(*this, buffer, nr_bytes);
+	TraceScope trace("io", "read");
+	if (!trace.IsActive()) {
+		return file_system.Read(*this, buffer, nr_bytes);
+	}
+	trace.SetName("read: " + path);
+	auto bytes_read = file_system.Read(*this, buffer, nr_bytes);
+	trace.SetBytes(bytes_read);
+	return bytes_read;
 }
 
 int64_t FileHandle::Write(void *buffer, idx_t nr_bytes) {
@@ -405,6 +413,10 @@ int64_t FileHandle::Write(void *buffer, idx_t nr_bytes) {
 }
 
 void FileHandle::Read(void *buffer, idx_t nr_bytes, idx_t location) {
+	TraceScope trace("io", "read", nr_bytes);
+	if (trace.IsActive()) {
+		trace.SetName("read: " + path);
+	}
 	file_system.Read(*this, buffer, nr_bytes, location);
 }
 
@@ -0,0 +1,105 @@
+#include "duckdb/common/hardware_counters.hpp"
+
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#define DUCKDB_PERF_EVENTS
+#endif
+
+namespace duckdb {
+
+#ifdef DUCKDB_PERF_EVENTS
+//! The perf event group of a single thread
+struct ThreadHardwareCounters {
+	static constexpr const idx_t COUNTER_COUNT = 4;
+
+	ThreadHardwareCounters() {
+		const uint64_t configs[COUNTER_COUNT] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+		                                         PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+		for (idx_t i = 0; i < COUNTER_COUNT; i++) {
+			perf_event_attr attr;
+			memset(&attr, 0, sizeof(attr));
+			attr.type = PERF_TYPE_HARDWARE;
+			attr.size = sizeof(attr);
+			attr.config = configs[i];
+			attr.read_format = PERF_FORMAT_GROUP;
+			attr.exclude_kernel = 1;
+			attr.exclude_hv = 1;
+			// the first counter that can be opened leads the group: all counters are read with a single syscall
+			attr.disabled = leader_fd < 0 ? 1 : 0;
+			int fd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, leader_fd, 0);
+			if (fd < 0) {
+				// the event is not supported (e.g. in a virtual machine): it reads as zero
+				continue;
+			}
+			if (leader_fd < 0) {
+				leader_fd = fd;
+			}
+			fds[counter_count] = fd;
+			group_counters[counter_count++] = i;
+		}
+		if (leader_fd >= 0) {
+			ioctl(leader_fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+			ioctl(leader_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+		}
+	}
+	~ThreadHardwareCounters() {
+		for (idx_t i = 0; i < counter_count; i++) {
+			close(fds[i]);
+		}
+	}
+
+	bool Read(HardwareCounterValues &result) {
+		if (leader_fd < 0) {
+			return false;
+		}
+		// layout of a group read: the number of counters followed by their values
+		uint64_t buffer[COUNTER_COUNT + 1];
+		auto bytes = read(leader_fd, buffer, sizeof(buffer));
+		if (bytes < (ssize_t)sizeof(uint64_t)) {
+			return false;
+		}
+		uint64_t values[COUNTER_COUNT] = {0, 0, 0, 0};
+		for (idx_t i = 0; i < buffer[0] && i < counter_count; i++) {
+			values[group_counters[i]] = buffer[i + 1];
+		}
+		result.cycles = values[0];
+		result.instructions = values[1];
+		result.llc_misses = values[2];
+		result.branch_misses = values[3];
+		return true;
+	}
+
+	int leader_fd = -1;
+	int fds[COUNTER_COUNT];
+	//! The counter (index in configs) of every member of the group, in the order in which they were opened
+	idx_t group_counters[COUNTER_COUNT];
+	idx_t counter_count = 0;
+};
+
+static ThreadHardwareCounters &GetThreadCounters() {
+	static thread_local ThreadHardwareCounters counters;
+	return counters;
+}
+#endif
+
+bool HardwareCounters::Read(HardwareCounterValues &result) {
+#ifdef DUCKDB_PERF_EVENTS
+	return GetThreadCounters().Read(result);
+#else
+	return false;
+#endif
+}
+
+bool HardwareCounters::IsAvailable() {
+#ifdef DUCKDB_PERF_EVENTS
+	return GetThreadCounters().leader_fd >= 0;
+#else
+	return false;
+#endif
+}
+
+} // namespace duckdb
@@ -1,6 +1,7 @@
 #include "duckdb/common/multi_file_reader.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/main/plan_cache.hpp"
 #include "duckdb/common/types/value.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/common/exception.hpp"
@@ -43,6 +44,8 @@ vector<string> MultiFileReader::GetFileList(ClientContext &context, const Value
 	if (files.empty() && options == FileGlobOptions::DISALLOW_EMPTY) {
 		throw IOException("%s reader needs at least one file to read", name);
 	}
+	// plans that scan these files are only valid for as long as the input expands to the same files
+	PlanCache::Get(context).RecordFileList(input, name, options, files);
 	return files;
 }
 
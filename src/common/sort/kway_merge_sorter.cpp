@@ -0,0 +1,356 @@
+#include "duckdb/common/fast_mem.hpp"
+#include "duckdb/common/sort/comparators.hpp"
+#include "duckdb/common/sort/sort.hpp"
+
+#include <algorithm>
+#include <functional>
+
+namespace duckdb {
+
+KWayMergeSorter::KWayMergeSorter(GlobalSortState &state, BufferManager &buffer_manager)
+    : state(state), buffer_manager(buffer_manager), sort_layout(state.sort_layout), result(nullptr) {
+}
+
+//===--------------------------------------------------------------------===//
+// Partitioning
+//===--------------------------------------------------------------------===//
+//! A row in one of the sorted blocks of the global sort state
+struct KWayMergeRow {
+	idx_t block;
+	idx_t entry;
+};
+
+//! Orders rows of different sorted blocks. Ties are broken by the position of the rows, so that the rows are totally
+//! ordered and a splitter row divides every sorted block consistently.
+class KWayMergeRowComparator {
+public:
+	explicit KWayMergeRowComparator(GlobalSortState &state)
+	    : state(state), sort_layout(state.sort_layout), left(state.buffer_manager, state),
+	      right(state.buffer_manager, state) {
+	}
+
+	bool operator()(const KWayMergeRow &l, const KWayMergeRow &r) {
+		const auto comp_res = Compare(l, r);
+		if (comp_res != 0) {
+			return comp_res < 0;
+		}
+		if (l.block != r.block) {
+			return l.block < r.block;
+		}
+		return l.entry < r.entry;
+	}
+
+private:
+	int Compare(const KWayMergeRow &l, const KWayMergeRow &r) {
+		Position(left, l);
+		Position(right, r);
+		if (sort_layout.all_constant) {
+			return FastMemcmp(left.RadixPtr(), right.RadixPtr(), sort_layout.comparison_size);
+		}
+		left.PinData(*left.sb->blob_sorting_data);
+		right.PinData(*right.sb->blob_sorting_data);
+		return Comparators::CompareTuple(left, right, left.RadixPtr(), right.RadixPtr(), sort_layout, state.external);
+	}
+
+	void Position(SBScanState &scan, const KWayMergeRow &row) {
+		scan.sb = state.sorted_blocks[row.block].get();
+		scan.sb->GlobalToLocalIndex(row.entry, scan.block_idx, scan.entry_idx);
+		scan.PinRadix(scan.block_idx);
+	}
+
+	GlobalSortState &state;
+	const SortLayout &sort_layout;
+	SBScanState left;
+	SBScanState right;
+};
+
+void KWayMergeSorter::ComputePartitions(GlobalSortState &state, idx_t partition_count) {
+	auto &sorted_blocks = state.sorted_blocks;
+	const idx_t block_count = sorted_blocks.size();
+	vector<idx_t> counts;
+	idx_t total_count = 0;
+	for (auto &sb : sorted_blocks) {
+		counts.push_back(sb->Count());
+		total_count += counts.back();
+	}
+	// Sample rows at regular intervals from every sorted block (they are sorted, so these are quantiles)
+	static constexpr idx_t SAMPLES_PER_PARTITION = 32;
+	partition_count = MaxValue<idx_t>(partition_count, 1);
+	const idx_t step = MaxValue<idx_t>(total_count / (partition_count * SAMPLES_PER_PARTITION), 1);
+	vector<KWayMergeRow> samples;
+	for (idx_t b = 0; b < block_count; b++) {
+		for (idx_t entry = step / 2; entry < counts[b]; entry += step) {
+			samples.push_back({b, entry});
+		}
+	}
+	KWayMergeRowComparator less_than(state);
+	std::sort(samples.begin(), samples.end(), std::ref(less_than));
+	partition_count = MinValue<idx_t>(partition_count, samples.size() + 1);
+
+	// The i-th splitter is the upper bound of the i-th partition. Locate it in every sorted block.
+	vector<vector<idx_t>> bounds;
+	bounds.emplace_back(block_count, 0);
+	for (idx_t p = 1; p < partition_count; p++) {
+		const auto &splitter = samples[p * samples.size() / partition_count];
+		vector<idx_t> splitter_bounds;
+		for (idx_t b = 0; b < block_count; b++) {
+			if (b == splitter.block) {
+				splitter_bounds.push_back(splitter.entry);
+				continue;
+			}
+			// Binary search for the first row that does not sort before the splitter
+			idx_t lower = bounds.back()[b];
+			idx_t upper = counts[b];
+			while (lower < upper) {
+				const idx_t middle = lower + (upper - lower) / 2;
+				if (less_than(KWayMergeRow {b, middle}, splitter)) {
+					lower = middle + 1;
+				} else {
+					upper = middle;
+				}
+			}
+			splitter_bounds.push_back(lower);
+		}
+		bounds.push_back(std::move(splitter_bounds));
+	}
+	bounds.push_back(counts);
+
+	// Slice the sorted blocks. This has to happen in order, as slicing releases the blocks before the slice
+	state.kway_partitions.clear();
+	for (idx_t p = 0; p < partition_count; p++) {
+		KWayMergePartition partition;
+		for (idx_t b = 0; b < block_count; b++) {
+			const auto start = bounds[p][b];
+			const auto end = bounds[p + 1][b];
+			D_ASSERT(start <= end);
+			if (start == end) {
+				continue;
+			}
+			idx_t entry_idx;
+			partition.slices.push_back(sorted_blocks[b]->CreateSlice(start, end, entry_idx));
+			partition.entry_idxs.push_back(entry_idx);
+		}
+		state.kway_partitions.push_back(std::move(partition));
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Merging
+//===--------------------------------------------------------------------===//
+void KWayMergeSorter::PerformKWayMerge() {
+	while (true) {
+		idx_t partition_idx;
+		{
+			lock_guard<mutex> partition_guard(state.lock);
+			if (state.kway_partition_idx == state.kway_partitions.size()) {
+				break;
+			}
+			partition_idx = state.kway_partition_idx++;
+		}
+		auto &partition = state.kway_partitions[partition_idx];
+		MergePartition(partition, state.sorted_blocks_temp[partition_idx]);
+		// Delete references to the merged data
+		partition.slices.clear();
+	}
+}
+
+void KWayMergeSorter::MergePartition(KWayMergePartition &partition, vector<unique_ptr<SortedBlock>> &result_blocks) {
+	inputs.clear();
+	for (idx_t i = 0; i < partition.slices.size(); i++) {
+		auto input = make_uniq<SBScanState>(buffer_manager, state);
+		input->sb = partition.slices[i].get();
+		input->SetIndices(0, partition.entry_idxs[i]);
+		PinInput(*input);
+		inputs.push_back(std::move(input));
+	}
+	if (inputs.empty()) {
+		return;
+	}
+	InitializeLoserTree();
+	idx_t winner = losers[0];
+	idx_t result_count = 0;
+	result = nullptr;
+	while (!Exhausted(*inputs[winner])) {
+		// Each result block holds (at most) state.block_capacity rows, just like the blocks of the cascaded merge
+		if (!result || result_count == state.block_capacity) {
+			InitializeWrite(result_blocks);
+			result_count = 0;
+		}
+		auto &input = *inputs[winner];
+		CopyRow(input);
+		result_count++;
+		input.entry_idx++;
+		PinInput(input);
+		winner = ReplayLoserTree(winner);
+	}
+#ifdef DEBUG
+	idx_t merged_count = 0;
+	for (auto &sb : result_blocks) {
+		merged_count += sb->Count();
+	}
+	idx_t input_count = 0;
+	for (idx_t i = 0; i < partition.slices.size(); i++) {
+		input_count += partition.slices[i]->Count() - partition.entry_idxs[i];
+	}
+	D_ASSERT(merged_count == input_count);
+#endif
+	// Unpin the result
+	result = nullptr;
+	radix_handle.Destroy();
+	blob_data_handle.Destroy();
+	blob_heap_handle.Destroy();
+	payload_data_handle.Destroy();
+	payload_heap_handle.Destroy();
+}
+
+void KWayMergeSorter::PinInput(SBScanState &input) {
+	auto &sb = *input.sb;
+	const bool external_heap = !state.payload_layout.AllConstant() && state.external;
+	const bool external_blob_heap = !sort_layout.all_constant && state.external;
+	// Move to the next block (if needed)
+	while (!Exhausted(input) && input.entry_idx == sb.radix_sorting_data[input.block_idx]->count) {
+		// Delete reference to previous block
+		sb.radix_sorting_data[input.block_idx]->block = nullptr;
+		if (!sort_layout.all_constant) {
+			sb.blob_sorting_data->data_blocks[input.block_idx]->block = nullptr;
+			if (external_blob_heap) {
+				sb.blob_sorting_data->heap_blocks[input.block_idx]->block = nullptr;
+			}
+		}
+		sb.payload_data->data_blocks[input.block_idx]->block = nullptr;
+		if (external_heap) {
+			sb.payload_data->heap_blocks[input.block_idx]->block = nullptr;
+		}
+		// Advance block
+		input.block_idx++;
+		input.entry_idx = 0;
+	}
+	if (Exhausted(input)) {
+		return;
+	}
+	input.PinRadix(input.block_idx);
+	if (!sort_layout.all_constant) {
+		input.PinData(*sb.blob_sorting_data);
+	}
+	input.PinData(*sb.payload_data);
+}
+
+bool KWayMergeSorter::InputIsSmaller(idx_t l, idx_t r) {
+	auto &left = *inputs[l];
+	auto &right = *inputs[r];
+	// Exhausted inputs sort after everything else
+	if (Exhausted(left)) {
+		return false;
+	}
+	if (Exhausted(right)) {
+		return true;
+	}
+	int comp_res;
+	if (sort_layout.all_constant) {
+		comp_res = FastMemcmp(left.RadixPtr(), right.RadixPtr(), sort_layout.comparison_size);
+	} else {
+		comp_res = Comparators::CompareTuple(left, right, left.RadixPtr(), right.RadixPtr(), sort_layout, state.external);
+	}
+	// The inputs are in the order of the sorted blocks, break ties in the same way as the partitioning does
+	return comp_res < 0 || (comp_res == 0 && l < r);
+}
+
+void KWayMergeSorter::InitializeLoserTree() {
+	// The leaves of the tree are the inputs (nodes k, ..., 2k - 1), node 1 is the root.
+	// losers[0] holds the overall winner
+	const idx_t k = inputs.size();
+	vector<idx_t> winners(2 * k);
+	losers.assign(k, 0);
+	for (idx_t i = 0; i < k; i++) {
+		winners[k + i] = i;
+	}
+	for (idx_t node = k - 1; node > 0; node--) {
+		const auto l = winners[2 * node];
+		const auto r = winners[2 * node + 1];
+		if (InputIsSmaller(r, l)) {
+			winners[node] = r;
+			losers[node] = l;
+		} else {
+			winners[node] = l;
+			losers[node] = r;
+		}
+	}
+	losers[0] = k == 1 ? 0 : winners[1];
+}
+
+idx_t KWayMergeSorter::ReplayLoserTree(idx_t winner) {
+	// Play the matches on the path from the leaf of the winner to the root
+	const idx_t k = inputs.size();
+	for (idx_t node = (k + winner) / 2; node > 0; node /= 2) {
+		if (InputIsSmaller(losers[node], winner)) {
+			std::swap(losers[node], winner);
+		}
+	}
+	losers[0] = winner;
+	return winner;
+}
+
+void KWayMergeSorter::InitializeWrite(vector<unique_ptr<SortedBlock>> &result_blocks) {
+	result_blocks.push_back(make_uniq<SortedBlock>(buffer_manager, state));
+	result = result_blocks.back().get();
+	result->InitializeWrite();
+	radix_handle = buffer_manager.Pin(result->radix_sorting_data.back()->block);
+	if (!sort_layout.all_constant) {
+		blob_data_handle = buffer_manager.Pin(result->blob_sorting_data->data_blocks.back()->block);
+		if (state.external) {
+			blob_heap_handle = buffer_manager.Pin(result->blob_sorting_data->heap_blocks.back()->block);
+		}
+	}
+	payload_data_handle = buffer_manager.Pin(result->payload_data->data_blocks.back()->block);
+	if (!state.payload_layout.AllConstant() && state.external) {
+		payload_heap_handle = buffer_manager.Pin(result->payload_data->heap_blocks.back()->block);
+	}
+}
+
+void KWayMergeSorter::CopyRow(SBScanState &input) {
+	// Radix sorting data
+	auto &radix_block = *result->radix_sorting_data.back();
+	D_ASSERT(radix_block.count < radix_block.capacity);
+	FastMemcpy(radix_handle.Ptr() + radix_block.count * sort_layout.entry_size, input.RadixPtr(),
+	           sort_layout.entry_size);
+	radix_block.count++;
+	// Blob sorting data
+	if (!sort_layout.all_constant) {
+		CopyData(*result->blob_sorting_data, *input.sb->blob_sorting_data, input, blob_data_handle, blob_heap_handle);
+	}
+	// Payload data
+	CopyData(*result->payload_data, *input.sb->payload_data, input, payload_data_handle, payload_heap_handle);
+}
+
+void KWayMergeSorter::CopyData(SortedData &target, SortedData &source, SBScanState &input,
+                               BufferHandle &target_data_handle, BufferHandle &target_heap_handle) {
+	const auto &layout = target.layout;
+	const idx_t row_width = layout.GetRowWidth();
+	auto &target_data_block = *target.data_blocks.back();
+	D_ASSERT(target_data_block.count < target_data_block.capacity);
+	const data_ptr_t target_row_ptr = target_data_handle.Ptr() + target_data_block.count * row_width;
+	FastMemcpy(target_row_ptr, input.DataPtr(source), row_width);
+	target_data_block.count++;
+	if (layout.AllConstant() || !state.external) {
+		// If all constant size, or if we are doing an in-memory sort, we do not need to touch the heap
+		return;
+	}
+	// External sorting with variable size data: copy the heap row too
+	const data_ptr_t source_heap_ptr = input.HeapPtr(source);
+	const auto entry_size = Load<uint32_t>(source_heap_ptr);
+	D_ASSERT(entry_size >= sizeof(uint32_t));
+	auto &target_heap_block = *target.heap_blocks.back();
+	if (target_heap_block.byte_offset + entry_size > target_heap_block.capacity) {
+		// Reallocate result heap block size (grow geometrically, we copy row by row)
+		idx_t new_capacity = MaxValue(target_heap_block.capacity * 2, target_heap_block.byte_offset + entry_size);
+		buffer_manager.ReAllocate(target_heap_block.block, new_capacity);
+		target_heap_block.capacity = new_capacity;
+	}
+	// Store base heap offset in the row data
+	Store<idx_t>(target_heap_block.byte_offset, target_row_ptr + layout.GetHeapOffset());
+	memcpy(target_heap_handle.Ptr() + target_heap_block.byte_offset, source_heap_ptr, entry_size);
+	target_heap_block.byte_offset += entry_size;
+	target_heap_block.count++;
+}
+
+} // namespace duckdb
@@ -1,4 +1,5 @@
 #include "duckdb/common/fast_mem.hpp"
+#include "duckdb/common/limits.hpp"
 #include "duckdb/common/radix.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/sort/sort.hpp"
@@ -462,6 +463,58 @@ void GlobalSortState::CompleteMergeRound(bool keep_radix_data) {
 		sorted_blocks[0]->blob_sorting_data = nullptr;
 	}
 }
+
+idx_t GlobalSortState::KWayMergeFanIn(idx_t threads) const {
+	if (!external) {
+		// All data is in memory already
+		return NumericLimits<idx_t>::Maximum();
+	}
+	// Every thread pins a block of every sorted block it merges, plus a block that it writes to
+	idx_t block_size = 0;
+	for (auto &sb : sorted_blocks) {
+		block_size = MaxValue(block_size, sb->SizeInBytes() / MaxValue<idx_t>(sb->radix_sorting_data.size(), 1));
+	}
+	if (block_size == 0) {
+		return NumericLimits<idx_t>::Maximum();
+	}
+	// Leave room for the rest of the query
+	const idx_t memory_budget = buffer_manager.GetMaxMemory() / 2;
+	const idx_t pinned_blocks = memory_budget / (block_size * MaxValue<idx_t>(threads, 1));
+	return MaxValue<idx_t>(pinned_blocks, 3) - 1;
+}
+
+void GlobalSortState::InitializeKWayMerge(idx_t partition_count) {
+	D_ASSERT(sorted_blocks_temp.empty());
+	D_ASSERT(!odd_one_out);
+	KWayMergeSorter::ComputePartitions(*this, partition_count);
+	// The slices of the partitions hold references to the data now
+	sorted_blocks.clear();
+	// Allocate room for merge results
+	kway_partition_idx = 0;
+	for (idx_t p_idx = 0; p_idx < kway_partitions.size(); p_idx++) {
+		sorted_blocks_temp.emplace_back();
+	}
+}
+
+void GlobalSortState::CompleteKWayMerge(bool keep_radix_data) {
+	// The partitions are ordered, so we can simply concatenate them
+	vector<unique_ptr<SortedBlock>> merged_blocks;
+	for (auto &sorted_block_vector : sorted_blocks_temp) {
+		for (auto &sb : sorted_block_vector) {
+			merged_blocks.push_back(std::move(sb));
+		}
+	}
+	sorted_blocks_temp.clear();
+	kway_partitions.clear();
+	sorted_blocks.clear();
+	sorted_blocks.push_back(make_uniq<SortedBlock>(buffer_manager, *this));
+	sorted_blocks.back()->AppendSortedBlocks(merged_blocks);
+	if (!keep_radix_data) {
+		sorted_blocks[0]->radix_sorting_data.clear();
+		sorted_blocks[0]->blob_sorting_data = nullptr;
+	}
+}
+
 void GlobalSortState::Print() {
 	PayloadScanner scanner(*this, false);
 	DataChunk chunk;
@@ -0,0 +1,296 @@
+#include "duckdb/common/trace_recorder.hpp"
+
+#include "duckdb/common/chrono.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/main/database.hpp"
+
+#include <cstring>
+#include <sstream>
+
+namespace duckdb {
+
+static uint64_t CurrentNanos() {
+	return duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//! The recorders that are alive, so that exiting threads only hand their buffers back to live recorders
+//! Never destroyed: threads can still release their buffers while the process is shutting down
+static mutex &LiveRecordersLock() {
+	static auto lock = new mutex();
+	return *lock;
+}
+
+static unordered_map<idx_t, TraceRecorder *> &LiveRecorders() {
+	static auto recorders = new unordered_map<idx_t, TraceRecorder *>();
+	return *recorders;
+}
+
+static atomic<idx_t> next_recorder_id {0};
+
+//! Owns the trace buffers of a thread (one per recorder it recorded into), and hands them back to their recorders
+//! when the thread exits
+struct ThreadTraceBuffers {
+	struct Entry {
+		idx_t recorder_id;
+		TraceRecorder::ThreadBuffer *buffer;
+	};
+
+	~ThreadTraceBuffers() {
+		lock_guard<mutex> guard(LiveRecordersLock());
+		auto &live_recorders = LiveRecorders();
+		for (auto &entry : entries) {
+			auto recorder = live_recorders.find(entry.recorder_id);
+			if (recorder != live_recorders.end()) {
+				recorder->second->ReleaseThreadBuffer(*entry.buffer);
+			}
+		}
+	}
+
+	TraceRecorder::ThreadBuffer *Find(idx_t recorder_id) {
+		for (auto &entry : entries) {
+			if (entry.recorder_id == recorder_id) {
+				return entry.buffer;
+			}
+		}
+		return nullptr;
+	}
+
+	void Add(idx_t recorder_id, TraceRecorder::ThreadBuffer &buffer) {
+		// forget the buffers of recorders that were destroyed in the meantime
+		lock_guard<mutex> guard(LiveRecordersLock());
+		auto &live_recorders = LiveRecorders();
+		vector<Entry> live_entries;
+		for (auto &entry : entries) {
+			if (live_recorders.find(entry.recorder_id) != live_recorders.end()) {
+				live_entries.push_back(entry);
+			}
+		}
+		live_entries.push_back(Entry {recorder_id, &buffer});
+		entries = std::move(live_entries);
+	}
+
+	vector<Entry> entries;
+};
+
+static thread_local ThreadTraceBuffers thread_trace_buffers;
+//! The recorder of the database whose task the thread is executing
+static thread_local TraceRecorder *current_recorder = nullptr;
+
+TraceRecorder::TraceRecorder()
+    : recorder_id(next_recorder_id++), enabled(false), generation(0), epoch(CurrentNanos()), next_thread_id(0) {
+	lock_guard<mutex> guard(LiveRecordersLock());
+	LiveRecorders()[recorder_id] = this;
+}
+
+TraceRecorder::~TraceRecorder() {
+	lock_guard<mutex> guard(LiveRecordersLock());
+	LiveRecorders().erase(recorder_id);
+}
+
+TraceRecorder &TraceRecorder::Get(DatabaseInstance &db) {
+	return db.GetTraceRecorder();
+}
+
+TraceRecorder &TraceRecorder::Get(ClientContext &context) {
+	return Get(DatabaseInstance::GetDatabase(context));
+}
+
+TraceRecorder *TraceRecorder::Current() {
+	return current_recorder;
+}
+
+void TraceRecorder::Enable() {
+	lock_guard<mutex> guard(lock);
+	// buffers are cleared lazily, when they are used again or exported
+	generation++;
+	enabled = true;
+}
+
+void TraceRecorder::Disable() {
+	enabled = false;
+}
+
+uint64_t TraceRecorder::Now() const {
+	return CurrentNanos() - epoch;
+}
+
+TraceRecorder::ThreadBuffer &TraceRecorder::GetThreadBuffer() {
+	auto cached_buffer = thread_trace_buffers.Find(recorder_id);
+	if (cached_buffer) {
+		return *cached_buffer;
+	}
+	ThreadBuffer *result = nullptr;
+	{
+		lock_guard<mutex> guard(lock);
+		for (auto &buffer : buffers) {
+			if (!buffer->in_use) {
+				result = buffer.get();
+				break;
+			}
+		}
+		if (!result) {
+			buffers.push_back(make_uniq<ThreadBuffer>());
+			result = buffers.back().get();
+		}
+		lock_guard<mutex> buffer_guard(result->lock);
+		result->in_use = true;
+		result->thread_id = next_thread_id++;
+	}
+	// outside of the lock: exiting threads lock the live recorders before the recorder they release a buffer to
+	thread_trace_buffers.Add(recorder_id, *result);
+	return *result;
+}
+
+void TraceRecorder::ReleaseThreadBuffer(ThreadBuffer &buffer) {
+	lock_guard<mutex> guard(lock);
+	lock_guard<mutex> buffer_guard(buffer.lock);
+	buffer.in_use = false;
+}
+
+TraceEvent &TraceRecorder::AddEvent(ThreadBuffer &buffer) {
+	idx_t current_generation = generation;
+	if (buffer.generation != current_generation) {
+		buffer.events.clear();
+		buffer.next = 0;
+		buffer.generation = current_generation;
+	}
+	if (buffer.events.size() < RING_BUFFER_CAPACITY) {
+		buffer.events.emplace_back();
+		return buffer.events.back();
+	}
+	auto &event = buffer.events[buffer.next];
+	buffer.next = (buffer.next + 1) % RING_BUFFER_CAPACITY;
+	return event;
+}
+
+static void SetEventName(TraceEvent &event, const string &name) {
+	auto length = MinValue<idx_t>(name.size(), TraceEvent::MAX_NAME_LENGTH);
+	memcpy(event.name, name.c_str(), length);
+	event.name[length] = '\0';
+}
+
+void TraceRecorder::Record(const char *category, const string &name, uint64_t start, uint64_t end, int64_t bytes) {
+	auto &buffer = GetThreadBuffer();
+	lock_guard<mutex> guard(buffer.lock);
+	auto &event = AddEvent(buffer);
+	SetEventName(event, name);
+	event.category = category;
+	event.thread_id = buffer.thread_id;
+	event.start = start;
+	event.duration = end > start ? end - start : 0;
+	event.bytes = bytes;
+	event.instant = false;
+}
+
+void TraceRecorder::RecordInstant(const char *category, const string &name) {
+	auto &buffer = GetThreadBuffer();
+	lock_guard<mutex> guard(buffer.lock);
+	auto &event = AddEvent(buffer);
+	SetEventName(event, name);
+	event.category = category;
+	event.thread_id = buffer.thread_id;
+	event.start = Now();
+	event.duration = 0;
+	event.bytes = -1;
+	event.instant = true;
+}
+
+idx_t TraceRecorder::EventCount() {
+	lock_guard<mutex> guard(lock);
+	idx_t count = 0;
+	for (auto &buffer : buffers) {
+		lock_guard<mutex> buffer_guard(buffer->lock);
+		if (buffer->generation == generation) {
+			count += buffer->events.size();
+		}
+	}
+	return count;
+}
+
+static void WriteJSONString(std::stringstream &ss, const char *text) {
+	ss << '"';
+	for (auto c = text; *c; c++) {
+		switch (*c) {
+		case '"':
+			ss << "\\\"";
+			break;
+		case '\\':
+			ss << "\\\\";
+			break;
+		case '\n':
+			ss << "\\n";
+			break;
+		case '\t':
+			ss << "\\t";
+			break;
+		default:
+			if ((unsigned char)*c < 0x20) {
+				ss << ' ';
+			} else {
+				ss << *c;
+			}
+			break;
+		}
+	}
+	ss << '"';
+}
+
+string TraceRecorder::ToChromeTrace() {
+	std::stringstream ss;
+	ss << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+	bool first = true;
+	lock_guard<mutex> guard(lock);
+	for (auto &buffer : buffers) {
+		lock_guard<mutex> buffer_guard(buffer->lock);
+		if (buffer->generation != generation) {
+			continue;
+		}
+		for (auto &event : buffer->events) {
+			ss << (first ? "\n" : ",\n");
+			first = false;
+			ss << "{\"name\": ";
+			WriteJSONString(ss, event.name);
+			ss << ", \"cat\": ";
+			WriteJSONString(ss, event.category);
+			// timestamps in the Chrome trace format are in microseconds
+			ss << ", \"pid\": 0, \"tid\": " << event.thread_id << ", \"ts\": " << (double)event.start / 1000.0;
+			if (event.instant) {
+				ss << ", \"ph\": \"i\", \"s\": \"t\"";
+			} else {
+				ss << ", \"ph\": \"X\", \"dur\": " << (double)event.duration / 1000.0;
+			}
+			if (event.bytes >= 0) {
+				ss << ", \"args\": {\"bytes\": " << event.bytes << "}";
+			}
+			ss << "}";
+		}
+	}
+	ss << "\n]}\n";
+	return ss.str();
+}
+
+TraceThreadScope::TraceThreadScope(TraceRecorder &recorder) : previous(current_recorder) {
+	current_recorder = &recorder;
+}
+
+TraceThreadScope::~TraceThreadScope() {
+	current_recorder = previous;
+}
+
+TraceScope::TraceScope(const char *category, const char *name, int64_t bytes)
+    : recorder(TraceRecorder::Current()), active(recorder && recorder->IsEnabled()), category(category),
+      bytes(bytes), start(0) {
+	if (active) {
+		this->name = name;
+		start = recorder->Now();
+	}
+}
+
+TraceScope::~TraceScope() {
+	if (!active) {
+		return;
+	}
+	recorder->Record(category, name, start, recorder->Now(), bytes);
+}
+
+} // namespace duckdb
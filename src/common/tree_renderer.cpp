@@ -495,12 +495,42 @@ string TreeRenderer::ExtractExpressionsRecursive(ExpressionInfo &state) {
 	return result;
 }
 
+//! Render a (large) count compactly, e.g. 1.23M
+static string RenderCount(uint64_t count) {
+	static const char *suffixes[] = {"", "K", "M", "G", "T"};
+	double value = double(count);
+	idx_t suffix = 0;
+	while (value >= 1000 && suffix + 1 < sizeof(suffixes) / sizeof(suffixes[0])) {
+		value /= 1000;
+		suffix++;
+	}
+	if (suffix == 0) {
+		return to_string(count);
+	}
+	return StringUtil::Format("%.2f%s", value, suffixes[suffix]);
+}
+
 unique_ptr<RenderTreeNode> TreeRenderer::CreateNode(const QueryProfiler::TreeNode &op) {
 	auto result = TreeRenderer::CreateRenderNode(op.name, op.extra_info);
 	result->extra_text += "\n[INFOSEPARATOR]";
 	result->extra_text += "\n" + to_string(op.info.elements);
 	string timing = StringUtil::Format("%.2f", op.info.time);
 	result->extra_text += "\n(" + timing + "s)";
+	if (!op.info.runtime_info.empty()) {
+		result->extra_text += "\n[INFOSEPARATOR]";
+		result->extra_text += "\n" + op.info.runtime_info;
+	}
+	auto &counters = op.info.counters;
+	if (!counters.IsEmpty()) {
+		result->extra_text += "\n[INFOSEPARATOR]";
+		result->extra_text += "\ncycles: " + RenderCount(counters.cycles);
+		result->extra_text += "\ninstructions: " + RenderCount(counters.instructions);
+		if (counters.cycles > 0) {
+			result->extra_text += "\nIPC: " + StringUtil::Format("%.2f", double(counters.instructions) / counters.cycles);
+		}
+		result->extra_text += "\nLLC misses: " + RenderCount(counters.llc_misses);
+		result->extra_text += "\nbranch misses: " + RenderCount(counters.branch_misses);
+	}
 	if (config.detailed) {
 		for (auto &info : op.info.executors_info) {
 			if (!info) {
@@ -123,6 +123,31 @@ void DataChunk::Move(DataChunk &chunk) {
 	chunk.Destroy();
 }
 
+bool DataChunk::TryDetachVector(Allocator &allocator, idx_t col_idx, Vector &result) {
+	D_ASSERT(col_idx < ColumnCount());
+	auto &vector = data[col_idx];
+	if (vector.GetVectorType() != VectorType::FLAT_VECTOR || !vector.buffer ||
+	    !TypeIsConstantSize(vector.GetType().InternalType())) {
+		return false;
+	}
+	if (col_idx < vector_caches.size() && vector_caches[col_idx].OwnsData(vector)) {
+		// the vector lives in the memory of the cache: the cache memory now belongs to the result
+		result.Reference(vector);
+		vector_caches[col_idx] = VectorCache(allocator, vector.GetType(), capacity);
+	} else if (vector.buffer->GetBufferType() == VectorBufferType::STANDARD_BUFFER && vector.buffer.use_count() == 1 &&
+	           vector.data == vector.buffer->GetData()) {
+		// the vector is the only owner of its memory
+		result.Reference(vector);
+	} else {
+		return false;
+	}
+	auto &validity = FlatVector::Validity(result);
+	if (!validity.IsOwned()) {
+		validity.Copy(FlatVector::Validity(vector), size());
+	}
+	return true;
+}
+
 void DataChunk::Copy(DataChunk &other, idx_t offset) const {
 	D_ASSERT(ColumnCount() == other.ColumnCount());
 	D_ASSERT(other.size() == 0);
@@ -36,40 +36,32 @@ idx_t HyperLogLog::Count() const {
 }
 
 unique_ptr<HyperLogLog> HyperLogLog::Merge(HyperLogLog &other) {
-	duckdb_hll::robj *hlls[2];
-	hlls[0] = (duckdb_hll::robj *)hll;
-	hlls[1] = (duckdb_hll::robj *)other.hll;
-	auto new_hll = duckdb_hll::hll_merge(hlls, 2);
-	if (!new_hll) {
-		throw InternalException("Could not merge HLLs");
-	}
-	return unique_ptr<HyperLogLog>(new HyperLogLog((void *)new_hll));
+	auto result = Copy();
+	result->MergeInPlace(other);
+	return result;
 }
 
 HyperLogLog *HyperLogLog::MergePointer(HyperLogLog &other) {
-	duckdb_hll::robj *hlls[2];
-	hlls[0] = (duckdb_hll::robj *)hll;
-	hlls[1] = (duckdb_hll::robj *)other.hll;
-	auto new_hll = duckdb_hll::hll_merge(hlls, 2);
-	if (!new_hll) {
-		throw Exception("Could not merge HLLs");
-	}
-	return new HyperLogLog((void *)new_hll);
+	return Merge(other).release();
 }
 
 unique_ptr<HyperLogLog> HyperLogLog::Merge(HyperLogLog logs[], idx_t count) {
-	auto hlls_uptr = unique_ptr<duckdb_hll::robj *[]> {
-		new duckdb_hll::robj *[count]
+	auto hlls_uptr = unique_ptr<void *[]> {
+		new void *[count]
 	};
 	auto hlls = hlls_uptr.get();
 	for (idx_t i = 0; i < count; i++) {
-		hlls[i] = (duckdb_hll::robj *)logs[i].hll;
-	}
-	auto new_hll = duckdb_hll::hll_merge(hlls, count);
-	if (!new_hll) {
-		throw InternalException("Could not merge HLLs");
+		hlls[i] = logs[i].hll;
 	}
-	return unique_ptr<HyperLogLog>(new HyperLogLog((void *)new_hll));
+	auto result = make_uniq<HyperLogLog>();
+	MergeDenseInternal(result->hll, hlls, count);
+	return result;
+}
+
+void HyperLogLog::MergeInPlace(HyperLogLog &other) {
+	lock_guard<mutex> guard(lock);
+	void *sources[] = {other.hll};
+	MergeDenseInternal(hll, sources, 1);
 }
 
 idx_t HyperLogLog::GetSize() {
@@ -195,6 +187,12 @@ inline uint64_t TemplatedHash(const string_t &elem) {
 template <class T>
 void TemplatedComputeHashes(UnifiedVectorFormat &vdata, const idx_t &count, uint64_t hashes[]) {
 	T *data = (T *)vdata.data;
+	if (vdata.validity.AllValid()) {
+		for (idx_t i = 0; i < count; i++) {
+			hashes[i] = TemplatedHash<T>(data[vdata.sel->get_index(i)]);
+		}
+		return;
+	}
 	for (idx_t i = 0; i < count; i++) {
 		auto idx = vdata.sel->get_index(i);
 		if (vdata.validity.RowIsValid(idx)) {
@@ -270,4 +268,19 @@ void HyperLogLog::AddToLog(UnifiedVectorFormat &vdata, idx_t count, uint64_t ind
 	AddToSingleLogInternal(vdata, count, indices, counts, hll);
 }
 
+void HyperLogLog::Update(Vector &input, idx_t count) {
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	Update(vdata, input.GetType(), count);
+}
+
+void HyperLogLog::Update(UnifiedVectorFormat &vdata, const LogicalType &type, idx_t count) {
+	D_ASSERT(count <= STANDARD_VECTOR_SIZE);
+	uint64_t indices[STANDARD_VECTOR_SIZE];
+	uint8_t counts[STANDARD_VECTOR_SIZE];
+
+	ProcessEntries(vdata, type, indices, counts, count);
+	AddToLog(vdata, count, indices, counts);
+}
+
 } // namespace duckdb
@@ -145,7 +145,8 @@ void RowDataCollectionScanner::ScanState::PinData() {
 RowDataCollectionScanner::RowDataCollectionScanner(RowDataCollection &rows_p, RowDataCollection &heap_p,
                                                    const RowLayout &layout_p, bool external_p, bool flush_p)
     : rows(rows_p), heap(heap_p), layout(layout_p), read_state(*this), total_count(rows.count), total_scanned(0),
-      external(external_p), flush(flush_p), unswizzling(!layout.AllConstant() && external && !heap.keep_pinned) {
+      block_begin(0), scan_begin(0), external(external_p), flush(flush_p),
+      unswizzling(!layout.AllConstant() && external && !heap.keep_pinned) {
 
 	if (unswizzling) {
 		D_ASSERT(rows.blocks.size() == heap.blocks.size());
@@ -154,6 +155,27 @@ RowDataCollectionScanner::RowDataCollectionScanner(RowDataCollection &rows_p, Ro
 	ValidateUnscannedBlock();
 }
 
+RowDataCollectionScanner::RowDataCollectionScanner(RowDataCollection &rows_p, RowDataCollection &heap_p,
+                                                   const RowLayout &layout_p, bool external_p, idx_t block_idx,
+                                                   idx_t block_start, bool flush_p)
+    : rows(rows_p), heap(heap_p), layout(layout_p), read_state(*this),
+      total_count(block_start + rows_p.blocks[block_idx]->count), total_scanned(0), block_begin(block_idx),
+      scan_begin(block_start), external(external_p), flush(flush_p),
+      unswizzling(!layout.AllConstant() && external && !heap.keep_pinned) {
+
+	if (unswizzling) {
+		D_ASSERT(rows.blocks.size() == heap.blocks.size());
+	}
+
+	//	Pretend that we have already scanned up to the start of the block,
+	//	so positions are relative to the whole collection.
+	D_ASSERT(block_idx < rows.blocks.size());
+	read_state.block_idx = block_begin;
+	total_scanned = scan_begin;
+
+	ValidateUnscannedBlock();
+}
+
 void RowDataCollectionScanner::SwizzleBlock(RowDataBlock &data_block, RowDataBlock &heap_block) {
 	// Pin the data block and swizzle the pointers within the rows
 	D_ASSERT(!data_block.block->IsSwizzled());
@@ -235,7 +257,10 @@ void RowDataCollectionScanner::Scan(DataChunk &chunk) {
 			}
 			read_state.block_idx++;
 			read_state.entry_idx = 0;
-			ValidateUnscannedBlock();
+			//	The next block may belong to another scanner
+			if (scanned + next < count) {
+				ValidateUnscannedBlock();
+			}
 		}
 		scanned += next;
 	}
@@ -254,7 +279,7 @@ void RowDataCollectionScanner::Scan(DataChunk &chunk) {
 
 	if (flush) {
 		// Release blocks we have passed.
-		for (idx_t i = 0; i < read_state.block_idx; ++i) {
+		for (idx_t i = block_begin; i < read_state.block_idx; ++i) {
 			rows.blocks[i]->block = nullptr;
 			if (unswizzling) {
 				heap.blocks[i]->block = nullptr;
@@ -262,7 +287,7 @@ void RowDataCollectionScanner::Scan(DataChunk &chunk) {
 		}
 	} else if (unswizzling) {
 		// Reswizzle blocks we have passed so they can be flushed safely.
-		for (idx_t i = 0; i < read_state.block_idx; ++i) {
+		for (idx_t i = block_begin; i < read_state.block_idx; ++i) {
 			auto &data_block = rows.blocks[i];
 			if (data_block->block && !data_block->block->IsSwizzled()) {
 				SwizzleBlock(*data_block, *heap.blocks[i]);
@@ -273,9 +298,9 @@ void RowDataCollectionScanner::Scan(DataChunk &chunk) {
 
 void RowDataCollectionScanner::Reset(bool flush_p) {
 	flush = flush_p;
-	total_scanned = 0;
+	total_scanned = scan_begin;
 
-	read_state.block_idx = 0;
+	read_state.block_idx = block_begin;
 	read_state.entry_idx = 0;
 }
 
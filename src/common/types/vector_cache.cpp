@@ -80,6 +80,10 @@ public:
 		}
 	}
 
+	bool OwnsData(const Vector &vector) {
+		return vector.buffer.get() == this && vector.data == owned_data.get();
+	}
+
 	const LogicalType &GetType() {
 		return type;
 	}
@@ -107,6 +111,12 @@ void VectorCache::ResetFromCache(Vector &result) const {
 	vcache.ResetFromCache(result, buffer);
 }
 
+bool VectorCache::OwnsData(const Vector &vector) const {
+	D_ASSERT(buffer);
+	auto &vcache = (VectorCacheBuffer &)*buffer;
+	return vcache.OwnsData(vector);
+}
+
 const LogicalType &VectorCache::GetType() const {
 	auto &vcache = (VectorCacheBuffer &)*buffer;
 	return vcache.GetType();
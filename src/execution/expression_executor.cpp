@@ -57,7 +57,13 @@ Allocator &ExpressionExecutor::GetAllocator() {
 void ExpressionExecutor::AddExpression(const Expression &expr) {
 	expressions.push_back(&expr);
 	auto state = make_uniq<ExpressionExecutorState>();
+	if (context && ClientConfig::GetConfig(*context).enable_hardware_counters) {
+		state->profiler.count_hardware_events = true;
+	}
 	Initialize(expr, *state);
+	if (context && ClientConfig::GetConfig(*context).enable_expression_fusion) {
+		state->fused_expression = FusedExpression::TryCompile(expr);
+	}
 	state->Verify();
 	states.push_back(std::move(state));
 }
@@ -88,7 +94,11 @@ idx_t ExpressionExecutor::SelectExpression(DataChunk &input, SelectionVector &se
 	D_ASSERT(expressions.size() == 1);
 	SetChunk(&input);
 	states[0]->profiler.BeginSample();
-	idx_t selected_tuples = Select(*expressions[0], states[0]->root_state.get(), nullptr, input.size(), &sel, nullptr);
+	idx_t selected_tuples;
+	auto &fused_expression = states[0]->fused_expression;
+	if (!fused_expression || !fused_expression->Select(input, sel, selected_tuples)) {
+		selected_tuples = Select(*expressions[0], states[0]->root_state.get(), nullptr, input.size(), &sel, nullptr);
+	}
 	states[0]->profiler.EndSample(chunk ? chunk->size() : 0);
 	return selected_tuples;
 }
@@ -102,7 +112,12 @@ void ExpressionExecutor::ExecuteExpression(idx_t expr_idx, Vector &result) {
 	D_ASSERT(expr_idx < expressions.size());
 	D_ASSERT(result.GetType().id() == expressions[expr_idx]->return_type.id());
 	states[expr_idx]->profiler.BeginSample();
-	Execute(*expressions[expr_idx], states[expr_idx]->root_state.get(), nullptr, chunk ? chunk->size() : 1, result);
+	auto &fused_expression = states[expr_idx]->fused_expression;
+	if (chunk && fused_expression && fused_expression->Execute(*chunk, result)) {
+		Verify(*expressions[expr_idx], result, chunk->size());
+	} else {
+		Execute(*expressions[expr_idx], states[expr_idx]->root_state.get(), nullptr, chunk ? chunk->size() : 1, result);
+	}
 	states[expr_idx]->profiler.EndSample(chunk ? chunk->size() : 0);
 }
 
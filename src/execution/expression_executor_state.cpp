@@ -32,6 +32,7 @@ ClientContext &ExpressionState::GetContext() {
 }
 
 ExpressionState::ExpressionState(const Expression &expr, ExpressionExecutorState &root) : expr(expr), root(root) {
+	profiler.count_hardware_events = root.profiler.count_hardware_events;
 }
 
 ExpressionExecutorState::ExpressionExecutorState() : profiler() {
@@ -0,0 +1,436 @@
+#include "duckdb/execution/fused_expression.hpp"
+
+#include "duckdb/common/operator/add.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/operator/multiply.hpp"
+#include "duckdb/common/operator/subtract.hpp"
+#include "duckdb/planner/expression/list.hpp"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Kernels
+//===--------------------------------------------------------------------===//
+struct FusedAdd {
+	template <class T>
+	static inline bool Operation(T left, T right, T &result) {
+		return TryAddOperator::Operation(left, right, result);
+	}
+};
+
+struct FusedSubtract {
+	template <class T>
+	static inline bool Operation(T left, T right, T &result) {
+		return TrySubtractOperator::Operation(left, right, result);
+	}
+};
+
+struct FusedMultiply {
+	template <class T>
+	static inline bool Operation(T left, T right, T &result) {
+		return TryMultiplyOperator::Operation(left, right, result);
+	}
+};
+
+// floating point arithmetic cannot overflow: use the plain operators so the loops can be vectorized
+#define FUSED_FLOATING_POINT_OPERATION(NAME, OPERATOR)                                                                 \
+	template <>                                                                                                        \
+	inline bool NAME::Operation(float left, float right, float &result) {                                              \
+		result = left OPERATOR right;                                                                                  \
+		return true;                                                                                                   \
+	}                                                                                                                  \
+	template <>                                                                                                        \
+	inline bool NAME::Operation(double left, double right, double &result) {                                           \
+		result = left OPERATOR right;                                                                                  \
+		return true;                                                                                                   \
+	}
+
+FUSED_FLOATING_POINT_OPERATION(FusedAdd, +)
+FUSED_FLOATING_POINT_OPERATION(FusedSubtract, -)
+FUSED_FLOATING_POINT_OPERATION(FusedMultiply, *)
+
+struct FusedAnd {
+	template <class T>
+	static inline bool Operation(T left, T right) {
+		return left && right;
+	}
+};
+
+struct FusedOr {
+	template <class T>
+	static inline bool Operation(T left, T right) {
+		return left || right;
+	}
+};
+
+template <class T, class OP, bool LEFT_CONSTANT, bool RIGHT_CONSTANT>
+struct FusedArithmeticKernel {
+	static bool Run(const_data_ptr_t left_p, const_data_ptr_t right_p, data_ptr_t result_p, idx_t count) {
+		auto left = (const T *)left_p;
+		auto right = (const T *)right_p;
+		auto result = (T *)result_p;
+		bool success = true;
+		for (idx_t i = 0; i < count; i++) {
+			auto lentry = left[LEFT_CONSTANT ? 0 : i];
+			auto rentry = right[RIGHT_CONSTANT ? 0 : i];
+			success &= OP::template Operation<T>(lentry, rentry, result[i]);
+		}
+		return success;
+	}
+};
+
+template <class T, class OP, bool LEFT_CONSTANT, bool RIGHT_CONSTANT>
+struct FusedPredicateKernel {
+	static bool Run(const_data_ptr_t left_p, const_data_ptr_t right_p, data_ptr_t result_p, idx_t count) {
+		auto left = (const T *)left_p;
+		auto right = (const T *)right_p;
+		auto result = (bool *)result_p;
+		for (idx_t i = 0; i < count; i++) {
+			result[i] = OP::template Operation<T>(left[LEFT_CONSTANT ? 0 : i], right[RIGHT_CONSTANT ? 0 : i]);
+		}
+		return true;
+	}
+};
+
+template <template <class, class, bool, bool> class KERNEL, class T, class OP>
+static fused_kernel_t SelectConstantKernel(bool left_constant, bool right_constant) {
+	if (left_constant) {
+		return right_constant ? KERNEL<T, OP, true, true>::Run : KERNEL<T, OP, true, false>::Run;
+	} else {
+		return right_constant ? KERNEL<T, OP, false, true>::Run : KERNEL<T, OP, false, false>::Run;
+	}
+}
+
+template <template <class, class, bool, bool> class KERNEL, class OP>
+static fused_kernel_t SelectNumericKernel(PhysicalType type, bool left_constant, bool right_constant) {
+	switch (type) {
+	case PhysicalType::INT32:
+		return SelectConstantKernel<KERNEL, int32_t, OP>(left_constant, right_constant);
+	case PhysicalType::INT64:
+		return SelectConstantKernel<KERNEL, int64_t, OP>(left_constant, right_constant);
+	case PhysicalType::FLOAT:
+		return SelectConstantKernel<KERNEL, float, OP>(left_constant, right_constant);
+	case PhysicalType::DOUBLE:
+		return SelectConstantKernel<KERNEL, double, OP>(left_constant, right_constant);
+	default:
+		return nullptr;
+	}
+}
+
+template <class OP>
+static fused_kernel_t SelectArithmeticKernel(PhysicalType type, bool left_constant, bool right_constant) {
+	return SelectNumericKernel<FusedArithmeticKernel, OP>(type, left_constant, right_constant);
+}
+
+template <class OP>
+static fused_kernel_t SelectComparisonKernel(PhysicalType type, bool left_constant, bool right_constant) {
+	return SelectNumericKernel<FusedPredicateKernel, OP>(type, left_constant, right_constant);
+}
+
+template <class OP>
+static fused_kernel_t SelectConjunctionKernel(PhysicalType type, bool left_constant, bool right_constant) {
+	if (type != PhysicalType::BOOL) {
+		return nullptr;
+	}
+	return SelectConstantKernel<FusedPredicateKernel, bool, OP>(left_constant, right_constant);
+}
+
+//===--------------------------------------------------------------------===//
+// Compilation
+//===--------------------------------------------------------------------===//
+static bool IsFusableType(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::BOOLEAN:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool IsFusableNumericType(const LogicalType &type) {
+	return type.id() != LogicalTypeId::BOOLEAN && IsFusableType(type);
+}
+
+unique_ptr<FusedExpression> FusedExpression::TryCompile(const Expression &expr) {
+	auto result = unique_ptr<FusedExpression>(new FusedExpression());
+	FusedOperand root;
+	if (!result->CompileExpression(expr, root)) {
+		return nullptr;
+	}
+	if (result->program.size() < 2) {
+		// a single operation is executed just as efficiently by the interpreter
+		return nullptr;
+	}
+	D_ASSERT(root.type == FusedOperandType::REGISTER);
+	result->result_type = expr.return_type.InternalType();
+	result->registers = unique_ptr<data_t[]>(new data_t[result->register_count * BLOCK_SIZE * sizeof(int64_t)]);
+	return result;
+}
+
+FusedOperand FusedExpression::AddRegister(idx_t width) {
+	FusedOperand result;
+	result.type = FusedOperandType::REGISTER;
+	result.index = register_count++;
+	result.width = width;
+	return result;
+}
+
+bool FusedExpression::AddInstruction(const FusedOperand &left, const FusedOperand &right, PhysicalType input_type,
+                                     fused_kernel_selector_t selector, PhysicalType result_type,
+                                     FusedOperand &result) {
+	FusedInstruction instruction;
+	instruction.kernel = selector(input_type, left.type == FusedOperandType::CONSTANT,
+	                              right.type == FusedOperandType::CONSTANT);
+	if (!instruction.kernel) {
+		return false;
+	}
+	instruction.left = left;
+	instruction.right = right;
+	instruction.result = AddRegister(GetTypeIdSize(result_type));
+	program.push_back(instruction);
+	result = instruction.result;
+	return true;
+}
+
+bool FusedExpression::CompileBinary(const Expression &left, const Expression &right, fused_kernel_selector_t selector,
+                                    PhysicalType result_type, FusedOperand &result) {
+	if (left.return_type.id() != right.return_type.id()) {
+		return false;
+	}
+	FusedOperand left_operand;
+	FusedOperand right_operand;
+	if (!CompileExpression(left, left_operand) || !CompileExpression(right, right_operand)) {
+		return false;
+	}
+	return AddInstruction(left_operand, right_operand, left.return_type.InternalType(), selector, result_type, result);
+}
+
+bool FusedExpression::CompileExpression(const Expression &expr, FusedOperand &result) {
+	if (!IsFusableType(expr.return_type)) {
+		return false;
+	}
+	auto type = expr.return_type.InternalType();
+	switch (expr.expression_class) {
+	case ExpressionClass::BOUND_REF: {
+		auto &ref = expr.Cast<BoundReferenceExpression>();
+		result.type = FusedOperandType::COLUMN;
+		result.width = GetTypeIdSize(type);
+		for (idx_t i = 0; i < column_indexes.size(); i++) {
+			if (column_indexes[i] == ref.index) {
+				result.index = i;
+				return true;
+			}
+		}
+		result.index = column_indexes.size();
+		column_indexes.push_back(ref.index);
+		column_types.push_back(type);
+		return true;
+	}
+	case ExpressionClass::BOUND_CONSTANT: {
+		auto &constant = expr.Cast<BoundConstantExpression>();
+		if (constant.value.IsNull()) {
+			return false;
+		}
+		int64_t data = 0;
+		switch (type) {
+		case PhysicalType::BOOL:
+			Store<bool>(constant.value.GetValue<bool>(), (data_ptr_t)&data);
+			break;
+		case PhysicalType::INT32:
+			Store<int32_t>(constant.value.GetValue<int32_t>(), (data_ptr_t)&data);
+			break;
+		case PhysicalType::INT64:
+			Store<int64_t>(constant.value.GetValue<int64_t>(), (data_ptr_t)&data);
+			break;
+		case PhysicalType::FLOAT:
+			Store<float>(constant.value.GetValue<float>(), (data_ptr_t)&data);
+			break;
+		case PhysicalType::DOUBLE:
+			Store<double>(constant.value.GetValue<double>(), (data_ptr_t)&data);
+			break;
+		default:
+			return false;
+		}
+		result.type = FusedOperandType::CONSTANT;
+		result.index = constants.size();
+		result.width = GetTypeIdSize(type);
+		constants.push_back(data);
+		return true;
+	}
+	case ExpressionClass::BOUND_FUNCTION: {
+		auto &function = expr.Cast<BoundFunctionExpression>();
+		if (function.children.size() != 2 || !IsFusableNumericType(expr.return_type) ||
+		    function.children[0]->return_type.id() != expr.return_type.id()) {
+			return false;
+		}
+		auto &name = function.function.name;
+		fused_kernel_selector_t selector;
+		if (name == "+") {
+			selector = SelectArithmeticKernel<FusedAdd>;
+		} else if (name == "-") {
+			selector = SelectArithmeticKernel<FusedSubtract>;
+		} else if (name == "*") {
+			selector = SelectArithmeticKernel<FusedMultiply>;
+		} else {
+			return false;
+		}
+		return CompileBinary(*function.children[0], *function.children[1], selector, type, result);
+	}
+	case ExpressionClass::BOUND_COMPARISON: {
+		auto &comparison = expr.Cast<BoundComparisonExpression>();
+		if (!IsFusableNumericType(comparison.left->return_type)) {
+			return false;
+		}
+		fused_kernel_selector_t selector;
+		switch (expr.type) {
+		case ExpressionType::COMPARE_EQUAL:
+			selector = SelectComparisonKernel<Equals>;
+			break;
+		case ExpressionType::COMPARE_NOTEQUAL:
+			selector = SelectComparisonKernel<NotEquals>;
+			break;
+		case ExpressionType::COMPARE_LESSTHAN:
+			selector = SelectComparisonKernel<LessThan>;
+			break;
+		case ExpressionType::COMPARE_GREATERTHAN:
+			selector = SelectComparisonKernel<GreaterThan>;
+			break;
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			selector = SelectComparisonKernel<LessThanEquals>;
+			break;
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			selector = SelectComparisonKernel<GreaterThanEquals>;
+			break;
+		default:
+			return false;
+		}
+		return CompileBinary(*comparison.left, *comparison.right, selector, PhysicalType::BOOL, result);
+	}
+	case ExpressionClass::BOUND_CONJUNCTION: {
+		auto &conjunction = expr.Cast<BoundConjunctionExpression>();
+		fused_kernel_selector_t selector;
+		if (expr.type == ExpressionType::CONJUNCTION_AND) {
+			selector = SelectConjunctionKernel<FusedAnd>;
+		} else if (expr.type == ExpressionType::CONJUNCTION_OR) {
+			selector = SelectConjunctionKernel<FusedOr>;
+		} else {
+			return false;
+		}
+		if (conjunction.children.size() < 2) {
+			return false;
+		}
+		if (!CompileBinary(*conjunction.children[0], *conjunction.children[1], selector, PhysicalType::BOOL, result)) {
+			return false;
+		}
+		for (idx_t i = 2; i < conjunction.children.size(); i++) {
+			FusedOperand child;
+			if (!CompileExpression(*conjunction.children[i], child)) {
+				return false;
+			}
+			if (!AddInstruction(result, child, PhysicalType::BOOL, selector, PhysicalType::BOOL, result)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Execution
+//===--------------------------------------------------------------------===//
+bool FusedExpression::PrepareInput(DataChunk &input) {
+	column_data.resize(column_indexes.size());
+	for (idx_t i = 0; i < column_indexes.size(); i++) {
+		if (column_indexes[i] >= input.ColumnCount()) {
+			return false;
+		}
+		auto &vector = input.data[column_indexes[i]];
+		if (vector.GetVectorType() != VectorType::FLAT_VECTOR || vector.GetType().InternalType() != column_types[i]) {
+			return false;
+		}
+		if (!FlatVector::Validity(vector).CheckAllValid(input.size())) {
+			return false;
+		}
+		column_data[i] = FlatVector::GetData(vector);
+	}
+	return true;
+}
+
+const_data_ptr_t FusedExpression::GetOperandData(const FusedOperand &operand, idx_t offset) {
+	switch (operand.type) {
+	case FusedOperandType::COLUMN:
+		return column_data[operand.index] + offset * operand.width;
+	case FusedOperandType::CONSTANT:
+		return (const_data_ptr_t)&constants[operand.index];
+	case FusedOperandType::REGISTER:
+		return registers.get() + operand.index * BLOCK_SIZE * sizeof(int64_t);
+	default:
+		throw InternalException("Unrecognized fused operand type");
+	}
+}
+
+bool FusedExpression::RunBlock(idx_t offset, idx_t count, data_ptr_t target) {
+	for (idx_t i = 0; i < program.size(); i++) {
+		auto &instruction = program[i];
+		auto left = GetOperandData(instruction.left, offset);
+		auto right = GetOperandData(instruction.right, offset);
+		data_ptr_t result;
+		if (target && i + 1 == program.size()) {
+			// the last instruction writes straight into the result vector
+			result = target + offset * instruction.result.width;
+		} else {
+			result = registers.get() + instruction.result.index * BLOCK_SIZE * sizeof(int64_t);
+		}
+		if (!instruction.kernel(left, right, result, count)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FusedExpression::Execute(DataChunk &input, Vector &result) {
+	if (result.GetVectorType() != VectorType::FLAT_VECTOR || result.GetType().InternalType() != result_type) {
+		return false;
+	}
+	if (!PrepareInput(input)) {
+		return false;
+	}
+	auto target = FlatVector::GetData(result);
+	auto count = input.size();
+	for (idx_t offset = 0; offset < count; offset += BLOCK_SIZE) {
+		if (!RunBlock(offset, MinValue<idx_t>(BLOCK_SIZE, count - offset), target)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FusedExpression::Select(DataChunk &input, SelectionVector &true_sel, idx_t &true_count) {
+	if (result_type != PhysicalType::BOOL || !PrepareInput(input)) {
+		return false;
+	}
+	auto &root = program.back().result;
+	auto matches = (const bool *)(registers.get() + root.index * BLOCK_SIZE * sizeof(int64_t));
+	auto count = input.size();
+	true_count = 0;
+	for (idx_t offset = 0; offset < count; offset += BLOCK_SIZE) {
+		auto block_count = MinValue<idx_t>(BLOCK_SIZE, count - offset);
+		if (!RunBlock(offset, block_count, nullptr)) {
+			return false;
+		}
+		for (idx_t i = 0; i < block_count; i++) {
+			true_sel.set_index(true_count, offset + i);
+			true_count += matches[i];
+		}
+	}
+	return true;
+}
+
+} // namespace duckdb
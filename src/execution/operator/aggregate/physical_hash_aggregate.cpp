@@ -549,29 +549,36 @@ public:
 			aggregate_input_chunk.Initialize(context, gstate.payload_types);
 		}
 
-		idx_t payload_idx;
-		idx_t next_payload_idx = 0;
-
+		// the offset of the children of every aggregate in the payload
+		vector<idx_t> payload_offsets;
+		idx_t payload_idx = 0;
 		for (idx_t i = 0; i < op.grouped_aggregate_data.aggregates.size(); i++) {
 			auto &aggregate = aggregates[i]->Cast<BoundAggregateExpression>();
+			payload_offsets.push_back(payload_idx);
+			payload_idx += aggregate.children.size();
+		}
 
-			// Forward the payload idx
-			payload_idx = next_payload_idx;
-			next_payload_idx = payload_idx + aggregate.children.size();
-
-			// If aggregate is not distinct, skip it
-			if (!data.IsDistinct(i)) {
+		// scan every table once, and sink its data for all the aggregates that share the table
+		for (idx_t table_idx = 0; table_idx < data.radix_tables.size(); table_idx++) {
+			auto &radix_table_p = data.radix_tables[table_idx];
+			if (!radix_table_p) {
+				continue;
+			}
+			vector<idx_t> table_aggregates;
+			for (idx_t i = 0; i < op.grouped_aggregate_data.aggregates.size(); i++) {
+				if (data.IsDistinct(i) && data.info.table_map.at(i) == table_idx) {
+					table_aggregates.push_back(i);
+				}
+			}
+			if (table_aggregates.empty()) {
 				continue;
 			}
-			D_ASSERT(data.info.table_map.count(i));
-			auto table_idx = data.info.table_map.at(i);
-			auto &radix_table_p = data.radix_tables[table_idx];
 
 			// Create a duplicate of the output_chunk, because of multi-threading we cant alter the original
 			DataChunk output_chunk;
 			output_chunk.Initialize(context, state.distinct_output_chunks[table_idx]->GetTypes());
 
-			auto &global_source = global_sources[grouping_idx][i];
+			auto &global_source = global_sources[grouping_idx][table_idx];
 			auto local_source = radix_table_p->GetLocalSourceState(temp_exec_context);
 
 			// Fetch all the data from the aggregate ht, and Sink it into the main ht
@@ -595,16 +602,18 @@ public:
 				}
 				group_chunk.SetCardinality(output_chunk);
 
-				for (idx_t child_idx = 0; child_idx < grouped_aggregate_data.groups.size() - group_by_size;
-				     child_idx++) {
-					aggregate_input_chunk.data[payload_idx + child_idx].Reference(
-					    output_chunk.data[group_by_size + child_idx]);
+				for (auto i : table_aggregates) {
+					for (idx_t child_idx = 0; child_idx < grouped_aggregate_data.groups.size() - group_by_size;
+					     child_idx++) {
+						aggregate_input_chunk.data[payload_offsets[i] + child_idx].Reference(
+						    output_chunk.data[group_by_size + child_idx]);
+					}
 				}
 				aggregate_input_chunk.SetCardinality(output_chunk);
 
 				// Sink it into the main ht
 				grouping_data.table_data.Sink(temp_exec_context, table_state, *temp_local_state, group_chunk,
-				                              aggregate_input_chunk, {i});
+				                              aggregate_input_chunk, table_aggregates);
 			}
 		}
 		grouping_data.table_data.Combine(temp_exec_context, table_state, *temp_local_state);
@@ -633,7 +642,6 @@ private:
 
 //! DISTINCT FINALIZE EVENT
 
-// TODO: Create tasks and run these in parallel instead of doing this all in Schedule, single threaded
 class HashDistinctAggregateFinalizeEvent : public BasePipelineEvent {
 public:
 	HashDistinctAggregateFinalizeEvent(const PhysicalHashAggregate &op_p, HashAggregateGlobalState &gstate_p,
@@ -643,7 +651,7 @@ public:
 	const PhysicalHashAggregate &op;
 	HashAggregateGlobalState &gstate;
 	ClientContext &context;
-	//! The GlobalSourceStates for all the radix tables of the distinct aggregates
+	//! The GlobalSourceStates for all the radix tables of the distinct aggregates (per grouping, per table)
 	vector<vector<unique_ptr<GlobalSourceState>>> global_sources;
 
 public:
@@ -676,24 +684,12 @@ private:
 			auto &grouping = op.groupings[grouping_idx];
 			auto &data = *grouping.distinct_data;
 
-			vector<unique_ptr<GlobalSourceState>> aggregate_sources;
-			aggregate_sources.reserve(op.grouped_aggregate_data.aggregates.size());
-
-			for (idx_t i = 0; i < op.grouped_aggregate_data.aggregates.size(); i++) {
-				auto &aggregate = op.grouped_aggregate_data.aggregates[i];
-				auto &aggr = aggregate->Cast<BoundAggregateExpression>();
-
-				if (!aggr.IsDistinct()) {
-					aggregate_sources.push_back(nullptr);
-					continue;
-				}
-
-				D_ASSERT(data.info.table_map.count(i));
-				auto table_idx = data.info.table_map.at(i);
-				auto &radix_table_p = data.radix_tables[table_idx];
-				aggregate_sources.push_back(radix_table_p->GetGlobalSourceState(context));
+			vector<unique_ptr<GlobalSourceState>> table_sources;
+			table_sources.reserve(data.radix_tables.size());
+			for (auto &radix_table_p : data.radix_tables) {
+				table_sources.push_back(radix_table_p ? radix_table_p->GetGlobalSourceState(context) : nullptr);
 			}
-			grouping_sources.push_back(std::move(aggregate_sources));
+			grouping_sources.push_back(std::move(table_sources));
 		}
 		return grouping_sources;
 	}
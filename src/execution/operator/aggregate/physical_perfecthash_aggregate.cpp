@@ -1,6 +1,8 @@
 #include "duckdb/execution/operator/aggregate/physical_perfecthash_aggregate.hpp"
 
+#include "duckdb/execution/aggregate_hashtable.hpp"
 #include "duckdb/execution/perfect_aggregate_hashtable.hpp"
+#include "duckdb/parallel/base_pipeline_event.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
@@ -15,16 +17,22 @@ PhysicalPerfectHashAggregate::PhysicalPerfectHashAggregate(ClientContext &contex
     : PhysicalOperator(PhysicalOperatorType::PERFECT_HASH_GROUP_BY, std::move(types_p), estimated_cardinality),
       groups(std::move(groups_p)), aggregates(std::move(aggregates_p)), required_bits(std::move(required_bits_p)) {
 	D_ASSERT(groups.size() == group_stats.size());
+	for (auto &expr : groups) {
+		group_types.push_back(expr->return_type);
+	}
 	group_minima.reserve(group_stats.size());
-	for (auto &stats : group_stats) {
+	for (idx_t group_idx = 0; group_idx < group_stats.size(); group_idx++) {
+		if (group_types[group_idx].InternalType() == PhysicalType::VARCHAR) {
+			// string groups are encoded with a dictionary
+			group_minima.emplace_back(group_types[group_idx]);
+			continue;
+		}
+		auto &stats = group_stats[group_idx];
 		D_ASSERT(stats);
 		auto &nstats = *stats;
 		D_ASSERT(NumericStats::HasMin(nstats));
 		group_minima.push_back(NumericStats::Min(nstats));
 	}
-	for (auto &expr : groups) {
-		group_types.push_back(expr->return_type);
-	}
 
 	vector<BoundAggregateExpression *> bindings;
 	vector<LogicalType> payload_types_filters;
@@ -67,12 +75,27 @@ PhysicalPerfectHashAggregate::PhysicalPerfectHashAggregate(ClientContext &contex
 			}
 		}
 	}
+
+	// the radix partitioned hash table that aggregates the input once a dictionary has overflowed
+	vector<unique_ptr<Expression>> fallback_groups;
+	for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+		fallback_groups.push_back(groups[group_idx]->Copy());
+		grouping_set.insert(group_idx);
+	}
+	vector<unique_ptr<Expression>> fallback_aggregates;
+	for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+		fallback_aggregates.push_back(aggregates[aggr_idx]->Copy());
+		fallback_filter.push_back(aggr_idx);
+	}
+	grouped_aggregate_data.InitializeGroupby(std::move(fallback_groups), std::move(fallback_aggregates), {});
+	fallback_table = make_uniq<RadixPartitionedHashTable>(grouping_set, grouped_aggregate_data);
 }
 
-unique_ptr<PerfectAggregateHashTable> PhysicalPerfectHashAggregate::CreateHT(Allocator &allocator,
-                                                                             ClientContext &context) const {
+unique_ptr<PerfectAggregateHashTable>
+PhysicalPerfectHashAggregate::CreateHT(Allocator &allocator, ClientContext &context,
+                                       const vector<shared_ptr<PerfectHashGroupDictionary>> &dictionaries) const {
 	return make_uniq<PerfectAggregateHashTable>(context, allocator, group_types, payload_types, aggregate_objects,
-	                                            group_minima, required_bits);
+	                                            group_minima, required_bits, dictionaries);
 }
 
 //===--------------------------------------------------------------------===//
@@ -81,27 +104,46 @@ unique_ptr<PerfectAggregateHashTable> PhysicalPerfectHashAggregate::CreateHT(All
 class PerfectHashAggregateGlobalState : public GlobalSinkState {
 public:
 	PerfectHashAggregateGlobalState(const PhysicalPerfectHashAggregate &op, ClientContext &context)
-	    : ht(op.CreateHT(Allocator::Get(context), context)) {
+	    : overflowed(false) {
+		for (idx_t group_idx = 0; group_idx < op.group_types.size(); group_idx++) {
+			if (op.group_types[group_idx].InternalType() != PhysicalType::VARCHAR) {
+				dictionaries.push_back(nullptr);
+				continue;
+			}
+			// code 0 is reserved for NULL
+			auto capacity = ((idx_t)1 << op.required_bits[group_idx]) - 1;
+			dictionaries.push_back(make_shared<PerfectHashGroupDictionary>(capacity));
+		}
+		ht = op.CreateHT(Allocator::Get(context), context, dictionaries);
+		fallback_state = op.fallback_table->GetGlobalSinkState(context);
 	}
 
 	//! The lock for updating the global aggregate state
 	mutex lock;
+	//! The dictionaries of the string groups, shared by all hash tables
+	vector<shared_ptr<PerfectHashGroupDictionary>> dictionaries;
 	//! The global aggregate hash table
 	unique_ptr<PerfectAggregateHashTable> ht;
+	//! Whether or not a dictionary has overflowed: the input is then aggregated in the radix partitioned hash table
+	atomic<bool> overflowed;
+	//! The state of the radix partitioned hash table, that the perfect hash table is combined into at the end if a
+	//! dictionary overflowed
+	unique_ptr<GlobalSinkState> fallback_state;
 };
 
 class PerfectHashAggregateLocalState : public LocalSinkState {
 public:
-	PerfectHashAggregateLocalState(const PhysicalPerfectHashAggregate &op, ExecutionContext &context)
-	    : ht(op.CreateHT(Allocator::Get(context.client), context.client)) {
+	PerfectHashAggregateLocalState(const PhysicalPerfectHashAggregate &op, ExecutionContext &context) {
 		group_chunk.InitializeEmpty(op.group_types);
 		if (!op.payload_types.empty()) {
 			aggregate_input_chunk.InitializeEmpty(op.payload_types);
 		}
 	}
 
-	//! The local aggregate hash table
+	//! The local aggregate hash table (created on the first input, as it shares the dictionaries of the global state)
 	unique_ptr<PerfectAggregateHashTable> ht;
+	//! The local state of the radix partitioned hash table, used once a dictionary has overflowed
+	unique_ptr<LocalSinkState> fallback_state;
 	DataChunk group_chunk;
 	DataChunk aggregate_input_chunk;
 };
@@ -116,6 +158,7 @@ unique_ptr<LocalSinkState> PhysicalPerfectHashAggregate::GetLocalSinkState(Execu
 
 SinkResultType PhysicalPerfectHashAggregate::Sink(ExecutionContext &context, GlobalSinkState &state,
                                                   LocalSinkState &lstate_p, DataChunk &input) const {
+	auto &gstate = state.Cast<PerfectHashAggregateGlobalState>();
 	auto &lstate = lstate_p.Cast<PerfectHashAggregateLocalState>();
 	DataChunk &group_chunk = lstate.group_chunk;
 	DataChunk &aggregate_input_chunk = lstate.aggregate_input_chunk;
@@ -152,7 +195,21 @@ SinkResultType PhysicalPerfectHashAggregate::Sink(ExecutionContext &context, Glo
 	aggregate_input_chunk.Verify();
 	D_ASSERT(aggregate_input_chunk.ColumnCount() == 0 || group_chunk.size() == aggregate_input_chunk.size());
 
-	lstate.ht->AddChunk(group_chunk, aggregate_input_chunk);
+	if (!gstate.overflowed) {
+		if (!lstate.ht) {
+			lstate.ht = CreateHT(Allocator::Get(context.client), context.client, gstate.dictionaries);
+		}
+		if (lstate.ht->AddChunk(group_chunk, aggregate_input_chunk)) {
+			return SinkResultType::NEED_MORE_INPUT;
+		}
+		// a string group did not fit into its dictionary: switch all threads over to the radix partitioned hash table
+		gstate.overflowed = true;
+	}
+	if (!lstate.fallback_state) {
+		lstate.fallback_state = fallback_table->GetLocalSinkState(context);
+	}
+	fallback_table->Sink(context, *gstate.fallback_state, *lstate.fallback_state, input, aggregate_input_chunk,
+	                     fallback_filter);
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
@@ -164,8 +221,56 @@ void PhysicalPerfectHashAggregate::Combine(ExecutionContext &context, GlobalSink
 	auto &lstate = lstate_p.Cast<PerfectHashAggregateLocalState>();
 	auto &gstate = gstate_p.Cast<PerfectHashAggregateGlobalState>();
 
-	lock_guard<mutex> l(gstate.lock);
-	gstate.ht->Combine(*lstate.ht);
+	if (lstate.fallback_state) {
+		fallback_table->Combine(context, *gstate.fallback_state, *lstate.fallback_state);
+	}
+	if (lstate.ht) {
+		lock_guard<mutex> l(gstate.lock);
+		gstate.ht->Combine(*lstate.ht);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Finalize
+//===--------------------------------------------------------------------===//
+class PerfectHashAggregateMergeEvent : public BasePipelineEvent {
+public:
+	PerfectHashAggregateMergeEvent(const PhysicalPerfectHashAggregate &op_p,
+	                               PerfectHashAggregateGlobalState &gstate_p, Pipeline &pipeline_p)
+	    : BasePipelineEvent(pipeline_p), op(op_p), gstate(gstate_p) {
+	}
+
+	const PhysicalPerfectHashAggregate &op;
+	PerfectHashAggregateGlobalState &gstate;
+
+public:
+	void Schedule() override {
+		vector<unique_ptr<Task>> tasks;
+		op.fallback_table->ScheduleTasks(pipeline->executor, shared_from_this(), *gstate.fallback_state, tasks);
+		D_ASSERT(!tasks.empty());
+		SetTasks(std::move(tasks));
+	}
+};
+
+SinkFinalizeType PhysicalPerfectHashAggregate::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                        GlobalSinkState &gstate_p) const {
+	auto &gstate = gstate_p.Cast<PerfectHashAggregateGlobalState>();
+	if (!gstate.overflowed) {
+		return SinkFinalizeType::READY;
+	}
+	// move the groups that were aggregated before the overflow into the radix partitioned hash table
+	// the perfect HT has at most 2^perfect_ht_threshold groups, and is kept alive: the combined states can point into
+	// its arena
+	auto ht = make_uniq<GroupedAggregateHashTable>(context, Allocator::Get(context), group_types, payload_types,
+	                                               aggregate_objects);
+	gstate.ht->Combine(*ht);
+	fallback_table->CombineHashTable(context, *gstate.fallback_state, std::move(ht));
+	if (fallback_table->Finalize(context, *gstate.fallback_state)) {
+		// the partitions of the radix partitioned hash table are merged in parallel
+		auto new_event = make_shared<PerfectHashAggregateMergeEvent>(*this, gstate, pipeline);
+		event.InsertEvent(std::move(new_event));
+	}
+	return SinkFinalizeType::READY;
 }
 
 //===--------------------------------------------------------------------===//
@@ -173,22 +278,62 @@ void PhysicalPerfectHashAggregate::Combine(ExecutionContext &context, GlobalSink
 //===--------------------------------------------------------------------===//
 class PerfectHashAggregateState : public GlobalSourceState {
 public:
-	PerfectHashAggregateState() : ht_scan_position(0) {
+	PerfectHashAggregateState(const PhysicalPerfectHashAggregate &op, ClientContext &context)
+	    : op(op), ht_scan_position(0) {
+		auto &sink = op.sink_state->Cast<PerfectHashAggregateGlobalState>();
+		if (sink.overflowed) {
+			fallback_state = op.fallback_table->GetGlobalSourceState(context);
+		}
 	}
 
+	const PhysicalPerfectHashAggregate &op;
 	//! The current position to scan the HT for output tuples
 	idx_t ht_scan_position;
+	//! The scan state of the radix partitioned hash table, if a dictionary overflowed
+	unique_ptr<GlobalSourceState> fallback_state;
+
+public:
+	idx_t MaxThreads() override {
+		if (!fallback_state) {
+			// the perfect hash table is scanned by a single thread
+			return 1;
+		}
+		auto &sink = op.sink_state->Cast<PerfectHashAggregateGlobalState>();
+		return MaxValue<idx_t>(1, op.fallback_table->Size(*sink.fallback_state) / STANDARD_VECTOR_SIZE);
+	}
+};
+
+class PerfectHashAggregateLocalSourceState : public LocalSourceState {
+public:
+	//! The local scan state of the radix partitioned hash table, if a dictionary overflowed
+	unique_ptr<LocalSourceState> fallback_state;
 };
 
 unique_ptr<GlobalSourceState> PhysicalPerfectHashAggregate::GetGlobalSourceState(ClientContext &context) const {
-	return make_uniq<PerfectHashAggregateState>();
+	return make_uniq<PerfectHashAggregateState>(*this, context);
+}
+
+unique_ptr<LocalSourceState> PhysicalPerfectHashAggregate::GetLocalSourceState(ExecutionContext &context,
+                                                                               GlobalSourceState &gstate_p) const {
+	auto &gstate = gstate_p.Cast<PerfectHashAggregateState>();
+	auto result = make_uniq<PerfectHashAggregateLocalSourceState>();
+	if (gstate.fallback_state) {
+		result->fallback_state = fallback_table->GetLocalSourceState(context);
+	}
+	return std::move(result);
 }
 
 void PhysicalPerfectHashAggregate::GetData(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate_p,
-                                           LocalSourceState &lstate) const {
-	auto &state = (PerfectHashAggregateState &)gstate_p;
+                                           LocalSourceState &lstate_p) const {
+	auto &state = gstate_p.Cast<PerfectHashAggregateState>();
+	auto &lstate = lstate_p.Cast<PerfectHashAggregateLocalSourceState>();
 	auto &gstate = sink_state->Cast<PerfectHashAggregateGlobalState>();
 
+	if (state.fallback_state) {
+		fallback_table->GetData(context, chunk, *gstate.fallback_state, *state.fallback_state,
+		                        *lstate.fallback_state);
+		return;
+	}
 	gstate.ht->Scan(state.ht_scan_position, chunk);
 }
 
@@ -0,0 +1,602 @@
+#include "duckdb/execution/operator/aggregate/physical_sort_aggregate.hpp"
+
+#include "duckdb/common/row_operations/row_operations.hpp"
+#include "duckdb/common/sort/sort.hpp"
+#include "duckdb/common/sort/sorted_block.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/parallel/base_pipeline_event.hpp"
+#include "duckdb/parallel/event.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+PhysicalSortAggregate::PhysicalSortAggregate(ClientContext &context, vector<LogicalType> types,
+                                             vector<unique_ptr<Expression>> aggregates_p,
+                                             vector<unique_ptr<Expression>> groups_p, idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::SORT_GROUP_BY, std::move(types), estimated_cardinality),
+      groups(std::move(groups_p)), aggregates(std::move(aggregates_p)) {
+	D_ASSERT(!groups.empty());
+	for (auto &group : groups) {
+		D_ASSERT(group->type == ExpressionType::BOUND_REF);
+		orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST, group->Copy());
+	}
+	vector<BoundAggregateExpression *> bindings;
+	for (auto &aggregate : aggregates) {
+		bindings.push_back(&aggregate->Cast<BoundAggregateExpression>());
+	}
+	aggregate_objects = AggregateObject::CreateAggregateObjects(bindings);
+	layout.Initialize(aggregate_objects, true, false);
+
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	partition_count = MinValue<idx_t>(NextPowerOfTwo(scheduler.NumberOfThreads()), MAX_PARTITIONS);
+}
+
+bool PhysicalSortAggregate::CanSortAggregate(const vector<unique_ptr<Expression>> &aggregates) {
+	bool has_holistic = false;
+	for (auto &expr : aggregates) {
+		auto &aggr = expr->Cast<BoundAggregateExpression>();
+		if (aggr.IsDistinct()) {
+			return false;
+		}
+		for (auto &child : aggr.children) {
+			if (child->type != ExpressionType::BOUND_REF) {
+				return false;
+			}
+		}
+		// aggregates that keep (a variable amount of) memory outside of their state have a destructor
+		if (aggr.function.destructor) {
+			has_holistic = true;
+		}
+	}
+	return has_holistic;
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+class SortAggregateGlobalSinkState : public GlobalSinkState {
+public:
+	SortAggregateGlobalSinkState(ClientContext &context, const PhysicalSortAggregate &op)
+	    : next_partition(0), finished_partitions(0) {
+		auto &buffer_manager = BufferManager::GetBufferManager(context);
+		payload_layout.Initialize(op.children[0]->types);
+		for (idx_t partition_idx = 0; partition_idx < op.partition_count; partition_idx++) {
+			auto partition = make_uniq<GlobalSortState>(buffer_manager, op.orders, payload_layout);
+			partition->external = ClientConfig::GetConfig(context).force_external;
+			partitions.push_back(std::move(partition));
+		}
+		memory_per_thread = PhysicalOperator::GetMaxThreadMemory(context);
+	}
+
+	//! The layout of the sorted payload (the input of the aggregate)
+	RowLayout payload_layout;
+	//! The input, partitioned on the hash of the groups
+	vector<unique_ptr<GlobalSortState>> partitions;
+	//! Memory usage per thread
+	idx_t memory_per_thread;
+	//! The next partition to be sorted
+	atomic<idx_t> next_partition;
+	//! The amount of partitions that have been sorted
+	atomic<idx_t> finished_partitions;
+};
+
+class SortAggregateLocalSinkState : public LocalSinkState {
+public:
+	SortAggregateLocalSinkState(ClientContext &context, const PhysicalSortAggregate &op)
+	    : partitions(op.partition_count), hashes(LogicalType::HASH) {
+		auto &allocator = Allocator::Get(context);
+		vector<LogicalType> group_types;
+		for (auto &group : op.groups) {
+			group_types.push_back(group->return_type);
+		}
+		keys.Initialize(allocator, group_types);
+		partition_keys.Initialize(allocator, group_types);
+		partition_payload.Initialize(allocator, op.children[0]->types);
+		for (idx_t partition_idx = 0; partition_idx < op.partition_count; partition_idx++) {
+			partition_sel.emplace_back(STANDARD_VECTOR_SIZE);
+		}
+	}
+
+	//! The local sort state of every partition
+	vector<LocalSortState> partitions;
+	//! The groups of the input chunk
+	DataChunk keys;
+	//! The hashes of the groups
+	Vector hashes;
+	//! The rows of the input chunk that belong to every partition
+	vector<SelectionVector> partition_sel;
+	//! The groups and the input of a single partition
+	DataChunk partition_keys;
+	DataChunk partition_payload;
+};
+
+unique_ptr<GlobalSinkState> PhysicalSortAggregate::GetGlobalSinkState(ClientContext &context) const {
+	return make_uniq<SortAggregateGlobalSinkState>(context, *this);
+}
+
+unique_ptr<LocalSinkState> PhysicalSortAggregate::GetLocalSinkState(ExecutionContext &context) const {
+	return make_uniq<SortAggregateLocalSinkState>(context.client, *this);
+}
+
+SinkResultType PhysicalSortAggregate::Sink(ExecutionContext &context, GlobalSinkState &gstate_p,
+                                           LocalSinkState &lstate_p, DataChunk &input) const {
+	auto &gstate = gstate_p.Cast<SortAggregateGlobalSinkState>();
+	auto &lstate = lstate_p.Cast<SortAggregateLocalSinkState>();
+	auto &buffer_manager = BufferManager::GetBufferManager(context.client);
+
+	auto &keys = lstate.keys;
+	keys.Reset();
+	for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+		auto &group = groups[group_idx]->Cast<BoundReferenceExpression>();
+		keys.data[group_idx].Reference(input.data[group.index]);
+	}
+	keys.SetCardinality(input.size());
+
+	// partition the input on the hash of the groups
+	vector<idx_t> partition_counts(partition_count, 0);
+	if (partition_count == 1) {
+		partition_counts[0] = input.size();
+	} else {
+		keys.Hash(lstate.hashes);
+		UnifiedVectorFormat hash_data;
+		lstate.hashes.ToUnifiedFormat(input.size(), hash_data);
+		auto hashes = (hash_t *)hash_data.data;
+		for (idx_t i = 0; i < input.size(); i++) {
+			auto partition_idx = hashes[hash_data.sel->get_index(i)] & (partition_count - 1);
+			lstate.partition_sel[partition_idx].set_index(partition_counts[partition_idx]++, i);
+		}
+	}
+
+	idx_t size_in_bytes = 0;
+	for (idx_t partition_idx = 0; partition_idx < partition_count; partition_idx++) {
+		auto &local_sort_state = lstate.partitions[partition_idx];
+		auto count = partition_counts[partition_idx];
+		if (count > 0) {
+			if (!local_sort_state.initialized) {
+				local_sort_state.Initialize(*gstate.partitions[partition_idx], buffer_manager);
+			}
+			if (partition_count == 1) {
+				local_sort_state.SinkChunk(keys, input);
+			} else {
+				auto &sel = lstate.partition_sel[partition_idx];
+				lstate.partition_keys.Reset();
+				lstate.partition_keys.Slice(keys, sel, count);
+				lstate.partition_payload.Reset();
+				lstate.partition_payload.Slice(input, sel, count);
+				local_sort_state.SinkChunk(lstate.partition_keys, lstate.partition_payload);
+			}
+		}
+		if (local_sort_state.initialized) {
+			size_in_bytes += local_sort_state.SizeInBytes();
+		}
+	}
+
+	// when the data of this thread reaches a certain size, we sort it (so it can be offloaded to disk)
+	if (size_in_bytes >= gstate.memory_per_thread) {
+		for (idx_t partition_idx = 0; partition_idx < partition_count; partition_idx++) {
+			auto &local_sort_state = lstate.partitions[partition_idx];
+			if (local_sort_state.initialized && local_sort_state.SizeInBytes() > 0) {
+				local_sort_state.Sort(*gstate.partitions[partition_idx], true);
+			}
+		}
+	}
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+void PhysicalSortAggregate::Combine(ExecutionContext &context, GlobalSinkState &gstate_p,
+                                    LocalSinkState &lstate_p) const {
+	auto &gstate = gstate_p.Cast<SortAggregateGlobalSinkState>();
+	auto &lstate = lstate_p.Cast<SortAggregateLocalSinkState>();
+	for (idx_t partition_idx = 0; partition_idx < partition_count; partition_idx++) {
+		auto &local_sort_state = lstate.partitions[partition_idx];
+		if (local_sort_state.initialized) {
+			gstate.partitions[partition_idx]->AddLocalState(local_sort_state);
+		}
+	}
+}
+
+//! Fully sorts a single partition of the input
+static void SortPartition(GlobalSortState &global_sort_state, BufferManager &buffer_manager) {
+	if (global_sort_state.sorted_blocks.empty()) {
+		return;
+	}
+	global_sort_state.PrepareMergePhase();
+	while (global_sort_state.sorted_blocks.size() > 1) {
+		global_sort_state.InitializeMergeRound();
+		MergeSorter merge_sorter(global_sort_state, buffer_manager);
+		merge_sorter.PerformInMergeRound();
+		global_sort_state.CompleteMergeRound();
+	}
+}
+
+class SortAggregateMergeTask : public ExecutorTask {
+public:
+	SortAggregateMergeTask(shared_ptr<Event> event_p, ClientContext &context, SortAggregateGlobalSinkState &state)
+	    : ExecutorTask(context), event(std::move(event_p)), context(context), state(state) {
+	}
+
+	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
+		// every task sorts entire partitions until all partitions are sorted
+		auto &buffer_manager = BufferManager::GetBufferManager(context);
+		while (true) {
+			auto partition_idx = state.next_partition++;
+			if (partition_idx >= state.partitions.size()) {
+				break;
+			}
+			SortPartition(*state.partitions[partition_idx], buffer_manager);
+			state.finished_partitions++;
+		}
+		event->FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	shared_ptr<Event> event;
+	ClientContext &context;
+	SortAggregateGlobalSinkState &state;
+};
+
+class SortAggregateMergeEvent : public BasePipelineEvent {
+public:
+	SortAggregateMergeEvent(SortAggregateGlobalSinkState &gstate_p, Pipeline &pipeline_p)
+	    : BasePipelineEvent(pipeline_p), gstate(gstate_p) {
+	}
+
+	SortAggregateGlobalSinkState &gstate;
+
+public:
+	void Schedule() override {
+		auto &context = pipeline->GetClientContext();
+
+		auto &ts = TaskScheduler::GetScheduler(context);
+		idx_t num_threads = MinValue<idx_t>(ts.NumberOfThreads(), gstate.partitions.size());
+
+		vector<unique_ptr<Task>> merge_tasks;
+		for (idx_t tnum = 0; tnum < num_threads; tnum++) {
+			merge_tasks.push_back(make_uniq<SortAggregateMergeTask>(shared_from_this(), context, gstate));
+		}
+		SetTasks(std::move(merge_tasks));
+	}
+
+	void FinishEvent() override {
+		D_ASSERT(gstate.finished_partitions == gstate.partitions.size());
+	}
+};
+
+SinkFinalizeType PhysicalSortAggregate::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                 GlobalSinkState &gstate_p) const {
+	auto &gstate = gstate_p.Cast<SortAggregateGlobalSinkState>();
+	bool empty = true;
+	for (auto &partition : gstate.partitions) {
+		if (!partition->sorted_blocks.empty()) {
+			empty = false;
+		}
+	}
+	if (empty) {
+		return SinkFinalizeType::NO_OUTPUT_POSSIBLE;
+	}
+	// sort the partitions in parallel
+	auto new_event = make_shared<SortAggregateMergeEvent>(gstate, pipeline);
+	event.InsertEvent(std::move(new_event));
+	return SinkFinalizeType::READY;
+}
+
+//===--------------------------------------------------------------------===//
+// Source
+//===--------------------------------------------------------------------===//
+class SortAggregateGlobalSourceState : public GlobalSourceState {
+public:
+	explicit SortAggregateGlobalSourceState(const PhysicalSortAggregate &op) : op(op), next_partition(0) {
+	}
+
+	idx_t MaxThreads() override {
+		return op.partition_count;
+	}
+
+	const PhysicalSortAggregate &op;
+	//! The next partition to be aggregated
+	atomic<idx_t> next_partition;
+};
+
+class SortAggregateLocalSourceState : public LocalSourceState {
+public:
+	SortAggregateLocalSourceState(ExecutionContext &context, const PhysicalSortAggregate &op)
+	    : op(op), layout(op.layout.Copy()), allocator(BufferAllocator::Get(context.client)),
+	      partition_idx(DConstants::INVALID_INDEX), group_open(false), current_state(0),
+	      addresses(LogicalType::POINTER), finalize_addresses(LogicalType::POINTER), boundaries(STANDARD_VECTOR_SIZE),
+	      run_starts(STANDARD_VECTOR_SIZE) {
+		auto &client_allocator = Allocator::Get(context.client);
+		payload.Initialize(client_allocator, op.children[0]->types);
+		vector<LogicalType> group_types;
+		for (auto &group : op.groups) {
+			group_types.push_back(group->return_type);
+		}
+		open_group.Initialize(client_allocator, group_types, 1);
+
+		auto row_width = layout.GetRowWidth();
+		state_data = unique_ptr<data_t[]>(new data_t[row_width * STANDARD_VECTOR_SIZE]);
+		open_states[0] = unique_ptr<data_t[]>(new data_t[row_width]);
+		open_states[1] = unique_ptr<data_t[]>(new data_t[row_width]);
+
+		filter_set.Initialize(context.client, op.aggregate_objects, op.children[0]->types);
+	}
+
+	~SortAggregateLocalSourceState() override {
+		if (group_open) {
+			// the query was interrupted while a group was being aggregated
+			auto pointers = FlatVector::GetData<data_ptr_t>(finalize_addresses);
+			pointers[0] = open_states[current_state].get();
+			RowOperationsState row_state(allocator);
+			RowOperations::DestroyStates(row_state, layout, finalize_addresses, 1);
+		}
+	}
+
+	//! Aggregates the groups of the next sorted chunk of the current partition into the output chunk
+	void AggregateChunk(DataChunk &chunk);
+	//! Outputs the open group, after the last chunk of the partition has been aggregated
+	void FinishPartition(DataChunk &chunk);
+
+private:
+	//! Finds the rows of the payload where a new group starts
+	idx_t FindRunStarts(bool &continues_group);
+	void FinalizeStates(DataChunk &chunk, idx_t count);
+
+public:
+	const PhysicalSortAggregate &op;
+	//! The layout of the aggregate states of a single group
+	TupleDataLayout layout;
+	//! The allocator used by the aggregate states
+	Allocator &allocator;
+	//! The partition that is being aggregated
+	idx_t partition_idx;
+	//! The scanner over the sorted partition
+	unique_ptr<PayloadScanner> scanner;
+	//! The current chunk of the sorted partition
+	DataChunk payload;
+	//! Whether or not the last group of the previous chunk may continue in the next chunk
+	bool group_open;
+	//! The values of the open group
+	DataChunk open_group;
+	//! The states of the open group (alternating between two buffers)
+	unique_ptr<data_t[]> open_states[2];
+	idx_t current_state;
+	//! The states of the groups that are completely contained in the current chunk
+	unique_ptr<data_t[]> state_data;
+	//! The state of every row of the current chunk
+	Vector addresses;
+	//! The states of the groups that are finalized
+	Vector finalize_addresses;
+	//! The groups finalized with the current chunk
+	SelectionVector boundaries;
+	//! The first row of every group in the current chunk
+	SelectionVector run_starts;
+	//! Aggregate filter data set
+	AggregateFilterDataSet filter_set;
+};
+
+idx_t SortAggregateLocalSourceState::FindRunStarts(bool &continues_group) {
+	auto count = payload.size();
+	D_ASSERT(count > 0);
+	// new_group[i] is set if row i starts a different group than row i - 1
+	bool new_group[STANDARD_VECTOR_SIZE];
+	memset(new_group, 0, sizeof(bool) * count);
+	continues_group = group_open;
+	SelectionVector current_sel(1, count - 1);
+	SelectionVector first_sel(0, 1);
+	for (idx_t group_idx = 0; group_idx < op.groups.size(); group_idx++) {
+		auto &group = op.groups[group_idx]->Cast<BoundReferenceExpression>();
+		auto &column = payload.data[group.index];
+		if (count > 1) {
+			Vector previous(column, *FlatVector::IncrementalSelectionVector(), count - 1);
+			Vector current(column, current_sel, count - 1);
+			auto distinct_count =
+			    VectorOperations::DistinctFrom(previous, current, nullptr, count - 1, &boundaries, nullptr);
+			for (idx_t i = 0; i < distinct_count; i++) {
+				new_group[boundaries.get_index(i) + 1] = true;
+			}
+		}
+		if (continues_group) {
+			Vector first(column, first_sel, 1);
+			if (VectorOperations::DistinctFrom(open_group.data[group_idx], first, nullptr, 1, &boundaries, nullptr) >
+			    0) {
+				continues_group = false;
+			}
+		}
+	}
+	idx_t run_count = 0;
+	run_starts.set_index(run_count++, 0);
+	for (idx_t i = 1; i < count; i++) {
+		if (new_group[i]) {
+			run_starts.set_index(run_count++, i);
+		}
+	}
+	return run_count;
+}
+
+void SortAggregateLocalSourceState::FinalizeStates(DataChunk &chunk, idx_t count) {
+	if (count == 0) {
+		return;
+	}
+	auto group_count = op.groups.size();
+	chunk.SetCardinality(count);
+	RowOperationsState row_state(allocator);
+	auto pointers = FlatVector::GetData<data_ptr_t>(finalize_addresses);
+	vector<data_ptr_t> states(pointers, pointers + count);
+	RowOperations::FinalizeStates(row_state, layout, finalize_addresses, chunk, group_count);
+	// finalizing moved the pointers: restore them to destroy the states
+	for (idx_t i = 0; i < count; i++) {
+		pointers[i] = states[i];
+	}
+	RowOperations::DestroyStates(row_state, layout, finalize_addresses, count);
+}
+
+void SortAggregateLocalSourceState::AggregateChunk(DataChunk &chunk) {
+	auto count = payload.size();
+	bool continues_group;
+	auto run_count = FindRunStarts(continues_group);
+
+	// every group that is not continued in the next chunk is finalized with this chunk
+	// the last group of the chunk stays open: it may continue in the next chunk
+	auto row_width = layout.GetRowWidth();
+	auto next_state = 1 - current_state;
+	auto row_pointers = FlatVector::GetData<data_ptr_t>(addresses);
+	auto finalize_pointers = FlatVector::GetData<data_ptr_t>(finalize_addresses);
+	idx_t finalize_count = 0;
+	// the values of the groups that are finalized
+	auto group_count = op.groups.size();
+	idx_t output_rows = 0;
+	if (group_open && !continues_group) {
+		// the open group ended with the previous chunk
+		finalize_pointers[finalize_count++] = open_states[current_state].get();
+		for (idx_t group_idx = 0; group_idx < group_count; group_idx++) {
+			VectorOperations::Copy(open_group.data[group_idx], chunk.data[group_idx], 1, 0, 0);
+		}
+		output_rows++;
+	}
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		auto start = run_starts.get_index(run_idx);
+		auto end = run_idx + 1 < run_count ? run_starts.get_index(run_idx + 1) : count;
+		bool last_run = run_idx + 1 == run_count;
+		data_ptr_t state;
+		if (run_idx == 0 && continues_group) {
+			state = open_states[current_state].get();
+		} else {
+			state = last_run ? open_states[next_state].get() : state_data.get() + run_idx * row_width;
+			Vector state_vector(LogicalType::POINTER, (data_ptr_t)&state);
+			RowOperations::InitializeStates(layout, state_vector, *FlatVector::IncrementalSelectionVector(), 1);
+		}
+		for (idx_t i = start; i < end; i++) {
+			row_pointers[i] = state;
+		}
+		if (!last_run) {
+			finalize_pointers[finalize_count++] = state;
+		}
+	}
+	// copy the values of the groups that are finalized
+	if (run_count > 1) {
+		for (idx_t group_idx = 0; group_idx < group_count; group_idx++) {
+			auto &group = op.groups[group_idx]->Cast<BoundReferenceExpression>();
+			VectorOperations::Copy(payload.data[group.index], chunk.data[group_idx], run_starts, run_count - 1, 0,
+			                       output_rows);
+		}
+		output_rows += run_count - 1;
+	}
+	D_ASSERT(output_rows == finalize_count);
+
+	// update the states of all groups with the rows of this chunk
+	VectorOperations::AddInPlace(addresses, layout.GetAggrOffset(), count);
+	RowOperationsState row_state(allocator);
+	idx_t payload_idx = 0;
+	for (idx_t aggr_idx = 0; aggr_idx < op.aggregate_objects.size(); aggr_idx++) {
+		auto &aggr = op.aggregate_objects[aggr_idx];
+		auto &expr = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		if (!expr.children.empty()) {
+			payload_idx = expr.children[0]->Cast<BoundReferenceExpression>().index;
+		}
+		auto &aggregate = (AggregateObject &)aggr;
+		if (aggr.filter) {
+			RowOperations::UpdateFilteredStates(row_state, filter_set.GetFilterData(aggr_idx), aggregate, addresses,
+			                                    payload, payload_idx);
+		} else {
+			RowOperations::UpdateStates(row_state, aggregate, addresses, payload, payload_idx, count);
+		}
+		VectorOperations::AddInPlace(addresses, aggr.payload_size, count);
+	}
+
+	if (continues_group && run_count == 1) {
+		// the open group continues in the next chunk
+		D_ASSERT(finalize_count == 0);
+		return;
+	}
+	// the last group of the chunk is the new open group
+	// reset the open group first: copying does not clear the validity of a previous NULL group
+	SelectionVector last_sel(run_starts.get_index(run_count - 1), 1);
+	open_group.Reset();
+	for (idx_t group_idx = 0; group_idx < group_count; group_idx++) {
+		auto &group = op.groups[group_idx]->Cast<BoundReferenceExpression>();
+		VectorOperations::Copy(payload.data[group.index], open_group.data[group_idx], last_sel, 1, 0, 0);
+	}
+	open_group.SetCardinality(1);
+	group_open = true;
+	current_state = next_state;
+	FinalizeStates(chunk, finalize_count);
+}
+
+void SortAggregateLocalSourceState::FinishPartition(DataChunk &chunk) {
+	if (!group_open) {
+		return;
+	}
+	for (idx_t group_idx = 0; group_idx < op.groups.size(); group_idx++) {
+		VectorOperations::Copy(open_group.data[group_idx], chunk.data[group_idx], 1, 0, 0);
+	}
+	auto finalize_pointers = FlatVector::GetData<data_ptr_t>(finalize_addresses);
+	finalize_pointers[0] = open_states[current_state].get();
+	group_open = false;
+	FinalizeStates(chunk, 1);
+}
+
+unique_ptr<GlobalSourceState> PhysicalSortAggregate::GetGlobalSourceState(ClientContext &context) const {
+	return make_uniq<SortAggregateGlobalSourceState>(*this);
+}
+
+unique_ptr<LocalSourceState> PhysicalSortAggregate::GetLocalSourceState(ExecutionContext &context,
+                                                                        GlobalSourceState &gstate) const {
+	return make_uniq<SortAggregateLocalSourceState>(context, *this);
+}
+
+void PhysicalSortAggregate::GetData(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate_p,
+                                    LocalSourceState &lstate_p) const {
+	auto &sink = sink_state->Cast<SortAggregateGlobalSinkState>();
+	auto &gstate = gstate_p.Cast<SortAggregateGlobalSourceState>();
+	auto &lstate = lstate_p.Cast<SortAggregateLocalSourceState>();
+	while (chunk.size() == 0) {
+		if (lstate.scanner && lstate.scanner->Remaining() == 0) {
+			// the partition is exhausted: output the last group
+			lstate.scanner.reset();
+			lstate.FinishPartition(chunk);
+			continue;
+		}
+		if (!lstate.scanner) {
+			// move on to the next partition
+			do {
+				lstate.partition_idx = gstate.next_partition++;
+			} while (lstate.partition_idx < partition_count &&
+			         sink.partitions[lstate.partition_idx]->sorted_blocks.empty());
+			if (lstate.partition_idx >= partition_count) {
+				return;
+			}
+			lstate.scanner = make_uniq<PayloadScanner>(*sink.partitions[lstate.partition_idx], true);
+		}
+		lstate.payload.Reset();
+		lstate.scanner->Scan(lstate.payload);
+		if (lstate.payload.size() == 0) {
+			continue;
+		}
+		lstate.AggregateChunk(chunk);
+	}
+}
+
+string PhysicalSortAggregate::ParamsToString() const {
+	string result;
+	for (idx_t i = 0; i < groups.size(); i++) {
+		if (i > 0) {
+			result += "\n";
+		}
+		result += groups[i]->GetName();
+	}
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		auto &aggregate = aggregates[i]->Cast<BoundAggregateExpression>();
+		result += "\n";
+		result += aggregates[i]->GetName();
+		if (aggregate.filter) {
+			result += " Filter: " + aggregate.filter->GetName();
+		}
+	}
+	return result;
+}
+
+} // namespace duckdb
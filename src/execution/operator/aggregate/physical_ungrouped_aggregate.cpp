@@ -10,6 +10,7 @@
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/execution/radix_partitioned_hashtable.hpp"
 #include "duckdb/parallel/base_pipeline_event.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/common/unordered_set.hpp"
 #include "duckdb/common/algorithm.hpp"
 #include <functional>
@@ -346,12 +347,34 @@ void PhysicalUngroupedAggregate::Combine(ExecutionContext &context, GlobalSinkSt
 	client_profiler.Flush(context.thread.profiler);
 }
 
+class UngroupedDistinctAggregateFinalizeEvent : public BasePipelineEvent {
+public:
+	UngroupedDistinctAggregateFinalizeEvent(const PhysicalUngroupedAggregate &op_p,
+	                                        UngroupedAggregateGlobalState &gstate_p, Pipeline &pipeline_p,
+	                                        ClientContext &context)
+	    : BasePipelineEvent(pipeline_p), op(op_p), gstate(gstate_p), context(context) {
+	}
+	const PhysicalUngroupedAggregate &op;
+	UngroupedAggregateGlobalState &gstate;
+	ClientContext &context;
+	//! The GlobalSourceStates of the radix tables of the distinct aggregates (shared by all tasks)
+	vector<unique_ptr<GlobalSourceState>> global_source_states;
+
+public:
+	void Schedule() override;
+
+	void FinishEvent() override {
+		D_ASSERT(!gstate.finished);
+		gstate.finished = true;
+	}
+};
+
 class UngroupedDistinctAggregateFinalizeTask : public ExecutorTask {
 public:
 	UngroupedDistinctAggregateFinalizeTask(Executor &executor, shared_ptr<Event> event_p,
-	                                       UngroupedAggregateGlobalState &state_p, ClientContext &context,
-	                                       const PhysicalUngroupedAggregate &op)
-	    : ExecutorTask(executor), event(std::move(event_p)), gstate(state_p), context(context), op(op) {
+	                                       UngroupedDistinctAggregateFinalizeEvent &finalize_event)
+	    : ExecutorTask(executor), event(std::move(event_p)), finalize_event(finalize_event),
+	      gstate(finalize_event.gstate), context(finalize_event.context), op(finalize_event.op) {
 	}
 
 	void AggregateDistinct() {
@@ -363,64 +386,73 @@ public:
 		ThreadContext temp_thread_context(context);
 		ExecutionContext temp_exec_context(context, temp_thread_context, nullptr);
 
-		idx_t payload_idx = 0;
-		idx_t next_payload_idx = 0;
-
-		for (idx_t i = 0; i < aggregates.size(); i++) {
-			auto &aggregate = aggregates[i]->Cast<BoundAggregateExpression>();
-
-			// Forward the payload idx
-			payload_idx = next_payload_idx;
-			next_payload_idx = payload_idx + aggregate.children.size();
+		// every task aggregates the part of the distinct values it scans into its own states
+		AggregateState state(aggregates);
 
-			// If aggregate is not distinct, skip it
-			if (!distinct_data.IsDistinct(i)) {
+		// scan every table once, and update all the aggregates that share the table
+		for (idx_t table_idx = 0; table_idx < distinct_data.radix_tables.size(); table_idx++) {
+			auto &radix_table_p = distinct_data.radix_tables[table_idx];
+			if (!radix_table_p) {
+				continue;
+			}
+			vector<idx_t> table_aggregates;
+			for (idx_t i = 0; i < aggregates.size(); i++) {
+				if (distinct_data.IsDistinct(i) && distinct_data.info.table_map.at(i) == table_idx) {
+					table_aggregates.push_back(i);
+				}
+			}
+			if (table_aggregates.empty()) {
 				continue;
 			}
 
-			DataChunk payload_chunk;
-
-			D_ASSERT(distinct_data.info.table_map.count(i));
-			auto table_idx = distinct_data.info.table_map.at(i);
-			auto &radix_table_p = distinct_data.radix_tables[table_idx];
-			auto &output_chunk = *distinct_state.distinct_output_chunks[table_idx];
-			auto &grouped_aggregate_data = *distinct_data.grouped_aggregate_data[table_idx];
-
-			payload_chunk.InitializeEmpty(grouped_aggregate_data.group_types);
-			payload_chunk.SetCardinality(0);
+			// Create a duplicate of the output_chunk, because of multi-threading we cant alter the original
+			DataChunk output_chunk;
+			output_chunk.Initialize(context, distinct_state.distinct_output_chunks[table_idx]->GetTypes());
 
-			//! Create global and local state for the hashtable
-			auto global_source_state = radix_table_p->GetGlobalSourceState(context);
+			auto &global_source_state = *finalize_event.global_source_states[table_idx];
 			auto local_source_state = radix_table_p->GetLocalSourceState(temp_exec_context);
 
 			//! Retrieve the stored data from the hashtable
 			while (true) {
 				output_chunk.Reset();
 				radix_table_p->GetData(temp_exec_context, output_chunk, *distinct_state.radix_states[table_idx],
-				                       *global_source_state, *local_source_state);
+				                       global_source_state, *local_source_state);
 				if (output_chunk.size() == 0) {
 					break;
 				}
 
 				// We dont need to resolve the filter, we already did this in Sink
-				idx_t payload_cnt = aggregate.children.size();
-				for (idx_t i = 0; i < payload_cnt; i++) {
-					payload_chunk.data[i].Reference(output_chunk.data[i]);
-				}
-				payload_chunk.SetCardinality(output_chunk);
+				for (auto i : table_aggregates) {
+					auto &aggregate = aggregates[i]->Cast<BoundAggregateExpression>();
+					idx_t payload_cnt = aggregate.children.size();
+					auto start_of_input = payload_cnt ? &output_chunk.data[0] : nullptr;
+					//! Update the aggregate state
+					AggregateInputData aggr_input_data(aggregate.bind_info.get(), Allocator::DefaultAllocator());
+					aggregate.function.simple_update(start_of_input, aggr_input_data, payload_cnt,
+					                                 state.aggregates[i].get(), output_chunk.size());
 #ifdef DEBUG
-				gstate.state.counts[i] += payload_chunk.size();
+					state.counts[i] += output_chunk.size();
 #endif
+				}
+			}
+		}
 
-				auto start_of_input = payload_cnt ? &payload_chunk.data[0] : nullptr;
-				//! Update the aggregate state
-				AggregateInputData aggr_input_data(aggregate.bind_info.get(), Allocator::DefaultAllocator());
-				aggregate.function.simple_update(start_of_input, aggr_input_data, payload_cnt,
-				                                 gstate.state.aggregates[i].get(), payload_chunk.size());
+		// combine the states of this task into the global state
+		lock_guard<mutex> glock(gstate.lock);
+		for (idx_t i = 0; i < aggregates.size(); i++) {
+			if (!distinct_data.IsDistinct(i)) {
+				continue;
 			}
+			auto &aggregate = aggregates[i]->Cast<BoundAggregateExpression>();
+			Vector source_state(Value::POINTER((uintptr_t)state.aggregates[i].get()));
+			Vector dest_state(Value::POINTER((uintptr_t)gstate.state.aggregates[i].get()));
+
+			AggregateInputData aggr_input_data(aggregate.bind_info.get(), Allocator::DefaultAllocator());
+			aggregate.function.combine(source_state, dest_state, aggr_input_data, 1);
+#ifdef DEBUG
+			gstate.state.counts[i] += state.counts[i];
+#endif
 		}
-		D_ASSERT(!gstate.finished);
-		gstate.finished = true;
 	}
 
 	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
@@ -431,32 +463,39 @@ public:
 
 private:
 	shared_ptr<Event> event;
+	UngroupedDistinctAggregateFinalizeEvent &finalize_event;
 	UngroupedAggregateGlobalState &gstate;
 	ClientContext &context;
 	const PhysicalUngroupedAggregate &op;
 };
 
-// TODO: Create tasks and run these in parallel instead of doing this all in Schedule, single threaded
-class UngroupedDistinctAggregateFinalizeEvent : public BasePipelineEvent {
-public:
-	UngroupedDistinctAggregateFinalizeEvent(const PhysicalUngroupedAggregate &op_p,
-	                                        UngroupedAggregateGlobalState &gstate_p, Pipeline &pipeline_p,
-	                                        ClientContext &context)
-	    : BasePipelineEvent(pipeline_p), op(op_p), gstate(gstate_p), context(context) {
+void UngroupedDistinctAggregateFinalizeEvent::Schedule() {
+	auto &distinct_state = *gstate.distinct_state;
+	auto &distinct_data = *op.distinct_data;
+
+	// the distinct values of every table are scanned in parallel: use one task per thread, up to the amount of
+	// vectors of distinct values
+	idx_t distinct_count = 0;
+	global_source_states.resize(distinct_data.radix_tables.size());
+	for (idx_t table_idx = 0; table_idx < distinct_data.radix_tables.size(); table_idx++) {
+		auto &radix_table_p = distinct_data.radix_tables[table_idx];
+		if (!radix_table_p) {
+			continue;
+		}
+		global_source_states[table_idx] = radix_table_p->GetGlobalSourceState(context);
+		distinct_count += radix_table_p->Size(*distinct_state.radix_states[table_idx]);
 	}
-	const PhysicalUngroupedAggregate &op;
-	UngroupedAggregateGlobalState &gstate;
-	ClientContext &context;
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	idx_t number_of_tasks = MinValue<idx_t>(scheduler.NumberOfThreads(), distinct_count / STANDARD_VECTOR_SIZE + 1);
 
-public:
-	void Schedule() override {
-		vector<unique_ptr<Task>> tasks;
-		tasks.push_back(make_uniq<UngroupedDistinctAggregateFinalizeTask>(pipeline->executor, shared_from_this(),
-		                                                                  gstate, context, op));
-		D_ASSERT(!tasks.empty());
-		SetTasks(std::move(tasks));
+	vector<unique_ptr<Task>> tasks;
+	for (idx_t i = 0; i < number_of_tasks; i++) {
+		tasks.push_back(
+		    make_uniq<UngroupedDistinctAggregateFinalizeTask>(pipeline->executor, shared_from_this(), *this));
 	}
-};
+	D_ASSERT(!tasks.empty());
+	SetTasks(std::move(tasks));
+}
 
 class UngroupedDistinctCombineFinalizeEvent : public BasePipelineEvent {
 public:
@@ -234,7 +234,7 @@ struct WindowInputColumn {
 		}
 	}
 
-	inline bool CellIsNull(idx_t i) {
+	inline bool CellIsNull(idx_t i) const {
 		D_ASSERT(target);
 		D_ASSERT(i < count);
 		return FlatVector::IsNull(*target, input_expr.scalar ? 0 : i);
@@ -283,9 +283,9 @@ struct WindowBoundariesState {
 	      needs_peer(BoundaryNeedsPeer(wexpr.end) || wexpr.type == ExpressionType::WINDOW_CUME_DIST) {
 	}
 
-	void Update(const idx_t row_idx, WindowInputColumn &range_collection, const idx_t source_offset,
+	void Update(const idx_t row_idx, const WindowInputColumn &range_collection, const idx_t source_offset,
 	            WindowInputExpression &boundary_start, WindowInputExpression &boundary_end,
-	            const ValidityMask &partition_mask, const ValidityMask &order_mask);
+	            const ValidityMask &partition_mask, const ValidityMask &order_mask, const bool is_jump);
 
 	// Cached lookups
 	const ExpressionType type;
@@ -317,20 +317,20 @@ static bool WindowNeedsRank(const BoundWindowExpression &wexpr) {
 }
 
 template <typename T>
-static T GetCell(DataChunk &chunk, idx_t column, idx_t index) {
+static T GetCell(const DataChunk &chunk, idx_t column, idx_t index) {
 	D_ASSERT(chunk.ColumnCount() > column);
 	auto &source = chunk.data[column];
 	const auto data = FlatVector::GetData<T>(source);
 	return data[index];
 }
 
-static bool CellIsNull(DataChunk &chunk, idx_t column, idx_t index) {
+static bool CellIsNull(const DataChunk &chunk, idx_t column, idx_t index) {
 	D_ASSERT(chunk.ColumnCount() > column);
 	auto &source = chunk.data[column];
 	return FlatVector::IsNull(source, index);
 }
 
-static void CopyCell(DataChunk &chunk, idx_t column, idx_t index, Vector &target, idx_t target_offset) {
+static void CopyCell(const DataChunk &chunk, idx_t column, idx_t index, Vector &target, idx_t target_offset) {
 	D_ASSERT(chunk.ColumnCount() > column);
 	auto &source = chunk.data[column];
 	VectorOperations::Copy(source, target, index + 1, index, target_offset);
@@ -345,7 +345,7 @@ struct WindowColumnIterator {
 	using reference = T;
 	using pointer = idx_t;
 
-	explicit WindowColumnIterator(WindowInputColumn &coll_p, pointer pos_p = 0) : coll(&coll_p), pos(pos_p) {
+	explicit WindowColumnIterator(const WindowInputColumn &coll_p, pointer pos_p = 0) : coll(&coll_p), pos(pos_p) {
 	}
 
 	inline reference operator*() const {
@@ -373,7 +373,7 @@ struct WindowColumnIterator {
 	}
 
 private:
-	optional_ptr<WindowInputColumn> coll;
+	optional_ptr<const WindowInputColumn> coll;
 	pointer pos;
 };
 
@@ -385,7 +385,7 @@ struct OperationCompare : public std::function<bool(T, T)> {
 };
 
 template <typename T, typename OP, bool FROM>
-static idx_t FindTypedRangeBound(WindowInputColumn &over, const idx_t order_begin, const idx_t order_end,
+static idx_t FindTypedRangeBound(const WindowInputColumn &over, const idx_t order_begin, const idx_t order_end,
                                  WindowInputExpression &boundary, const idx_t boundary_row) {
 	D_ASSERT(!boundary.CellIsNull(boundary_row));
 	const auto val = boundary.GetCell<T>(boundary_row);
@@ -401,7 +401,7 @@ static idx_t FindTypedRangeBound(WindowInputColumn &over, const idx_t order_begi
 }
 
 template <typename OP, bool FROM>
-static idx_t FindRangeBound(WindowInputColumn &over, const idx_t order_begin, const idx_t order_end,
+static idx_t FindRangeBound(const WindowInputColumn &over, const idx_t order_begin, const idx_t order_end,
                             WindowInputExpression &boundary, const idx_t expr_idx) {
 	D_ASSERT(boundary.chunk.ColumnCount() == 1);
 	D_ASSERT(boundary.chunk.data[0].GetType().InternalType() == over.input_expr.ptype);
@@ -437,7 +437,7 @@ static idx_t FindRangeBound(WindowInputColumn &over, const idx_t order_begin, co
 }
 
 template <bool FROM>
-static idx_t FindOrderedRangeBound(WindowInputColumn &over, const OrderType range_sense, const idx_t order_begin,
+static idx_t FindOrderedRangeBound(const WindowInputColumn &over, const OrderType range_sense, const idx_t order_begin,
                                    const idx_t order_end, WindowInputExpression &boundary, const idx_t expr_idx) {
 	switch (range_sense) {
 	case OrderType::ASCENDING:
@@ -449,9 +449,10 @@ static idx_t FindOrderedRangeBound(WindowInputColumn &over, const OrderType rang
 	}
 }
 
-void WindowBoundariesState::Update(const idx_t row_idx, WindowInputColumn &range_collection, const idx_t expr_idx,
+void WindowBoundariesState::Update(const idx_t row_idx, const WindowInputColumn &range_collection, const idx_t expr_idx,
                                    WindowInputExpression &boundary_start, WindowInputExpression &boundary_end,
-                                   const ValidityMask &partition_mask, const ValidityMask &order_mask) {
+                                   const ValidityMask &partition_mask, const ValidityMask &order_mask,
+                                   const bool is_jump) {
 
 	auto &bounds = *this;
 	if (bounds.partition_count + bounds.order_count > 0) {
@@ -460,10 +461,13 @@ void WindowBoundariesState::Update(const idx_t row_idx, WindowInputColumn &range
 		bounds.is_same_partition = !partition_mask.RowIsValidUnsafe(row_idx);
 		bounds.is_peer = !order_mask.RowIsValidUnsafe(row_idx);
 
-		// when the partition changes, recompute the boundaries
-		if (!bounds.is_same_partition) {
-			bounds.partition_start = row_idx;
-			bounds.peer_start = row_idx;
+		// when the partition changes (or we start in the middle of one), recompute the boundaries
+		if (!bounds.is_same_partition || is_jump) {
+			//	When starting in the middle of a partition, the caller has set the partition and peer group starts
+			if (!is_jump) {
+				bounds.partition_start = row_idx;
+				bounds.peer_start = row_idx;
+			}
 
 			// find end of partition
 			bounds.partition_end = bounds.input_size;
@@ -613,26 +617,32 @@ void WindowBoundariesState::Update(const idx_t row_idx, WindowInputColumn &range
 	}
 }
 
+struct WindowExecutorState;
+
+//! The WindowExecutor holds the data of a single window function over a (hash) partition.
+//! Sink and Finalize build it single-threaded, after which it is read-only
+//! so several threads can Evaluate disjoint row ranges with their own WindowExecutorState.
 struct WindowExecutor {
 	static bool IsConstantAggregate(const BoundWindowExpression &wexpr);
 
 	WindowExecutor(BoundWindowExpression &wexpr, ClientContext &context, const ValidityMask &partition_mask,
-	               const idx_t count);
+	               const ValidityMask &order_mask, const idx_t count);
 
 	void Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count);
 	void Finalize(WindowAggregationMode mode);
 
-	void Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, const ValidityMask &partition_mask,
-	              const ValidityMask &order_mask);
+	unique_ptr<WindowExecutorState> GetLocalState(ClientContext &context) const;
+
+	void Evaluate(WindowExecutorState &lstate, idx_t row_idx, DataChunk &input_chunk, Vector &result,
+	              const ValidityMask &partition_mask, const ValidityMask &order_mask) const;
+
+	//! The number of peer groups in [0, row_idx)
+	idx_t CountPeers(const ValidityMask &order_mask, idx_t row_idx) const;
 
 	// The function
 	BoundWindowExpression &wexpr;
-
-	// Frame management
-	WindowBoundariesState bounds;
-	uint64_t dense_rank = 1;
-	uint64_t rank_equal = 0;
-	uint64_t rank = 1;
+	// The number of rows in the partition
+	const idx_t count;
 
 	// Expression collections
 	DataChunk payload_collection;
@@ -644,20 +654,15 @@ struct WindowExecutor {
 	vector<validity_t> filter_bits;
 	SelectionVector filter_sel;
 
-	// LEAD/LAG Evaluation
-	WindowInputExpression leadlag_offset;
-	WindowInputExpression leadlag_default;
-
-	// evaluate boundaries if present. Parser has checked boundary types.
-	WindowInputExpression boundary_start;
-	WindowInputExpression boundary_end;
-
 	// evaluate RANGE expressions, if needed
 	WindowInputColumn range;
 
 	// IGNORE NULLS
 	ValidityMask ignore_nulls;
 
+	// DENSE_RANK: the number of peer groups before each vector, so we can start in the middle of a partition
+	vector<idx_t> peer_counts;
+
 	// build a segment tree for frame-adhering aggregates
 	// see http://www.vldb.org/pvldb/vol8/p1058-leis.pdf
 	unique_ptr<WindowSegmentTree> segment_tree = nullptr;
@@ -666,6 +671,39 @@ struct WindowExecutor {
 	unique_ptr<WindowConstantAggregate> constant_aggregate = nullptr;
 };
 
+//! The per-thread state for evaluating a WindowExecutor
+struct WindowExecutorState {
+	WindowExecutorState(const WindowExecutor &executor, ClientContext &context);
+
+	// Frame management
+	WindowBoundariesState bounds;
+	uint64_t dense_rank = 1;
+	uint64_t rank_equal = 0;
+	uint64_t rank = 1;
+	//! The next row in sequence. Any other row starts in the middle of a partition.
+	idx_t next_row = 0;
+
+	// LEAD/LAG Evaluation
+	WindowInputExpression leadlag_offset;
+	WindowInputExpression leadlag_default;
+
+	// evaluate boundaries if present. Parser has checked boundary types.
+	WindowInputExpression boundary_start;
+	WindowInputExpression boundary_end;
+
+	// Scratch space for the segment tree
+	unique_ptr<WindowSegmentTreeState> segment_tree_state;
+};
+
+WindowExecutorState::WindowExecutorState(const WindowExecutor &executor, ClientContext &context)
+    : bounds(executor.wexpr, executor.count), leadlag_offset(executor.wexpr.offset_expr.get(), context),
+      leadlag_default(executor.wexpr.default_expr.get(), context),
+      boundary_start(executor.wexpr.start_expr.get(), context), boundary_end(executor.wexpr.end_expr.get(), context) {
+	if (executor.segment_tree) {
+		segment_tree_state = executor.segment_tree->GetLocalState();
+	}
+}
+
 bool WindowExecutor::IsConstantAggregate(const BoundWindowExpression &wexpr) {
 	if (!wexpr.aggregate) {
 		return false;
@@ -721,11 +759,12 @@ bool WindowExecutor::IsConstantAggregate(const BoundWindowExpression &wexpr) {
 }
 
 WindowExecutor::WindowExecutor(BoundWindowExpression &wexpr, ClientContext &context, const ValidityMask &partition_mask,
-                               const idx_t count)
-    : wexpr(wexpr), bounds(wexpr, count), payload_collection(), payload_executor(context), filter_executor(context),
-      leadlag_offset(wexpr.offset_expr.get(), context), leadlag_default(wexpr.default_expr.get(), context),
-      boundary_start(wexpr.start_expr.get(), context), boundary_end(wexpr.end_expr.get(), context),
-      range((bounds.has_preceding_range || bounds.has_following_range) ? wexpr.orders[0].expression.get() : nullptr,
+                               const ValidityMask &order_mask, const idx_t count)
+    : wexpr(wexpr), count(count), payload_collection(), payload_executor(context), filter_executor(context),
+      range((wexpr.start == WindowBoundary::EXPR_PRECEDING_RANGE || wexpr.start == WindowBoundary::EXPR_FOLLOWING_RANGE ||
+             wexpr.end == WindowBoundary::EXPR_PRECEDING_RANGE || wexpr.end == WindowBoundary::EXPR_FOLLOWING_RANGE)
+                ? wexpr.orders[0].expression.get()
+                : nullptr,
             context, count)
 
 {
@@ -755,6 +794,33 @@ WindowExecutor::WindowExecutor(BoundWindowExpression &wexpr, ClientContext &cont
 	if (!types.empty()) {
 		payload_collection.Initialize(Allocator::Get(context), types);
 	}
+
+	//	Count the peer groups before each vector so DENSE_RANK can start anywhere
+	if (wexpr.type == ExpressionType::WINDOW_RANK_DENSE) {
+		const auto vector_count = (count + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
+		peer_counts.reserve(vector_count);
+		idx_t peers = 0;
+		for (idx_t row_idx = 0; row_idx < count; row_idx += STANDARD_VECTOR_SIZE) {
+			peer_counts.emplace_back(peers);
+			ValidityMask vector_mask(order_mask.GetData() + order_mask.EntryCount(row_idx));
+			peers += vector_mask.CountValid(MinValue<idx_t>(STANDARD_VECTOR_SIZE, count - row_idx));
+		}
+	}
+}
+
+idx_t WindowExecutor::CountPeers(const ValidityMask &order_mask, idx_t row_idx) const {
+	D_ASSERT(row_idx <= count);
+	const auto vector_idx = row_idx / STANDARD_VECTOR_SIZE;
+	if (vector_idx >= peer_counts.size()) {
+		return peer_counts.empty() ? 0 : order_mask.CountValid(row_idx);
+	}
+	const auto vector_start = vector_idx * STANDARD_VECTOR_SIZE;
+	ValidityMask vector_mask(order_mask.GetData() + order_mask.EntryCount(vector_start));
+	return peer_counts[vector_idx] + vector_mask.CountValid(row_idx - vector_start);
+}
+
+unique_ptr<WindowExecutorState> WindowExecutor::GetLocalState(ClientContext &context) const {
+	return make_uniq<WindowExecutorState>(*this, context);
 }
 
 void WindowExecutor::Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count) {
@@ -840,8 +906,14 @@ void WindowExecutor::Finalize(WindowAggregationMode mode) {
 	}
 }
 
-void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, const ValidityMask &partition_mask,
-                              const ValidityMask &order_mask) {
+void WindowExecutor::Evaluate(WindowExecutorState &lstate, idx_t row_idx, DataChunk &input_chunk, Vector &result,
+                              const ValidityMask &partition_mask, const ValidityMask &order_mask) const {
+	auto &bounds = lstate.bounds;
+	auto &boundary_start = lstate.boundary_start;
+	auto &boundary_end = lstate.boundary_end;
+	auto &leadlag_offset = lstate.leadlag_offset;
+	auto &leadlag_default = lstate.leadlag_default;
+
 	// Evaluate the row-level arguments
 	boundary_start.Execute(input_chunk);
 	boundary_end.Execute(input_chunk);
@@ -849,21 +921,34 @@ void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &res
 	leadlag_offset.Execute(input_chunk);
 	leadlag_default.Execute(input_chunk);
 
+	//	Are we starting in the middle of a partition?
+	const auto is_jump = (row_idx != lstate.next_row);
+	lstate.next_row = row_idx + input_chunk.size();
+
 	// this is the main loop, go through all sorted rows and compute window function result
 	for (idx_t output_offset = 0; output_offset < input_chunk.size(); ++output_offset, ++row_idx) {
 		// special case, OVER (), aggregate over everything
-		bounds.Update(row_idx, range, output_offset, boundary_start, boundary_end, partition_mask, order_mask);
+		const auto jumped = is_jump && !output_offset;
+		bounds.Update(row_idx, range, output_offset, boundary_start, boundary_end, partition_mask, order_mask, jumped);
 		if (WindowNeedsRank(wexpr)) {
 			if (!bounds.is_same_partition || row_idx == 0) { // special case for first row, need to init
-				dense_rank = 1;
-				rank = 1;
-				rank_equal = 0;
+				lstate.dense_rank = 1;
+				lstate.rank = 1;
+				lstate.rank_equal = 0;
+			} else if (jumped) {
+				//	Reconstruct the ranks from the partition and peer boundaries
+				lstate.rank = bounds.peer_start - bounds.partition_start + 1;
+				lstate.rank_equal = row_idx - bounds.peer_start;
+				if (!peer_counts.empty()) {
+					lstate.dense_rank =
+					    CountPeers(order_mask, bounds.peer_start + 1) - CountPeers(order_mask, bounds.partition_start);
+				}
 			} else if (!bounds.is_peer) {
-				dense_rank++;
-				rank += rank_equal;
-				rank_equal = 0;
+				lstate.dense_rank++;
+				lstate.rank += lstate.rank_equal;
+				lstate.rank_equal = 0;
 			}
-			rank_equal++;
+			lstate.rank_equal++;
 		}
 
 		// if no values are read for window, result is NULL
@@ -877,7 +962,8 @@ void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &res
 			if (constant_aggregate) {
 				constant_aggregate->Compute(result, output_offset, bounds.window_start, bounds.window_end);
 			} else {
-				segment_tree->Compute(result, output_offset, bounds.window_start, bounds.window_end);
+				segment_tree->Compute(*lstate.segment_tree_state, result, output_offset, bounds.window_start,
+				                      bounds.window_end);
 			}
 			break;
 		}
@@ -888,17 +974,17 @@ void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &res
 		}
 		case ExpressionType::WINDOW_RANK_DENSE: {
 			auto rdata = FlatVector::GetData<int64_t>(result);
-			rdata[output_offset] = dense_rank;
+			rdata[output_offset] = lstate.dense_rank;
 			break;
 		}
 		case ExpressionType::WINDOW_RANK: {
 			auto rdata = FlatVector::GetData<int64_t>(result);
-			rdata[output_offset] = rank;
+			rdata[output_offset] = lstate.rank;
 			break;
 		}
 		case ExpressionType::WINDOW_PERCENT_RANK: {
 			int64_t denom = (int64_t)bounds.partition_end - bounds.partition_start - 1;
-			double percent_rank = denom > 0 ? ((double)rank - 1) / denom : 0;
+			double percent_rank = denom > 0 ? ((double)lstate.rank - 1) / denom : 0;
 			auto rdata = FlatVector::GetData<double>(result);
 			rdata[output_offset] = percent_rank;
 			break;
@@ -1091,68 +1177,39 @@ SinkFinalizeType PhysicalWindow::Finalize(Pipeline &pipeline, Event &event, Clie
 //===--------------------------------------------------------------------===//
 // Source
 //===--------------------------------------------------------------------===//
-class WindowGlobalSourceState : public GlobalSourceState {
-public:
-	explicit WindowGlobalSourceState(WindowGlobalSinkState &gsink) : gsink(*gsink.global_partition), next_bin(0) {
-	}
+class WindowGlobalSourceState;
 
-	PartitionGlobalSinkState &gsink;
-	//! The output read position.
-	atomic<idx_t> next_bin;
-
-public:
-	idx_t MaxThreads() override {
-		// If there is only one partition, we have to process it on one thread.
-		if (!gsink.grouping_data) {
-			return 1;
-		}
-
-		// If there is not a lot of data, process serially.
-		if (gsink.count < STANDARD_ROW_GROUPS_SIZE) {
-			return 1;
-		}
-
-		return gsink.hash_groups.size();
-	}
+//	The first row of a row block, with the starts of its partition and peer group
+struct WindowBlockStart {
+	idx_t row;
+	idx_t partition_start;
+	idx_t peer_start;
 };
 
-// Per-thread read state
-class WindowLocalSourceState : public LocalSourceState {
+//	A built (hash) partition. It is read-only once built,
+//	so its row blocks can be evaluated by several threads at once.
+class WindowPartitionSourceState {
 public:
 	using HashGroupPtr = unique_ptr<PartitionGlobalHashGroup>;
 	using WindowExecutorPtr = unique_ptr<WindowExecutor>;
 	using WindowExecutors = vector<WindowExecutorPtr>;
 
-	WindowLocalSourceState(const PhysicalWindow &op_p, ExecutionContext &context, WindowGlobalSourceState &gsource)
-	    : context(context.client), op(op_p), gsink(gsource.gsink) {
-
-		vector<LogicalType> output_types;
-		for (idx_t expr_idx = 0; expr_idx < op.select_list.size(); ++expr_idx) {
-			D_ASSERT(op.select_list[expr_idx]->GetExpressionClass() == ExpressionClass::BOUND_WINDOW);
-			auto &wexpr = op.select_list[expr_idx]->Cast<BoundWindowExpression>();
-			output_types.emplace_back(wexpr.return_type);
-		}
-		output_chunk.Initialize(Allocator::Get(context.client), output_types);
-
-		const auto &input_types = gsink.payload_types;
-		layout.Initialize(input_types);
-		input_chunk.Initialize(gsink.allocator, input_types);
-	}
+	WindowPartitionSourceState(ClientContext &context, WindowGlobalSourceState &gsource);
 
 	void MaterializeSortedData();
-	void GeneratePartition(WindowGlobalSinkState &gstate, const idx_t hash_bin);
-	void Scan(DataChunk &chunk);
+	void BuildPartition(WindowGlobalSinkState &gstate, const idx_t hash_bin);
 
-	HashGroupPtr hash_group;
 	ClientContext &context;
 	const PhysicalWindow &op;
-
 	PartitionGlobalSinkState &gsink;
 
+	HashGroupPtr hash_group;
 	//! The generated input chunks
 	unique_ptr<RowDataCollection> rows;
 	unique_ptr<RowDataCollection> heap;
 	RowLayout layout;
+	//! Whether the row blocks are swizzled
+	bool external;
 	//! The partition boundary mask
 	vector<validity_t> partition_bits;
 	ValidityMask partition_mask;
@@ -1164,15 +1221,69 @@ public:
 
 	//! The read partition
 	idx_t hash_bin;
-	//! The read cursor
-	unique_ptr<RowDataCollectionScanner> scanner;
-	//! Buffer for the inputs
-	DataChunk input_chunk;
-	//! Buffer for window results
-	DataChunk output_chunk;
+	//! The number of row blocks to read
+	idx_t block_count;
+	//! Where each row block starts, so tasks can start reading in the middle of a partition
+	vector<WindowBlockStart> block_starts;
+	//! The next row block to read (protected by the global source lock)
+	idx_t next_block;
 };
 
-void WindowLocalSourceState::MaterializeSortedData() {
+class WindowGlobalSourceState : public GlobalSourceState {
+public:
+	using PartitionSourcePtr = shared_ptr<WindowPartitionSourceState>;
+
+	WindowGlobalSourceState(const PhysicalWindow &op, WindowGlobalSinkState &gstate)
+	    : op(op), gstate(gstate), gsink(*gstate.global_partition), next_build(0), builds_active(0), stopped(false) {
+		auto &hash_groups = gsink.hash_groups;
+		bin_count = hash_groups.empty() ? 1 : hash_groups.size();
+	}
+
+	//! Get the next row block to read, building partitions as needed.
+	//! Returns FINISHED when there is nothing left to read, and BLOCKED when the only work left is reading
+	//! partitions that other threads are still building: the interrupt state is called back once a build ends.
+	SourceResultType NextTask(ClientContext &context, PartitionSourcePtr &partition, idx_t &block_idx,
+	                          InterruptState &interrupt_state);
+	//! Ends a partition build and wakes up the threads that are waiting for it
+	void FinishBuild(bool failed);
+
+	const PhysicalWindow &op;
+	WindowGlobalSinkState &gstate;
+	PartitionGlobalSinkState &gsink;
+
+	mutex lock;
+	//! The number of hash bins
+	idx_t bin_count;
+	//! The next hash bin to build
+	idx_t next_build;
+	//! The number of partitions being built
+	idx_t builds_active;
+	//! The built partitions with unread blocks
+	vector<PartitionSourcePtr> built;
+	//! Set when a build fails so nobody waits forever
+	bool stopped;
+	//! The threads waiting for a partition build to end
+	vector<InterruptState> blocked_tasks;
+
+public:
+	idx_t MaxThreads() override {
+		// If there is not a lot of data, process serially.
+		if (gsink.count < STANDARD_ROW_GROUPS_SIZE) {
+			return 1;
+		}
+
+		// Even a single partition can be evaluated in parallel, so go by the amount of data.
+		return (gsink.count + STANDARD_ROW_GROUPS_SIZE - 1) / STANDARD_ROW_GROUPS_SIZE;
+	}
+};
+
+WindowPartitionSourceState::WindowPartitionSourceState(ClientContext &context, WindowGlobalSourceState &gsource)
+    : context(context), op(gsource.op), gsink(gsource.gsink), external(false), hash_bin(0), block_count(0),
+      next_block(0) {
+	layout.Initialize(gsink.payload_types);
+}
+
+void WindowPartitionSourceState::MaterializeSortedData() {
 	auto &global_sort_state = *hash_group->global_sort;
 	if (global_sort_state.sorted_blocks.empty()) {
 		return;
@@ -1186,6 +1297,9 @@ void WindowLocalSourceState::MaterializeSortedData() {
 	sb.radix_sorting_data.clear();
 	sb.blob_sorting_data = nullptr;
 
+	// The sort can go external by itself when its data does not fit in memory: the rows are swizzled then
+	external = external || global_sort_state.external;
+
 	// Move the sorting row blocks into our RDCs
 	auto &buffer_manager = global_sort_state.buffer_manager;
 	auto &sd = *sb.payload_data;
@@ -1211,8 +1325,7 @@ void WindowLocalSourceState::MaterializeSortedData() {
 	                              [&](idx_t c, const unique_ptr<RowDataBlock> &b) { return c + b->count; });
 }
 
-void WindowLocalSourceState::GeneratePartition(WindowGlobalSinkState &gstate, const idx_t hash_bin_p) {
-	//	Get rid of any stale data
+void WindowPartitionSourceState::BuildPartition(WindowGlobalSinkState &gstate, const idx_t hash_bin_p) {
 	hash_bin = hash_bin_p;
 
 	// There are three types of partitions:
@@ -1241,7 +1354,7 @@ void WindowLocalSourceState::GeneratePartition(WindowGlobalSinkState &gstate, co
 	order_mask.Initialize(order_bits.data());
 
 	// Scan the sorted data into new Collections
-	auto external = gsink.external;
+	external = gsink.external;
 	if (gsink.rows && !hash_bin) {
 		// Simple mask
 		partition_mask.SetValidUnsafe(0);
@@ -1265,24 +1378,26 @@ void WindowLocalSourceState::GeneratePartition(WindowGlobalSinkState &gstate, co
 	for (idx_t expr_idx = 0; expr_idx < op.select_list.size(); ++expr_idx) {
 		D_ASSERT(op.select_list[expr_idx]->GetExpressionClass() == ExpressionClass::BOUND_WINDOW);
 		auto &wexpr = op.select_list[expr_idx]->Cast<BoundWindowExpression>();
-		auto wexec = make_uniq<WindowExecutor>(wexpr, context, partition_mask, count);
+		auto wexec = make_uniq<WindowExecutor>(wexpr, context, partition_mask, order_mask, count);
 		window_execs.emplace_back(std::move(wexec));
 	}
 
 	//	First pass over the input without flushing
 	//	TODO: Factor out the constructor data as global state
-	scanner = make_uniq<RowDataCollectionScanner>(*rows, *heap, layout, external, false);
+	DataChunk input_chunk;
+	input_chunk.Initialize(gsink.allocator, gsink.payload_types);
+	RowDataCollectionScanner scanner(*rows, *heap, layout, external, false);
 	idx_t input_idx = 0;
 	while (true) {
 		input_chunk.Reset();
-		scanner->Scan(input_chunk);
+		scanner.Scan(input_chunk);
 		if (input_chunk.size() == 0) {
 			break;
 		}
 
 		//	TODO: Parallelization opportunity
 		for (auto &wexec : window_execs) {
-			wexec->Sink(input_chunk, input_idx, scanner->Count());
+			wexec->Sink(input_chunk, input_idx, scanner.Count());
 		}
 		input_idx += input_chunk.size();
 	}
@@ -1293,10 +1408,187 @@ void WindowLocalSourceState::GeneratePartition(WindowGlobalSinkState &gstate, co
 	}
 
 	// External scanning assumes all blocks are swizzled.
-	scanner->ReSwizzle();
+	scanner.ReSwizzle();
+
+	//	Second pass reads the blocks independently
+	block_count = rows->blocks.size();
+	next_block = 0;
+
+	//	Find the partition and peer group starts of the blocks in a single pass,
+	//	only searching back to the start of the previous block
+	block_starts.clear();
+	WindowBlockStart prev {0, 0, 0};
+	for (idx_t block_idx = 0, row = 0; block_idx < block_count; row += rows->blocks[block_idx++]->count) {
+		WindowBlockStart start {row, 0, 0};
+		if (row > 0) {
+			idx_t n = 1;
+			start.partition_start = FindPrevStart(partition_mask, prev.row, row + 1, n);
+			if (start.partition_start == prev.row) {
+				start.partition_start = prev.partition_start;
+			}
+			n = 1;
+			start.peer_start = FindPrevStart(order_mask, MaxValue(start.partition_start, prev.row), row + 1, n);
+			if (start.peer_start == prev.row) {
+				start.peer_start = prev.peer_start;
+			}
+		}
+		block_starts.emplace_back(start);
+		prev = start;
+	}
+}
 
-	//	Second pass can flush
-	scanner->Reset(true);
+void WindowGlobalSourceState::FinishBuild(bool failed) {
+	vector<InterruptState> to_wake;
+	{
+		lock_guard<mutex> guard(lock);
+		--builds_active;
+		if (failed) {
+			stopped = true;
+		}
+		to_wake = std::move(blocked_tasks);
+		blocked_tasks.clear();
+	}
+	for (auto &interrupt_state : to_wake) {
+		interrupt_state.Callback();
+	}
+}
+
+SourceResultType WindowGlobalSourceState::NextTask(ClientContext &context, PartitionSourcePtr &partition,
+                                                   idx_t &block_idx, InterruptState &interrupt_state) {
+	idx_t hash_bin = 0;
+	{
+		lock_guard<mutex> guard(lock);
+		if (stopped) {
+			return SourceResultType::FINISHED;
+		}
+
+		//	Help read a built partition first, so they can be freed as soon as possible
+		if (!built.empty()) {
+			partition = built.front();
+			block_idx = partition->next_block++;
+			if (partition->next_block >= partition->block_count) {
+				built.erase(built.begin());
+			}
+			return SourceResultType::HAVE_MORE_OUTPUT;
+		}
+
+		//	Build the next partition
+		for (; next_build < bin_count; ++next_build) {
+			if (next_build >= gsink.hash_groups.size() || gsink.hash_groups[next_build]) {
+				break;
+			}
+		}
+		if (next_build >= bin_count) {
+			//	Nothing left to build or read
+			if (!builds_active) {
+				return SourceResultType::FINISHED;
+			}
+			//	Another thread is building a partition that we can help read once it is published
+			blocked_tasks.push_back(interrupt_state);
+			return SourceResultType::BLOCKED;
+		}
+		hash_bin = next_build++;
+		++builds_active;
+	}
+
+	auto new_partition = make_shared<WindowPartitionSourceState>(context, *this);
+	try {
+		new_partition->BuildPartition(gstate, hash_bin);
+	} catch (...) {
+		FinishBuild(true);
+		throw;
+	}
+
+	partition.reset();
+	block_idx = 0;
+	if (new_partition->block_count) {
+		//	Read the first block ourselves and publish the rest
+		partition = std::move(new_partition);
+		block_idx = partition->next_block++;
+		if (partition->next_block < partition->block_count) {
+			lock_guard<mutex> guard(lock);
+			built.emplace_back(partition);
+		}
+	}
+	//	An empty partition leaves the partition unset, so the caller tries again
+	FinishBuild(false);
+	return SourceResultType::HAVE_MORE_OUTPUT;
+}
+
+// Per-thread read state
+class WindowLocalSourceState : public LocalSourceState {
+public:
+	using PartitionSourcePtr = shared_ptr<WindowPartitionSourceState>;
+	using WindowExecutorStatePtr = unique_ptr<WindowExecutorState>;
+	using WindowExecutorStates = vector<WindowExecutorStatePtr>;
+
+	WindowLocalSourceState(const PhysicalWindow &op_p, ExecutionContext &context, WindowGlobalSourceState &gsource)
+	    : context(context.client), op(op_p) {
+
+		vector<LogicalType> output_types;
+		for (idx_t expr_idx = 0; expr_idx < op.select_list.size(); ++expr_idx) {
+			D_ASSERT(op.select_list[expr_idx]->GetExpressionClass() == ExpressionClass::BOUND_WINDOW);
+			auto &wexpr = op.select_list[expr_idx]->Cast<BoundWindowExpression>();
+			output_types.emplace_back(wexpr.return_type);
+		}
+		output_chunk.Initialize(Allocator::Get(context.client), output_types);
+
+		const auto &input_types = gsource.gsink.payload_types;
+		input_chunk.Initialize(gsource.gsink.allocator, input_types);
+	}
+
+	void BeginTask(PartitionSourcePtr partition_p, idx_t block_idx);
+	void EndTask();
+	void ReleasePartition();
+	void Scan(DataChunk &chunk);
+
+	ClientContext &context;
+	const PhysicalWindow &op;
+
+	//! The partition being read
+	PartitionSourcePtr partition;
+	//! The evaluation state for each function, kept while reading blocks of the same partition
+	WindowExecutorStates window_states;
+	//! The read cursor
+	unique_ptr<RowDataCollectionScanner> scanner;
+	//! Buffer for the inputs
+	DataChunk input_chunk;
+	//! Buffer for window results
+	DataChunk output_chunk;
+};
+
+void WindowLocalSourceState::BeginTask(PartitionSourcePtr partition_p, idx_t block_idx) {
+	//	The evaluation states (and their scratch space) are reused for all the blocks of a partition
+	if (partition != partition_p) {
+		window_states.clear();
+		partition = std::move(partition_p);
+		for (auto &wexec : partition->window_execs) {
+			window_states.emplace_back(wexec->GetLocalState(context));
+		}
+	}
+
+	//	Unless the block follows the previous one, we are starting in the middle of the partition
+	const auto &block_start = partition->block_starts[block_idx];
+	for (auto &wstate : window_states) {
+		if (wstate->next_row != block_start.row) {
+			wstate->bounds.partition_start = block_start.partition_start;
+			wstate->bounds.peer_start = block_start.peer_start;
+		}
+	}
+
+	//	Each block is read by exactly one thread, so it can be flushed as we go
+	scanner = make_uniq<RowDataCollectionScanner>(*partition->rows, *partition->heap, partition->layout,
+	                                              partition->external, block_idx, block_start.row, true);
+}
+
+void WindowLocalSourceState::EndTask() {
+	scanner.reset();
+}
+
+void WindowLocalSourceState::ReleasePartition() {
+	EndTask();
+	window_states.clear();
+	partition.reset();
 }
 
 void WindowLocalSourceState::Scan(DataChunk &result) {
@@ -1309,10 +1601,12 @@ void WindowLocalSourceState::Scan(DataChunk &result) {
 	input_chunk.Reset();
 	scanner->Scan(input_chunk);
 
+	auto &window_execs = partition->window_execs;
 	output_chunk.Reset();
 	for (idx_t expr_idx = 0; expr_idx < window_execs.size(); ++expr_idx) {
 		auto &executor = *window_execs[expr_idx];
-		executor.Evaluate(position, input_chunk, output_chunk.data[expr_idx], partition_mask, order_mask);
+		executor.Evaluate(*window_states[expr_idx], position, input_chunk, output_chunk.data[expr_idx],
+		                  partition->partition_mask, partition->order_mask);
 	}
 	output_chunk.SetCardinality(input_chunk);
 	output_chunk.Verify();
@@ -1336,40 +1630,44 @@ unique_ptr<LocalSourceState> PhysicalWindow::GetLocalSourceState(ExecutionContex
 
 unique_ptr<GlobalSourceState> PhysicalWindow::GetGlobalSourceState(ClientContext &context) const {
 	auto &gsink = sink_state->Cast<WindowGlobalSinkState>();
-	return make_uniq<WindowGlobalSourceState>(gsink);
+	return make_uniq<WindowGlobalSourceState>(*this, gsink);
 }
 
-void PhysicalWindow::GetData(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate_p,
-                             LocalSourceState &lstate_p) const {
-	auto &lsource = lstate_p.Cast<WindowLocalSourceState>();
-	auto &gsource = gstate_p.Cast<WindowGlobalSourceState>();
-	auto &gsink = sink_state->Cast<WindowGlobalSinkState>();
+void PhysicalWindow::GetData(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate,
+                             LocalSourceState &lstate) const {
+	// this caller cannot be interrupted: wait in place while other threads build the remaining partitions
+	auto done_signal = make_shared<InterruptDoneSignalState>();
+	InterruptState interrupt_state(done_signal);
+	OperatorSourceInput input {gstate, lstate, interrupt_state};
+	while (PollData(context, chunk, input) == SourceResultType::BLOCKED) {
+		done_signal->Await();
+	}
+}
 
-	auto &hash_groups = gsink.global_partition->hash_groups;
-	const auto bin_count = hash_groups.empty() ? 1 : hash_groups.size();
+SourceResultType PhysicalWindow::PollData(ExecutionContext &context, DataChunk &chunk,
+                                          OperatorSourceInput &input) const {
+	auto &lsource = input.local_state.Cast<WindowLocalSourceState>();
+	auto &gsource = input.global_state.Cast<WindowGlobalSourceState>();
 
 	while (chunk.size() == 0) {
-		//	Move to the next bin if we are done.
+		//	Move to the next block if we are done.
 		while (!lsource.scanner || !lsource.scanner->Remaining()) {
-			lsource.scanner.reset();
-			lsource.rows.reset();
-			lsource.heap.reset();
-			lsource.hash_group.reset();
-			auto hash_bin = gsource.next_bin++;
-			if (hash_bin >= bin_count) {
-				return;
+			lsource.EndTask();
+			WindowLocalSourceState::PartitionSourcePtr partition;
+			idx_t block_idx;
+			auto result = gsource.NextTask(context.client, partition, block_idx, input.interrupt_state);
+			if (result != SourceResultType::HAVE_MORE_OUTPUT) {
+				lsource.ReleasePartition();
+				return result;
 			}
-
-			for (; hash_bin < hash_groups.size(); hash_bin = gsource.next_bin++) {
-				if (hash_groups[hash_bin]) {
-					break;
-				}
+			if (partition) {
+				lsource.BeginTask(std::move(partition), block_idx);
 			}
-			lsource.GeneratePartition(gsink, hash_bin);
 		}
 
 		lsource.Scan(chunk);
 	}
+	return SourceResultType::HAVE_MORE_OUTPUT;
 }
 
 string PhysicalWindow::ParamsToString() const {
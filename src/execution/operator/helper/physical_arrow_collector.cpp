@@ -0,0 +1,169 @@
+#include "duckdb/execution/operator/helper/physical_arrow_collector.hpp"
+
+#include "duckdb/common/arrow/arrow_appender.hpp"
+#include "duckdb/common/arrow/arrow_query_result.hpp"
+#include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+PhysicalArrowCollector::PhysicalArrowCollector(PreparedStatementData &data, bool parallel, bool ordered,
+                                               idx_t batch_size, bool zero_copy)
+    : PhysicalResultCollector(data), parallel(parallel), ordered(ordered), batch_size(batch_size),
+      zero_copy(zero_copy) {
+	if (batch_size == 0) {
+		throw InvalidInputException("The batch size of the arrow record batches must be higher than 0");
+	}
+}
+
+unique_ptr<PhysicalResultCollector> PhysicalArrowCollector::Create(ClientContext &context,
+                                                                   PreparedStatementData &data, idx_t batch_size,
+                                                                   bool zero_copy) {
+	if (!PhysicalPlanGenerator::PreserveInsertionOrder(context, *data.plan)) {
+		// the plan is not order preserving: convert the chunks in parallel in any order
+		return make_uniq_base<PhysicalResultCollector, PhysicalArrowCollector>(data, true, false, batch_size,
+		                                                                       zero_copy);
+	} else if (!PhysicalPlanGenerator::UseBatchIndex(context, *data.plan)) {
+		// the plan is order preserving, but we cannot use the batch index: convert the chunks in a single thread
+		return make_uniq_base<PhysicalResultCollector, PhysicalArrowCollector>(data, false, false, batch_size,
+		                                                                       zero_copy);
+	} else {
+		// convert the chunks in parallel, and order the record batches by batch index
+		return make_uniq_base<PhysicalResultCollector, PhysicalArrowCollector>(data, true, true, batch_size,
+		                                                                       zero_copy);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+//! A record batch, and the batch index of the chunks it was produced from
+typedef pair<idx_t, unique_ptr<ArrowArrayWrapper>> arrow_record_batch_t;
+
+class ArrowCollectorGlobalState : public GlobalSinkState {
+public:
+	mutex glock;
+	vector<arrow_record_batch_t> arrays;
+	shared_ptr<ClientContext> context;
+};
+
+class ArrowCollectorLocalState : public LocalSinkState {
+public:
+	explicit ArrowCollectorLocalState(Allocator &allocator) : allocator(allocator), appender_rows(0) {
+	}
+
+	Allocator &allocator;
+	//! The record batch that is being constructed (if any), and the batch index of its chunks
+	unique_ptr<ArrowAppender> appender;
+	idx_t appender_rows;
+	idx_t appender_batch_index;
+	//! The record batches produced by this thread
+	vector<arrow_record_batch_t> arrays;
+
+public:
+	void AddArray(ArrowArray array, idx_t array_batch_index) {
+		auto wrapper = make_uniq<ArrowArrayWrapper>();
+		wrapper->arrow_array = array;
+		arrays.emplace_back(array_batch_index, std::move(wrapper));
+	}
+
+	void FinishArray() {
+		if (!appender) {
+			return;
+		}
+		AddArray(appender->Finalize(), appender_batch_index);
+		appender.reset();
+		appender_rows = 0;
+	}
+};
+
+SinkResultType PhysicalArrowCollector::Sink(ExecutionContext &context, GlobalSinkState &gstate_p,
+                                            LocalSinkState &lstate_p, DataChunk &input) const {
+	auto &state = lstate_p.Cast<ArrowCollectorLocalState>();
+	if (input.size() == 0) {
+		return SinkResultType::NEED_MORE_INPUT;
+	}
+	if (state.appender && state.appender_batch_index != state.batch_index) {
+		// a new batch has started: record batches never span multiple batches, so they can be ordered
+		state.FinishArray();
+	}
+	if (zero_copy && input.size() <= batch_size) {
+		// the rows of a record batch that is still under construction come before this chunk
+		state.FinishArray();
+		ArrowAppender appender(types, input.size());
+		appender.AppendZeroCopy(state.allocator, input);
+		state.AddArray(appender.Finalize(), state.batch_index);
+		return SinkResultType::NEED_MORE_INPUT;
+	}
+	idx_t offset = 0;
+	while (offset < input.size()) {
+		if (!state.appender) {
+			state.appender = make_uniq<ArrowAppender>(types, batch_size);
+			state.appender_batch_index = state.batch_index;
+		}
+		auto append_count = MinValue<idx_t>(batch_size - state.appender_rows, input.size() - offset);
+		state.appender->Append(input, offset, offset + append_count, input.size());
+		state.appender_rows += append_count;
+		offset += append_count;
+		if (state.appender_rows >= batch_size) {
+			state.FinishArray();
+		}
+	}
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+void PhysicalArrowCollector::Combine(ExecutionContext &context, GlobalSinkState &gstate_p,
+                                     LocalSinkState &lstate_p) const {
+	auto &gstate = gstate_p.Cast<ArrowCollectorGlobalState>();
+	auto &state = lstate_p.Cast<ArrowCollectorLocalState>();
+	state.FinishArray();
+	if (state.arrays.empty()) {
+		return;
+	}
+
+	lock_guard<mutex> lock(gstate.glock);
+	for (auto &array : state.arrays) {
+		gstate.arrays.push_back(std::move(array));
+	}
+	state.arrays.clear();
+}
+
+SinkFinalizeType PhysicalArrowCollector::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                  GlobalSinkState &gstate_p) const {
+	auto &gstate = gstate_p.Cast<ArrowCollectorGlobalState>();
+	if (ordered) {
+		// every batch is produced by a single thread, so the (stable) sort keeps the order within a batch intact
+		std::stable_sort(gstate.arrays.begin(), gstate.arrays.end(),
+		                 [](const arrow_record_batch_t &a, const arrow_record_batch_t &b) { return a.first < b.first; });
+	}
+	return SinkFinalizeType::READY;
+}
+
+unique_ptr<GlobalSinkState> PhysicalArrowCollector::GetGlobalSinkState(ClientContext &context) const {
+	auto state = make_uniq<ArrowCollectorGlobalState>();
+	state->context = context.shared_from_this();
+	return std::move(state);
+}
+
+unique_ptr<LocalSinkState> PhysicalArrowCollector::GetLocalSinkState(ExecutionContext &context) const {
+	return make_uniq<ArrowCollectorLocalState>(Allocator::Get(context.client));
+}
+
+unique_ptr<QueryResult> PhysicalArrowCollector::GetResult(GlobalSinkState &state) {
+	auto &gstate = state.Cast<ArrowCollectorGlobalState>();
+	vector<unique_ptr<ArrowArrayWrapper>> arrays;
+	arrays.reserve(gstate.arrays.size());
+	for (auto &array : gstate.arrays) {
+		arrays.push_back(std::move(array.second));
+	}
+	gstate.arrays.clear();
+	auto result = make_uniq<ArrowQueryResult>(statement_type, properties, names, types,
+	                                          gstate.context->GetClientProperties(), batch_size);
+	result->SetArrays(std::move(arrays));
+	return std::move(result);
+}
+
+} // namespace duckdb
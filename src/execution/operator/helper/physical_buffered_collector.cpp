@@ -0,0 +1,215 @@
+#include "duckdb/execution/operator/helper/physical_buffered_collector.hpp"
+
+#include "duckdb/common/deque.hpp"
+#include "duckdb/common/map.hpp"
+#include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/parallel/interrupt.hpp"
+#include "duckdb/parallel/pipeline.hpp"
+
+namespace duckdb {
+
+PhysicalBufferedCollector::PhysicalBufferedCollector(PreparedStatementData &data, bool parallel, bool ordered)
+    : PhysicalResultCollector(data), parallel(parallel), ordered(ordered) {
+}
+
+unique_ptr<PhysicalResultCollector> PhysicalBufferedCollector::Create(ClientContext &context,
+                                                                      PreparedStatementData &data) {
+	if (!PhysicalPlanGenerator::PreserveInsertionOrder(context, *data.plan)) {
+		// the plan is not order preserving: hand out the chunks in the order in which they are produced
+		return make_uniq_base<PhysicalResultCollector, PhysicalBufferedCollector>(data, true, false);
+	} else if (!PhysicalPlanGenerator::UseBatchIndex(context, *data.plan)) {
+		// the plan is order preserving, but we cannot use the batch index: produce the chunks in a single thread
+		return make_uniq_base<PhysicalResultCollector, PhysicalBufferedCollector>(data, false, false);
+	} else {
+		// produce the chunks in parallel, and hand them out in batch index order
+		return make_uniq_base<PhysicalResultCollector, PhysicalBufferedCollector>(data, true, true);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+struct BufferedChunk {
+	unique_ptr<DataChunk> chunk;
+	//! The (estimated) size of the chunk in bytes
+	idx_t size;
+};
+
+class BufferedCollectorGlobalState : public GlobalSinkState {
+public:
+	explicit BufferedCollectorGlobalState(idx_t capacity)
+	    : capacity(capacity), buffered_size(0), finished(false), minimum_batch_index(DConstants::INVALID_INDEX) {
+	}
+
+	mutex glock;
+	//! The maximum amount of bytes that are buffered before sinks are blocked
+	idx_t capacity;
+	//! The amount of bytes currently buffered
+	idx_t buffered_size;
+	//! Whether or not all chunks of the result have been buffered
+	bool finished;
+	//! The buffered chunks, if the order of the chunks does not matter
+	deque<BufferedChunk> chunks;
+	//! The buffered chunks per batch index, if the chunks are handed out in batch index order
+	map<idx_t, deque<BufferedChunk>> batches;
+	//! The minimum batch index that is still being produced by the pipeline
+	idx_t minimum_batch_index;
+	//! The sinks that are blocked until the buffer has room again
+	vector<InterruptState> blocked_sinks;
+
+public:
+	bool IsFull() const {
+		return buffered_size >= capacity;
+	}
+
+	//! Whether or not the chunks of the given batch can be handed out
+	bool CanEmit(idx_t batch_index) const {
+		return finished || minimum_batch_index == DConstants::INVALID_INDEX || batch_index <= minimum_batch_index;
+	}
+
+	bool HasChunkToEmit() const {
+		if (!chunks.empty()) {
+			return true;
+		}
+		return !batches.empty() && CanEmit(batches.begin()->first);
+	}
+
+	void UpdateMinimumBatchIndex(Pipeline &pipeline) {
+		minimum_batch_index = pipeline.GetMinimumBatchIndex();
+	}
+
+	void WakeUpSinks(vector<InterruptState> &result) {
+		result = std::move(blocked_sinks);
+		blocked_sinks.clear();
+	}
+};
+
+class BufferedCollectorLocalState : public LocalSinkState {};
+
+static idx_t EstimateChunkSize(DataChunk &chunk) {
+	idx_t row_width = 0;
+	for (auto &vec : chunk.data) {
+		row_width += GetTypeIdSize(vec.GetType().InternalType());
+	}
+	return MaxValue<idx_t>(chunk.size() * row_width, 1);
+}
+
+SinkResultType PhysicalBufferedCollector::Sink(ExecutionContext &context, GlobalSinkState &gstate_p,
+                                               LocalSinkState &lstate_p, DataChunk &input) const {
+	auto &gstate = gstate_p.Cast<BufferedCollectorGlobalState>();
+	auto &lstate = lstate_p.Cast<BufferedCollectorLocalState>();
+	if (input.size() == 0) {
+		return SinkResultType::NEED_MORE_INPUT;
+	}
+	// copy the chunk outside of the lock: the input is owned by the pipeline
+	BufferedChunk buffered;
+	buffered.chunk = make_uniq<DataChunk>();
+	buffered.chunk->Initialize(Allocator::Get(context.client), input.GetTypes(), input.size());
+	input.Copy(*buffered.chunk);
+	buffered.size = EstimateChunkSize(*buffered.chunk);
+
+	lock_guard<mutex> lock(gstate.glock);
+	gstate.buffered_size += buffered.size;
+	if (ordered) {
+		gstate.UpdateMinimumBatchIndex(*context.pipeline);
+		gstate.batches[lstate.batch_index].push_back(std::move(buffered));
+	} else {
+		gstate.chunks.push_back(std::move(buffered));
+	}
+	if (!gstate.IsFull() || !context.interrupt_state) {
+		return SinkResultType::NEED_MORE_INPUT;
+	}
+	if (ordered && gstate.CanEmit(lstate.batch_index)) {
+		// the client is waiting for the chunks of this batch: blocking this thread could block the query
+		return SinkResultType::NEED_MORE_INPUT;
+	}
+	// the buffer is full: block until the client has fetched enough chunks
+	gstate.blocked_sinks.push_back(*context.interrupt_state);
+	return SinkResultType::BLOCKED;
+}
+
+void PhysicalBufferedCollector::Combine(ExecutionContext &context, GlobalSinkState &gstate_p,
+                                        LocalSinkState &lstate_p) const {
+	auto &gstate = gstate_p.Cast<BufferedCollectorGlobalState>();
+	if (!ordered) {
+		return;
+	}
+	// the batch of this thread has been released: the chunks of later batches might be emittable now
+	lock_guard<mutex> lock(gstate.glock);
+	gstate.UpdateMinimumBatchIndex(*context.pipeline);
+}
+
+SinkFinalizeType PhysicalBufferedCollector::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                     GlobalSinkState &gstate_p) const {
+	auto &gstate = gstate_p.Cast<BufferedCollectorGlobalState>();
+	vector<InterruptState> blocked_sinks;
+	{
+		lock_guard<mutex> lock(gstate.glock);
+		gstate.finished = true;
+		gstate.WakeUpSinks(blocked_sinks);
+	}
+	for (auto &sink : blocked_sinks) {
+		sink.Callback();
+	}
+	return SinkFinalizeType::READY;
+}
+
+unique_ptr<GlobalSinkState> PhysicalBufferedCollector::GetGlobalSinkState(ClientContext &context) const {
+	return make_uniq<BufferedCollectorGlobalState>(ClientConfig::GetConfig(context).streaming_buffer_size);
+}
+
+unique_ptr<LocalSinkState> PhysicalBufferedCollector::GetLocalSinkState(ExecutionContext &context) const {
+	return make_uniq<BufferedCollectorLocalState>();
+}
+
+unique_ptr<QueryResult> PhysicalBufferedCollector::GetResult(GlobalSinkState &state) {
+	throw InternalException("PhysicalBufferedCollector streams its result: use FetchChunk instead of GetResult");
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+unique_ptr<DataChunk> PhysicalBufferedCollector::FetchChunk(GlobalSinkState &state, bool &finished) const {
+	auto &gstate = state.Cast<BufferedCollectorGlobalState>();
+	unique_ptr<DataChunk> result;
+	vector<InterruptState> blocked_sinks;
+	{
+		lock_guard<mutex> lock(gstate.glock);
+		finished = false;
+		BufferedChunk buffered;
+		if (!gstate.chunks.empty()) {
+			buffered = std::move(gstate.chunks.front());
+			gstate.chunks.pop_front();
+		} else if (!gstate.batches.empty() && gstate.CanEmit(gstate.batches.begin()->first)) {
+			auto entry = gstate.batches.begin();
+			buffered = std::move(entry->second.front());
+			entry->second.pop_front();
+			if (entry->second.empty()) {
+				gstate.batches.erase(entry);
+			}
+		} else {
+			finished = gstate.finished && gstate.chunks.empty() && gstate.batches.empty();
+			return nullptr;
+		}
+		gstate.buffered_size -= buffered.size;
+		result = std::move(buffered.chunk);
+		if (!gstate.IsFull()) {
+			gstate.WakeUpSinks(blocked_sinks);
+		}
+	}
+	for (auto &sink : blocked_sinks) {
+		sink.Callback();
+	}
+	return result;
+}
+
+bool PhysicalBufferedCollector::IsReady(GlobalSinkState &state) const {
+	auto &gstate = state.Cast<BufferedCollectorGlobalState>();
+	lock_guard<mutex> lock(gstate.glock);
+	return gstate.finished || gstate.IsFull() || gstate.HasChunkToEmit();
+}
+
+} // namespace duckdb
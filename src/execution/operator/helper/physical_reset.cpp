@@ -3,6 +3,7 @@
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/plan_cache.hpp"
 
 namespace duckdb {
 
@@ -21,6 +22,8 @@ void PhysicalReset::ResetExtensionVariable(ExecutionContext &context, DBConfig &
 
 void PhysicalReset::GetData(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate,
                             LocalSourceState &lstate) const {
+	// cached plans were made with the old settings
+	PlanCache::Get(context.client).Clear();
 	auto option = DBConfig::GetOptionByName(name);
 	if (!option) {
 		// check if this is an extra extension variable
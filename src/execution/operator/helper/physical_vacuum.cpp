@@ -2,7 +2,9 @@
 
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/main/plan_cache.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
+#include "duckdb/storage/statistics/file_statistics_catalog.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 
 namespace duckdb {
@@ -12,15 +14,144 @@ PhysicalVacuum::PhysicalVacuum(unique_ptr<VacuumInfo> info_p, idx_t estimated_ca
       info(std::move(info_p)) {
 }
 
+//! The row count, min/max statistics and NULL counts computed when analyzing a scan of files
+struct VacuumFileStatistics {
+	explicit VacuumFileStatistics(VacuumInfo &info) : row_count(0) {
+		if (info.file_statistics_key.empty()) {
+			return;
+		}
+		for (auto &type : info.types) {
+			column_stats.push_back(BaseStatistics::CreateEmpty(type).ToUnique());
+			null_counts.push_back(0);
+		}
+	}
+
+	idx_t row_count;
+	vector<unique_ptr<BaseStatistics>> column_stats;
+	vector<idx_t> null_counts;
+
+public:
+	void Update(DataChunk &input);
+	void Merge(VacuumFileStatistics &other) {
+		row_count += other.row_count;
+		for (idx_t col_idx = 0; col_idx < column_stats.size(); col_idx++) {
+			column_stats[col_idx]->Merge(*other.column_stats[col_idx]);
+			null_counts[col_idx] += other.null_counts[col_idx];
+		}
+	}
+};
+
+template <class T>
+static void UpdateMinMax(BaseStatistics &stats, UnifiedVectorFormat &vdata, idx_t count) {
+	auto data = (T *)vdata.data;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (vdata.validity.RowIsValid(idx)) {
+			NumericStats::Update<T>(stats, data[idx]);
+		}
+	}
+}
+
+static void UpdateStringMinMax(BaseStatistics &stats, UnifiedVectorFormat &vdata, idx_t count) {
+	auto data = (string_t *)vdata.data;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (vdata.validity.RowIsValid(idx)) {
+			StringStats::Update(stats, data[idx]);
+		}
+	}
+}
+
+//! Updates the min/max statistics of a column, returns false if they cannot be computed for its type
+static bool UpdateMinMax(BaseStatistics &stats, UnifiedVectorFormat &vdata, idx_t count) {
+	auto &type = stats.GetType();
+	if (stats.GetStatsType() == StatisticsType::STRING_STATS) {
+		UpdateStringMinMax(stats, vdata, count);
+		return true;
+	}
+	if (stats.GetStatsType() != StatisticsType::NUMERIC_STATS) {
+		return false;
+	}
+	switch (type.InternalType()) {
+	case PhysicalType::BOOL:
+		UpdateMinMax<bool>(stats, vdata, count);
+		break;
+	case PhysicalType::INT8:
+		UpdateMinMax<int8_t>(stats, vdata, count);
+		break;
+	case PhysicalType::INT16:
+		UpdateMinMax<int16_t>(stats, vdata, count);
+		break;
+	case PhysicalType::INT32:
+		UpdateMinMax<int32_t>(stats, vdata, count);
+		break;
+	case PhysicalType::INT64:
+		UpdateMinMax<int64_t>(stats, vdata, count);
+		break;
+	case PhysicalType::UINT8:
+		UpdateMinMax<uint8_t>(stats, vdata, count);
+		break;
+	case PhysicalType::UINT16:
+		UpdateMinMax<uint16_t>(stats, vdata, count);
+		break;
+	case PhysicalType::UINT32:
+		UpdateMinMax<uint32_t>(stats, vdata, count);
+		break;
+	case PhysicalType::UINT64:
+		UpdateMinMax<uint64_t>(stats, vdata, count);
+		break;
+	case PhysicalType::INT128:
+		UpdateMinMax<hugeint_t>(stats, vdata, count);
+		break;
+	case PhysicalType::FLOAT:
+		UpdateMinMax<float>(stats, vdata, count);
+		break;
+	case PhysicalType::DOUBLE:
+		UpdateMinMax<double>(stats, vdata, count);
+		break;
+	default:
+		return false;
+	}
+	return true;
+}
+
+void VacuumFileStatistics::Update(DataChunk &input) {
+	row_count += input.size();
+	for (idx_t col_idx = 0; col_idx < column_stats.size(); col_idx++) {
+		auto &stats = column_stats[col_idx];
+		UnifiedVectorFormat vdata;
+		input.data[col_idx].ToUnifiedFormat(input.size(), vdata);
+		idx_t valid_count = input.size();
+		if (!vdata.validity.AllValid()) {
+			valid_count = 0;
+			for (idx_t i = 0; i < input.size(); i++) {
+				valid_count += vdata.validity.RowIsValid(vdata.sel->get_index(i));
+			}
+		}
+		null_counts[col_idx] += input.size() - valid_count;
+		if (valid_count < input.size()) {
+			stats->SetHasNull();
+		}
+		if (valid_count > 0) {
+			stats->SetHasNoNull();
+		}
+		if (!UpdateMinMax(*stats, vdata, input.size())) {
+			// only the NULL counts and distinct counts are known for this type
+			stats = BaseStatistics::CreateUnknown(stats->GetType()).ToUnique();
+		}
+	}
+}
+
 class VacuumLocalSinkState : public LocalSinkState {
 public:
-	explicit VacuumLocalSinkState(VacuumInfo &info) {
+	explicit VacuumLocalSinkState(VacuumInfo &info) : file_stats(info) {
 		for (idx_t col_idx = 0; col_idx < info.columns.size(); col_idx++) {
 			column_distinct_stats.push_back(make_uniq<DistinctStatistics>());
 		}
 	};
 
 	vector<unique_ptr<DistinctStatistics>> column_distinct_stats;
+	VacuumFileStatistics file_stats;
 };
 
 unique_ptr<LocalSinkState> PhysicalVacuum::GetLocalSinkState(ExecutionContext &context) const {
@@ -29,7 +160,7 @@ unique_ptr<LocalSinkState> PhysicalVacuum::GetLocalSinkState(ExecutionContext &c
 
 class VacuumGlobalSinkState : public GlobalSinkState {
 public:
-	explicit VacuumGlobalSinkState(VacuumInfo &info) {
+	explicit VacuumGlobalSinkState(VacuumInfo &info) : file_stats(info) {
 		for (idx_t col_idx = 0; col_idx < info.columns.size(); col_idx++) {
 			column_distinct_stats.push_back(make_uniq<DistinctStatistics>());
 		}
@@ -37,6 +168,7 @@ public:
 
 	mutex stats_lock;
 	vector<unique_ptr<DistinctStatistics>> column_distinct_stats;
+	VacuumFileStatistics file_stats;
 };
 
 unique_ptr<GlobalSinkState> PhysicalVacuum::GetGlobalSinkState(ClientContext &context) const {
@@ -46,7 +178,8 @@ unique_ptr<GlobalSinkState> PhysicalVacuum::GetGlobalSinkState(ClientContext &co
 SinkResultType PhysicalVacuum::Sink(ExecutionContext &context, GlobalSinkState &gstate_p, LocalSinkState &lstate_p,
                                     DataChunk &input) const {
 	auto &lstate = lstate_p.Cast<VacuumLocalSinkState>();
-	D_ASSERT(lstate.column_distinct_stats.size() == info->column_id_map.size());
+	D_ASSERT(lstate.column_distinct_stats.size() == info->column_id_map.size() ||
+	         !info->file_statistics_key.empty());
 
 	for (idx_t col_idx = 0; col_idx < input.data.size(); col_idx++) {
 		if (!DistinctStatistics::TypeIsSupported(input.data[col_idx].GetType())) {
@@ -54,6 +187,7 @@ SinkResultType PhysicalVacuum::Sink(ExecutionContext &context, GlobalSinkState &
 		}
 		lstate.column_distinct_stats[col_idx]->Update(input.data[col_idx], input.size(), false);
 	}
+	lstate.file_stats.Update(input);
 
 	return SinkResultType::NEED_MORE_INPUT;
 }
@@ -67,12 +201,34 @@ void PhysicalVacuum::Combine(ExecutionContext &context, GlobalSinkState &gstate_
 	for (idx_t col_idx = 0; col_idx < gstate.column_distinct_stats.size(); col_idx++) {
 		gstate.column_distinct_stats[col_idx]->Merge(*lstate.column_distinct_stats[col_idx]);
 	}
+	gstate.file_stats.Merge(lstate.file_stats);
 }
 
 SinkFinalizeType PhysicalVacuum::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                           GlobalSinkState &gstate) const {
 	auto &sink = gstate.Cast<VacuumGlobalSinkState>();
 
+	if (!info->file_statistics_key.empty()) {
+		// store the statistics of the files in the catalog
+		auto stats = make_shared<FileStatistics>();
+		stats->row_count = sink.file_stats.row_count;
+		stats->names = info->columns;
+		stats->types = info->types;
+		stats->column_stats = std::move(sink.file_stats.column_stats);
+		stats->null_counts = std::move(sink.file_stats.null_counts);
+		for (idx_t col_idx = 0; col_idx < sink.column_distinct_stats.size(); col_idx++) {
+			if (!DistinctStatistics::TypeIsSupported(info->types[col_idx])) {
+				stats->distinct_stats.push_back(nullptr);
+				continue;
+			}
+			stats->distinct_stats.push_back(std::move(sink.column_distinct_stats[col_idx]));
+		}
+		FileStatisticsCatalog::Get(context).SetStatistics(context, info->file_statistics_key, std::move(stats));
+		// plans that were cached before the files were analyzed do not use the statistics
+		PlanCache::Get(context).Clear();
+		return SinkFinalizeType::READY;
+	}
+
 	auto table = info->table;
 	for (idx_t col_idx = 0; col_idx < sink.column_distinct_stats.size(); col_idx++) {
 		table->GetStorage().SetDistinct(info->column_id_map.at(col_idx),
@@ -7,6 +7,7 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/parallel/base_pipeline_event.hpp"
+#include "duckdb/parallel/morsel_sizing.hpp"
 #include "duckdb/parallel/pipeline.hpp"
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
@@ -410,6 +411,17 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	return SinkFinalizeType::READY;
 }
 
+idx_t PhysicalHashJoin::GetBuildCardinality() const {
+	if (!sink_state) {
+		return DConstants::INVALID_INDEX;
+	}
+	auto &sink = sink_state->Cast<HashJoinGlobalSinkState>();
+	if (!sink.finalized || sink.external) {
+		return DConstants::INVALID_INDEX;
+	}
+	return sink.hash_table->Count();
+}
+
 //===--------------------------------------------------------------------===//
 // Operator
 //===--------------------------------------------------------------------===//
@@ -548,6 +560,7 @@ public:
 	idx_t build_chunk_count;
 	idx_t build_chunk_done;
 	idx_t build_chunks_per_thread;
+	idx_t build_thread_count;
 
 	//! For probe synchronization
 	idx_t probe_chunk_count;
@@ -562,6 +575,7 @@ public:
 	idx_t full_outer_chunk_count;
 	idx_t full_outer_chunk_done;
 	idx_t full_outer_chunks_per_thread;
+	idx_t full_outer_thread_count;
 };
 
 class HashJoinLocalSourceState : public LocalSourceState {
@@ -687,6 +701,7 @@ void HashJoinGlobalSourceState::PrepareBuild(HashJoinGlobalSinkState &sink) {
 
 	auto num_threads = TaskScheduler::GetScheduler(sink.context).NumberOfThreads();
 	build_chunks_per_thread = MaxValue<idx_t>((build_chunk_count + num_threads - 1) / num_threads, 1);
+	build_thread_count = num_threads;
 
 	ht.InitializePointerTable();
 
@@ -718,6 +733,7 @@ void HashJoinGlobalSourceState::PrepareScanHT(HashJoinGlobalSinkState &sink) {
 
 	auto num_threads = TaskScheduler::GetScheduler(sink.context).NumberOfThreads();
 	full_outer_chunks_per_thread = MaxValue<idx_t>((full_outer_chunk_count + num_threads - 1) / num_threads, 1);
+	full_outer_thread_count = num_threads;
 
 	global_stage = HashJoinSourceStage::SCAN_HT;
 }
@@ -731,7 +747,9 @@ bool HashJoinGlobalSourceState::AssignTask(HashJoinGlobalSinkState &sink, HashJo
 		if (build_chunk_idx != build_chunk_count) {
 			lstate.local_stage = global_stage;
 			lstate.build_chunk_idx_from = build_chunk_idx;
-			build_chunk_idx = MinValue<idx_t>(build_chunk_count, build_chunk_idx + build_chunks_per_thread);
+			// the chunks are handed out in shrinking morsels, so the last morsels are divided among idle threads
+			build_chunk_idx += MorselSizing::NextMorselSize(build_chunk_count - build_chunk_idx, build_thread_count,
+			                                                build_chunks_per_thread);
 			lstate.build_chunk_idx_to = build_chunk_idx;
 			return true;
 		}
@@ -747,8 +765,8 @@ bool HashJoinGlobalSourceState::AssignTask(HashJoinGlobalSinkState &sink, HashJo
 		if (full_outer_chunk_idx != full_outer_chunk_count) {
 			lstate.local_stage = global_stage;
 			lstate.full_outer_chunk_idx_from = full_outer_chunk_idx;
-			full_outer_chunk_idx =
-			    MinValue<idx_t>(full_outer_chunk_count, full_outer_chunk_idx + full_outer_chunks_per_thread);
+			full_outer_chunk_idx += MorselSizing::NextMorselSize(full_outer_chunk_count - full_outer_chunk_idx,
+			                                                     full_outer_thread_count, full_outer_chunks_per_thread);
 			lstate.full_outer_chunk_idx_to = full_outer_chunk_idx;
 			return true;
 		}
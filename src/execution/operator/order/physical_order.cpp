@@ -110,15 +110,21 @@ void PhysicalOrder::Combine(ExecutionContext &context, GlobalSinkState &gstate_p
 
 class PhysicalOrderMergeTask : public ExecutorTask {
 public:
-	PhysicalOrderMergeTask(shared_ptr<Event> event_p, ClientContext &context, OrderGlobalSinkState &state)
-	    : ExecutorTask(context), event(std::move(event_p)), context(context), state(state) {
+	PhysicalOrderMergeTask(shared_ptr<Event> event_p, ClientContext &context, OrderGlobalSinkState &state,
+	                       bool kway_merge)
+	    : ExecutorTask(context), event(std::move(event_p)), context(context), state(state), kway_merge(kway_merge) {
 	}
 
 	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
 		// Initialize merge sorted and iterate until done
 		auto &global_sort_state = state.global_sort_state;
-		MergeSorter merge_sorter(global_sort_state, BufferManager::GetBufferManager(context));
-		merge_sorter.PerformInMergeRound();
+		if (kway_merge) {
+			KWayMergeSorter merge_sorter(global_sort_state, BufferManager::GetBufferManager(context));
+			merge_sorter.PerformKWayMerge();
+		} else {
+			MergeSorter merge_sorter(global_sort_state, BufferManager::GetBufferManager(context));
+			merge_sorter.PerformInMergeRound();
+		}
 		event->FinishTask();
 		return TaskExecutionResult::TASK_FINISHED;
 	}
@@ -127,15 +133,18 @@ private:
 	shared_ptr<Event> event;
 	ClientContext &context;
 	OrderGlobalSinkState &state;
+	//! Whether this task merges partitions of a k-way merge, or pairs of a cascaded merge round
+	bool kway_merge;
 };
 
 class OrderMergeEvent : public BasePipelineEvent {
 public:
-	OrderMergeEvent(OrderGlobalSinkState &gstate_p, Pipeline &pipeline_p)
-	    : BasePipelineEvent(pipeline_p), gstate(gstate_p) {
+	OrderMergeEvent(OrderGlobalSinkState &gstate_p, Pipeline &pipeline_p, bool kway_merge_p)
+	    : BasePipelineEvent(pipeline_p), gstate(gstate_p), kway_merge(kway_merge_p) {
 	}
 
 	OrderGlobalSinkState &gstate;
+	bool kway_merge;
 
 public:
 	void Schedule() override {
@@ -147,7 +156,7 @@ public:
 
 		vector<unique_ptr<Task>> merge_tasks;
 		for (idx_t tnum = 0; tnum < num_threads; tnum++) {
-			merge_tasks.push_back(make_uniq<PhysicalOrderMergeTask>(shared_from_this(), context, gstate));
+			merge_tasks.push_back(make_uniq<PhysicalOrderMergeTask>(shared_from_this(), context, gstate, kway_merge));
 		}
 		SetTasks(std::move(merge_tasks));
 	}
@@ -155,6 +164,10 @@ public:
 	void FinishEvent() override {
 		auto &global_sort_state = gstate.global_sort_state;
 
+		if (kway_merge) {
+			global_sort_state.CompleteKWayMerge();
+			return;
+		}
 		global_sort_state.CompleteMergeRound();
 		if (global_sort_state.sorted_blocks.size() > 1) {
 			// Multiple blocks remaining: Schedule the next round
@@ -184,9 +197,20 @@ SinkFinalizeType PhysicalOrder::Finalize(Pipeline &pipeline, Event &event, Clien
 }
 
 void PhysicalOrder::ScheduleMergeTasks(Pipeline &pipeline, Event &event, OrderGlobalSinkState &state) {
-	// Initialize global sort state for a round of merging
-	state.global_sort_state.InitializeMergeRound();
-	auto new_event = make_shared<OrderMergeEvent>(state, pipeline);
+	auto &global_sort_state = state.global_sort_state;
+	auto &ts = TaskScheduler::GetScheduler(pipeline.GetClientContext());
+	const idx_t num_threads = ts.NumberOfThreads();
+	// Merge all sorted blocks in a single pass if every thread can keep a block of each of them pinned,
+	// otherwise do a cascaded merge round first to reduce the number of sorted blocks
+	const bool kway_merge = global_sort_state.sorted_blocks.size() <= global_sort_state.KWayMergeFanIn(num_threads);
+	if (kway_merge) {
+		// Create more partitions than threads so that skewed partitions are balanced out
+		global_sort_state.InitializeKWayMerge(num_threads * 4);
+	} else {
+		// Initialize global sort state for a round of merging
+		global_sort_state.InitializeMergeRound();
+	}
+	auto new_event = make_shared<OrderMergeEvent>(state, pipeline, kway_merge);
 	event.InsertEvent(std::move(new_event));
 }
 
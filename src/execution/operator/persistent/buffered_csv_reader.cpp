@@ -7,6 +7,7 @@
 #include "duckdb/common/types/cast_helpers.hpp"
 #include "duckdb/common/vector_operations/unary_executor.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/operator/persistent/csv_character_scanner.hpp"
 #include "duckdb/function/scalar/strftime.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/parser/column_definition.hpp"
@@ -1208,6 +1209,9 @@ bool BufferedCSVReader::TryParseSimpleCSV(DataChunk &insert_chunk, string &error
 	idx_t offset = 0;
 	bool has_quotes = false;
 	vector<idx_t> escape_positions;
+	// the characters that end an unquoted and a quoted value respectively
+	const CSVCharacterScanner value_scanner({options.delimiter[0], '\n', '\r'});
+	const CSVCharacterScanner quoted_scanner({options.quote[0], options.escape[0]});
 
 	idx_t line_start = position;
 	// read values into the buffer (if any)
@@ -1238,6 +1242,11 @@ normal:
 	// this state parses the remainder of a non-quoted value until we reach a delimiter or newline
 	do {
 		for (; position < buffer_size; position++) {
+			// skip over the characters that cannot end the value in bulk
+			position = value_scanner.Find(buffer.get(), position, buffer_size);
+			if (position == buffer_size) {
+				break;
+			}
 			if (buffer[position] == options.delimiter[0]) {
 				// delimiter: end the value and add it to the chunk
 				goto add_value;
@@ -1311,6 +1320,10 @@ in_quotes:
 	position++;
 	do {
 		for (; position < buffer_size; position++) {
+			position = quoted_scanner.Find(buffer.get(), position, buffer_size);
+			if (position == buffer_size) {
+				break;
+			}
 			if (buffer[position] == options.quote[0]) {
 				// quote: move to unquoted state
 				goto unquote;
@@ -0,0 +1,85 @@
+#include "duckdb/execution/operator/persistent/csv_character_scanner.hpp"
+
+#include "duckdb/common/exception.hpp"
+
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <emmintrin.h>
+#define DUCKDB_CSV_SCANNER_SSE2
+#endif
+
+namespace duckdb {
+
+CSVCharacterScanner::CSVCharacterScanner(const vector<char> &characters_p) {
+	if (characters_p.empty() || characters_p.size() > MAX_CHARACTERS) {
+		throw InternalException("CSVCharacterScanner requires between 1 and %llu characters", MAX_CHARACTERS);
+	}
+	memset(is_special, 0, sizeof(is_special));
+	for (idx_t i = 0; i < MAX_CHARACTERS; i++) {
+		characters[i] = i < characters_p.size() ? characters_p[i] : characters_p[0];
+		is_special[(uint8_t)characters[i]] = true;
+		memset(patterns[i], characters[i], sizeof(patterns[i]));
+	}
+}
+
+#ifdef DUCKDB_CSV_SCANNER_SSE2
+//! Returns a 16-bit mask with the bytes of the block that equal any of the characters
+static inline uint64_t ClassifyBlock(const char *block, const __m128i *patterns) {
+	const auto data = _mm_loadu_si128((const __m128i *)block);
+	auto matches = _mm_cmpeq_epi8(data, patterns[0]);
+	for (idx_t i = 1; i < CSVCharacterScanner::MAX_CHARACTERS; i++) {
+		matches = _mm_or_si128(matches, _mm_cmpeq_epi8(data, patterns[i]));
+	}
+	return (uint64_t)(uint32_t)_mm_movemask_epi8(matches);
+}
+#endif
+
+idx_t CSVCharacterScanner::Find(const char *buffer, idx_t start, idx_t end) const {
+	idx_t position = start;
+#ifdef DUCKDB_CSV_SCANNER_SSE2
+	static constexpr idx_t BLOCK_SIZE = 64;
+	static constexpr idx_t VECTOR_SIZE = 16;
+	__m128i pattern_vectors[MAX_CHARACTERS];
+	for (idx_t i = 0; i < MAX_CHARACTERS; i++) {
+		pattern_vectors[i] = _mm_loadu_si128((const __m128i *)patterns[i]);
+	}
+	// Classify 64 bytes at a time into a bitmask, and jump to the first special character
+	for (; position + BLOCK_SIZE <= end; position += BLOCK_SIZE) {
+		const char *block = buffer + position;
+		const uint64_t mask = ClassifyBlock(block, pattern_vectors) |
+		                      (ClassifyBlock(block + 16, pattern_vectors) << 16) |
+		                      (ClassifyBlock(block + 32, pattern_vectors) << 32) |
+		                      (ClassifyBlock(block + 48, pattern_vectors) << 48);
+		if (mask != 0) {
+			return position + __builtin_ctzll(mask);
+		}
+	}
+	// The tail is classified 16 bytes at a time
+	for (; position + VECTOR_SIZE <= end; position += VECTOR_SIZE) {
+		const uint64_t mask = ClassifyBlock(buffer + position, pattern_vectors);
+		if (mask != 0) {
+			return position + __builtin_ctzll(mask);
+		}
+	}
+	if (position < end) {
+		// Fewer than 16 bytes remain: we cannot read past the end, so copy them into a padded block and mask out the
+		// bytes beyond the end
+		const idx_t remaining = end - position;
+		char block[VECTOR_SIZE] = {};
+		memcpy(block, buffer + position, remaining);
+		const uint64_t mask = ClassifyBlock(block, pattern_vectors) & ((uint64_t(1) << remaining) - 1);
+		return mask != 0 ? position + __builtin_ctzll(mask) : end;
+	}
+	return position;
+#else
+	for (; position < end; position++) {
+		if (is_special[(uint8_t)buffer[position]]) {
+			break;
+		}
+	}
+	return position;
+#endif
+}
+
+} // namespace duckdb
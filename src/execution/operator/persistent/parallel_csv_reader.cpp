@@ -270,6 +270,9 @@ bool ParallelCSVReader::TryParseSimpleCSV(DataChunk &insert_chunk, string &error
 	bool has_quotes = false;
 
 	vector<idx_t> escape_positions;
+	// the characters that end an unquoted and a quoted value respectively
+	const CSVCharacterScanner value_scanner({options.delimiter[0], options.quote[0], '\n', '\r'});
+	const CSVCharacterScanner quoted_scanner({options.quote[0], options.escape[0]});
 	if ((start_buffer == buffer->buffer_start || start_buffer == buffer->buffer_end) && !try_add_line) {
 		// First time reading this buffer piece
 		if (!SetPosition(insert_chunk)) {
@@ -311,6 +314,11 @@ normal : {
 	/* state: normal parsing state */
 	// this state parses the remainder of a non-quoted value until we reach a delimiter or newline
 	for (; position_buffer < end_buffer; position_buffer++) {
+		// skip over the characters that cannot end the value in bulk
+		position_buffer = buffer->Find(value_scanner, position_buffer, end_buffer);
+		if (position_buffer == end_buffer) {
+			break;
+		}
 		auto c = (*buffer)[position_buffer];
 		if (c == options.delimiter[0]) {
 			// delimiter: end the value and add it to the chunk
@@ -430,6 +438,10 @@ in_quotes:
 	has_quotes = true;
 	position_buffer++;
 	for (; position_buffer < end_buffer; position_buffer++) {
+		position_buffer = buffer->Find(quoted_scanner, position_buffer, end_buffer);
+		if (position_buffer == end_buffer) {
+			break;
+		}
 		auto c = (*buffer)[position_buffer];
 		if (c == options.quote[0]) {
 			// quote: move to unquoted state
@@ -15,29 +15,57 @@ PhysicalColumnDataScan::PhysicalColumnDataScan(vector<LogicalType> types, Physic
 
 class PhysicalColumnDataScanState : public GlobalSourceState {
 public:
-	explicit PhysicalColumnDataScanState() : initialized(false) {
+	explicit PhysicalColumnDataScanState(const PhysicalColumnDataScan &op) : op(op), initialized(false) {
 	}
 
-	//! The current position in the scan
-	ColumnDataScanState scan_state;
-	bool initialized;
+	const PhysicalColumnDataScan &op;
+	//! The current position in the scan: every chunk is handed out to a thread as a separate morsel
+	ColumnDataParallelScanState scan_state;
+	mutex lock;
+	atomic<bool> initialized;
+
+public:
+	idx_t MaxThreads() override {
+		return op.collection ? MaxValue<idx_t>(op.collection->ChunkCount(), 1) : 1;
+	}
+};
+
+class PhysicalColumnDataScanLocalState : public LocalSourceState {
+public:
+	ColumnDataLocalScanState scan_state;
 };
 
 unique_ptr<GlobalSourceState> PhysicalColumnDataScan::GetGlobalSourceState(ClientContext &context) const {
-	return make_uniq<PhysicalColumnDataScanState>();
+	return make_uniq<PhysicalColumnDataScanState>(*this);
 }
 
-void PhysicalColumnDataScan::GetData(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate,
-                                     LocalSourceState &lstate) const {
-	auto &state = gstate.Cast<PhysicalColumnDataScanState>();
+unique_ptr<LocalSourceState> PhysicalColumnDataScan::GetLocalSourceState(ExecutionContext &context,
+                                                                         GlobalSourceState &gstate) const {
+	return make_uniq<PhysicalColumnDataScanLocalState>();
+}
+
+void PhysicalColumnDataScan::GetData(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate_p,
+                                     LocalSourceState &lstate_p) const {
+	auto &gstate = gstate_p.Cast<PhysicalColumnDataScanState>();
+	auto &lstate = lstate_p.Cast<PhysicalColumnDataScanLocalState>();
 	if (collection->Count() == 0) {
 		return;
 	}
-	if (!state.initialized) {
-		collection->InitializeScan(state.scan_state);
-		state.initialized = true;
+	if (!gstate.initialized) {
+		// the collection can be filled after the source state is created: initialize the scan on first use
+		lock_guard<mutex> guard(gstate.lock);
+		if (!gstate.initialized) {
+			collection->InitializeScan(gstate.scan_state);
+			gstate.initialized = true;
+		}
 	}
-	collection->Scan(state.scan_state, chunk);
+	collection->Scan(gstate.scan_state, lstate.scan_state, chunk);
+}
+
+idx_t PhysicalColumnDataScan::GetBatchIndex(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate,
+                                            LocalSourceState &lstate_p) const {
+	auto &lstate = lstate_p.Cast<PhysicalColumnDataScanLocalState>();
+	return lstate.scan_state.current_row_index;
 }
 
 //===--------------------------------------------------------------------===//
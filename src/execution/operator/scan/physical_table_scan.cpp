@@ -73,14 +73,31 @@ unique_ptr<GlobalSourceState> PhysicalTableScan::GetGlobalSourceState(ClientCont
 	return make_uniq<TableScanGlobalSourceState>(context, *this);
 }
 
-void PhysicalTableScan::GetData(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate_p,
+void PhysicalTableScan::GetData(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate,
                                 LocalSourceState &lstate) const {
+	// this caller cannot be interrupted: wait in place while the function is blocked
+	auto done_signal = make_shared<InterruptDoneSignalState>();
+	InterruptState interrupt_state(done_signal);
+	OperatorSourceInput input {gstate, lstate, interrupt_state};
+	while (PollData(context, chunk, input) == SourceResultType::BLOCKED) {
+		done_signal->Await();
+	}
+}
+
+SourceResultType PhysicalTableScan::PollData(ExecutionContext &context, DataChunk &chunk,
+                                             OperatorSourceInput &input) const {
 	D_ASSERT(!column_ids.empty());
-	auto &gstate = gstate_p.Cast<TableScanGlobalSourceState>();
-	auto &state = lstate.Cast<TableScanLocalSourceState>();
+	auto &gstate = input.global_state.Cast<TableScanGlobalSourceState>();
+	auto &state = input.local_state.Cast<TableScanLocalSourceState>();
 
 	TableFunctionInput data(bind_data.get(), state.local_state.get(), gstate.global_state.get());
+	data.interrupt_state = &input.interrupt_state;
 	function.function(context.client, data, chunk);
+	if (data.blocked) {
+		D_ASSERT(chunk.size() == 0);
+		return SourceResultType::BLOCKED;
+	}
+	return chunk.size() == 0 ? SourceResultType::FINISHED : SourceResultType::HAVE_MORE_OUTPUT;
 }
 
 double PhysicalTableScan::GetProgress(ClientContext &context, GlobalSourceState &gstate_p) const {
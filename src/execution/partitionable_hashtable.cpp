@@ -1,6 +1,7 @@
 #include "duckdb/execution/partitionable_hashtable.hpp"
 
 #include "duckdb/common/radix_partitioning.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
 
@@ -21,7 +22,8 @@ PartitionableHashTable::PartitionableHashTable(ClientContext &context, Allocator
                                                vector<BoundAggregateExpression *> bindings_p)
     : context(context), allocator(allocator), group_types(std::move(group_types_p)),
       payload_types(std::move(payload_types_p)), bindings(std::move(bindings_p)), is_partitioned(false),
-      partition_info(partition_info_p), hashes(LogicalType::HASH), hashes_subset(LogicalType::HASH) {
+      partition_info(partition_info_p), hashes(LogicalType::HASH), hashes_subset(LogicalType::HASH),
+      partitioned_tuple_count(0), partitioned_group_count(0) {
 
 	sel_vectors.resize(partition_info.n_partitions);
 	sel_vector_sizes.resize(partition_info.n_partitions);
@@ -68,6 +70,11 @@ idx_t PartitionableHashTable::AddChunk(DataChunk &groups, DataChunk &payload, bo
                                        const vector<idx_t> &filter) {
 	groups.Hash(hashes);
 
+	if (bypass_data) {
+		BypassAddChunk(groups, payload);
+		return 0;
+	}
+
 	// we partition when we are asked to or when the unpartitioned ht runs out of space
 	if (!IsPartitioned() && do_partition) {
 		Partition();
@@ -114,9 +121,84 @@ idx_t PartitionableHashTable::AddChunk(DataChunk &groups, DataChunk &payload, bo
 
 		group_count += ListAddChunk(radix_partitioned_hts[r], group_subset, hashes_subset, payload_subset, filter);
 	}
+
+	partitioned_tuple_count += groups.size();
+	partitioned_group_count += group_count;
+	if (ShouldBypass()) {
+		// (almost) every tuple creates a new group: stop probing the hash tables and aggregate once at finalize
+		bypass_payload_types = payload.GetTypes();
+		vector<LogicalType> layout_types(group_types);
+		layout_types.insert(layout_types.end(), bypass_payload_types.begin(), bypass_payload_types.end());
+		layout_types.emplace_back(LogicalType::HASH);
+		TupleDataLayout layout;
+		layout.Initialize(layout_types, false);
+		bypass_data = make_uniq<RadixPartitionedTupleData>(BufferManager::GetBufferManager(context), layout,
+		                                                   partition_info.radix_bits, layout_types.size() - 1);
+		bypass_data->InitializeAppendState(bypass_append_state);
+		bypass_chunk.InitializeEmpty(layout_types);
+		bypass_filter = filter;
+	}
 	return group_count;
 }
 
+bool PartitionableHashTable::ShouldBypass() const {
+	if (partitioned_tuple_count < BYPASS_SAMPLE_SIZE) {
+		return false;
+	}
+	return double(partitioned_tuple_count) < double(partitioned_group_count) * BYPASS_MINIMUM_REDUCTION;
+}
+
+void PartitionableHashTable::BypassAddChunk(DataChunk &groups, DataChunk &payload) {
+	D_ASSERT(bypass_data);
+	idx_t col_idx = 0;
+	for (idx_t i = 0; i < groups.ColumnCount(); i++) {
+		bypass_chunk.data[col_idx++].Reference(groups.data[i]);
+	}
+	for (idx_t i = 0; i < bypass_payload_types.size(); i++) {
+		bypass_chunk.data[col_idx++].Reference(payload.data[i]);
+	}
+	bypass_chunk.data[col_idx].Reference(hashes);
+	bypass_chunk.SetCardinality(groups.size());
+	bypass_data->Append(bypass_append_state, bypass_chunk);
+}
+
+void PartitionableHashTable::CombineBypassedPartition(idx_t partition, GroupedAggregateHashTable &target) {
+	if (!bypass_data) {
+		return;
+	}
+	D_ASSERT(partition < partition_info.n_partitions);
+	auto &collection = *bypass_data->GetPartitions()[partition];
+	if (collection.Count() == 0) {
+		return;
+	}
+
+	TupleDataScanState scan_state;
+	collection.InitializeScan(scan_state, TupleDataPinProperties::DESTROY_AFTER_DONE);
+	DataChunk scan_chunk;
+	collection.InitializeScanChunk(scan_state, scan_chunk);
+
+	DataChunk groups;
+	groups.InitializeEmpty(group_types);
+	DataChunk payload;
+	if (!bypass_payload_types.empty()) {
+		payload.InitializeEmpty(bypass_payload_types);
+	}
+	AggregateHTAppendState target_append_state;
+	while (collection.Scan(scan_state, scan_chunk)) {
+		idx_t col_idx = 0;
+		for (idx_t i = 0; i < group_types.size(); i++) {
+			groups.data[i].Reference(scan_chunk.data[col_idx++]);
+		}
+		for (idx_t i = 0; i < bypass_payload_types.size(); i++) {
+			payload.data[i].Reference(scan_chunk.data[col_idx++]);
+		}
+		groups.SetCardinality(scan_chunk.size());
+		payload.SetCardinality(scan_chunk.size());
+		target.AddChunk(target_append_state, groups, scan_chunk.data[col_idx], payload, bypass_filter);
+	}
+	collection.Reset();
+}
+
 void PartitionableHashTable::Partition() {
 	D_ASSERT(!IsPartitioned());
 	D_ASSERT(radix_partitioned_hts.empty());
@@ -137,6 +219,11 @@ void PartitionableHashTable::Partition() {
 	is_partitioned = true;
 }
 
+void PartitionableHashTable::AddHashTable(unique_ptr<GroupedAggregateHashTable> ht) {
+	D_ASSERT(!IsPartitioned());
+	unpartitioned_hts.push_back(std::move(ht));
+}
+
 bool PartitionableHashTable::IsPartitioned() {
 	return is_partitioned;
 }
@@ -154,6 +241,9 @@ HashTableList PartitionableHashTable::GetUnpartitioned() {
 }
 
 void PartitionableHashTable::Finalize() {
+	if (bypass_data) {
+		bypass_data->FlushAppendState(bypass_append_state);
+	}
 	if (IsPartitioned()) {
 		for (auto &ht_list : radix_partitioned_hts) {
 			for (auto &ht : ht_list) {
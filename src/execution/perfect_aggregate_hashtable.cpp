@@ -1,17 +1,51 @@
 #include "duckdb/execution/perfect_aggregate_hashtable.hpp"
+#include "duckdb/execution/aggregate_hashtable.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
 
 namespace duckdb {
 
+PerfectHashGroupDictionary::PerfectHashGroupDictionary(idx_t capacity_p) : capacity(capacity_p) {
+}
+
+bool PerfectHashGroupDictionary::TryGetCode(const string_t &value, uint32_t &code, string_t &stored_value) {
+	lock_guard<mutex> guard(lock);
+	auto entry = codes.find(value);
+	if (entry != codes.end()) {
+		code = entry->second;
+		stored_value = entry->first;
+		return true;
+	}
+	if (values.size() >= capacity) {
+		return false;
+	}
+	stored_value = heap.AddString(value);
+	values.push_back(stored_value);
+	// code 0 is reserved for NULL
+	code = values.size();
+	codes[stored_value] = code;
+	return true;
+}
+
+string_t PerfectHashGroupDictionary::GetValue(uint32_t code) {
+	lock_guard<mutex> guard(lock);
+	D_ASSERT(code > 0 && code <= values.size());
+	return values[code - 1];
+}
+
 PerfectAggregateHashTable::PerfectAggregateHashTable(ClientContext &context, Allocator &allocator,
                                                      const vector<LogicalType> &group_types_p,
                                                      vector<LogicalType> payload_types_p,
                                                      vector<AggregateObject> aggregate_objects_p,
-                                                     vector<Value> group_minima_p, vector<idx_t> required_bits_p)
+                                                     vector<Value> group_minima_p, vector<idx_t> required_bits_p,
+                                                     vector<shared_ptr<PerfectHashGroupDictionary>> dictionaries_p)
     : BaseAggregateHashTable(context, allocator, aggregate_objects_p, std::move(payload_types_p)),
       addresses(LogicalType::POINTER), required_bits(std::move(required_bits_p)), total_required_bits(0),
-      group_minima(std::move(group_minima_p)), sel(STANDARD_VECTOR_SIZE), aggregate_allocator(allocator) {
+      group_minima(std::move(group_minima_p)), dictionaries(std::move(dictionaries_p)), sel(STANDARD_VECTOR_SIZE),
+      aggregate_allocator(allocator) {
+	dictionaries.resize(group_types_p.size());
+	dictionary_caches.resize(group_types_p.size());
 	for (auto &group_bits : required_bits) {
 		total_required_bits += group_bits;
 	}
@@ -19,6 +53,7 @@ PerfectAggregateHashTable::PerfectAggregateHashTable(ClientContext &context, All
 	total_groups = (uint64_t)1 << total_required_bits;
 	// we don't need to store the groups in a perfect hash table, since the group keys can be deduced by their location
 	grouping_columns = group_types_p.size();
+	group_types = group_types_p;
 	layout.Initialize(std::move(aggregate_objects_p));
 	tuple_size = layout.GetRowWidth();
 
@@ -93,12 +128,58 @@ static void ComputeGroupLocation(Vector &group, Value &min, uintptr_t *address_d
 	case PhysicalType::INT64:
 		ComputeGroupLocationTemplated<int64_t>(vdata, min, address_data, current_shift, count);
 		break;
+	case PhysicalType::UINT8:
+		ComputeGroupLocationTemplated<uint8_t>(vdata, min, address_data, current_shift, count);
+		break;
+	case PhysicalType::UINT16:
+		ComputeGroupLocationTemplated<uint16_t>(vdata, min, address_data, current_shift, count);
+		break;
+	case PhysicalType::UINT32:
+		ComputeGroupLocationTemplated<uint32_t>(vdata, min, address_data, current_shift, count);
+		break;
 	default:
 		throw InternalException("Unsupported group type for perfect aggregate hash table");
 	}
 }
 
-void PerfectAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload) {
+bool PerfectAggregateHashTable::ComputeDictionaryGroupLocation(idx_t group_idx, Vector &group, uintptr_t *address_data,
+                                                               idx_t current_shift, idx_t count) {
+	auto &dictionary = *dictionaries[group_idx];
+	auto &cache = dictionary_caches[group_idx];
+
+	UnifiedVectorFormat vdata;
+	group.ToUnifiedFormat(count, vdata);
+	auto data = (string_t *)vdata.data;
+	// runs of the same value only need to be looked up once
+	string_t previous_value;
+	uintptr_t previous_code = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto index = vdata.sel->get_index(i);
+		// NULL groups are considered as "0" in the hash table
+		if (!vdata.validity.RowIsValid(index)) {
+			continue;
+		}
+		auto &value = data[index];
+		if (previous_code == 0 || !Equals::Operation(value, previous_value)) {
+			auto entry = cache.find(value);
+			if (entry != cache.end()) {
+				previous_value = entry->first;
+				previous_code = entry->second;
+			} else {
+				uint32_t code;
+				if (!dictionary.TryGetCode(value, code, previous_value)) {
+					return false;
+				}
+				cache[previous_value] = code;
+				previous_code = code;
+			}
+		}
+		address_data[i] += previous_code << current_shift;
+	}
+	return true;
+}
+
+bool PerfectAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload) {
 	// first we need to find the location in the HT of each of the groups
 	auto address_data = FlatVector::GetData<uintptr_t>(addresses);
 	// zero-initialize the address data
@@ -109,6 +190,12 @@ void PerfectAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload)
 	idx_t current_shift = total_required_bits;
 	for (idx_t i = 0; i < groups.ColumnCount(); i++) {
 		current_shift -= required_bits[i];
+		if (dictionaries[i]) {
+			if (!ComputeDictionaryGroupLocation(i, groups.data[i], address_data, current_shift, groups.size())) {
+				return false;
+			}
+			continue;
+		}
 		ComputeGroupLocation(groups.data[i], group_minima[i], address_data, current_shift, groups.size());
 	}
 	// now we have the HT entry number for every tuple
@@ -137,6 +224,7 @@ void PerfectAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload)
 		payload_idx += input_count;
 		VectorOperations::AddInPlace(addresses, aggregate.payload_size, payload.size());
 	}
+	return true;
 }
 
 void PerfectAggregateHashTable::Combine(PerfectAggregateHashTable &other) {
@@ -172,6 +260,30 @@ void PerfectAggregateHashTable::Combine(PerfectAggregateHashTable &other) {
 	RowOperations::CombineStates(row_state, layout, source_addresses, target_addresses, combine_count);
 }
 
+void PerfectAggregateHashTable::Combine(GroupedAggregateHashTable &target) {
+	DataChunk groups;
+	groups.Initialize(allocator, group_types);
+	AggregateHTAppendState append_state;
+	Vector target_addresses(LogicalType::POINTER);
+	// CombineStates moves both addresses to the aggregates of the layout of this HT
+	auto target_offset = int64_t(target.GetDataCollection().GetLayout().GetAggrOffset()) -
+	                     int64_t(layout.GetAggrOffset());
+
+	RowOperationsState row_state(aggregate_allocator.GetAllocator());
+	idx_t scan_position = 0;
+	while (true) {
+		groups.Reset();
+		auto count = ScanGroups(scan_position, groups);
+		if (count == 0) {
+			break;
+		}
+		groups.SetCardinality(count);
+		target.FindOrCreateGroups(append_state, groups, target_addresses);
+		VectorOperations::AddInPlace(target_addresses, target_offset, count);
+		RowOperations::CombineStates(row_state, layout, addresses, target_addresses, count);
+	}
+}
+
 template <class T>
 static void ReconstructGroupVectorTemplated(uint32_t group_values[], Value &min, idx_t mask, idx_t shift,
                                             idx_t entry_count, Vector &result) {
@@ -208,12 +320,37 @@ static void ReconstructGroupVector(uint32_t group_values[], Value &min, idx_t re
 	case PhysicalType::INT64:
 		ReconstructGroupVectorTemplated<int64_t>(group_values, min, mask, shift, entry_count, result);
 		break;
+	case PhysicalType::UINT8:
+		ReconstructGroupVectorTemplated<uint8_t>(group_values, min, mask, shift, entry_count, result);
+		break;
+	case PhysicalType::UINT16:
+		ReconstructGroupVectorTemplated<uint16_t>(group_values, min, mask, shift, entry_count, result);
+		break;
+	case PhysicalType::UINT32:
+		ReconstructGroupVectorTemplated<uint32_t>(group_values, min, mask, shift, entry_count, result);
+		break;
 	default:
 		throw InternalException("Invalid type for perfect aggregate HT group");
 	}
 }
 
-void PerfectAggregateHashTable::Scan(idx_t &scan_position, DataChunk &result) {
+static void ReconstructDictionaryGroupVector(uint32_t group_values[], PerfectHashGroupDictionary &dictionary,
+                                             idx_t required_bits, idx_t shift, idx_t entry_count, Vector &result) {
+	idx_t mask = ((uint64_t)1 << required_bits) - 1;
+	auto data = FlatVector::GetData<string_t>(result);
+	auto &validity_mask = FlatVector::Validity(result);
+	for (idx_t i = 0; i < entry_count; i++) {
+		auto code = (group_values[i] >> shift) & mask;
+		if (code == 0) {
+			validity_mask.SetInvalid(i);
+		} else {
+			// the result has to own the string: the dictionary might not outlive it
+			data[i] = StringVector::AddStringOrBlob(result, dictionary.GetValue(code));
+		}
+	}
+}
+
+idx_t PerfectAggregateHashTable::ScanGroups(idx_t &scan_position, DataChunk &result) {
 	auto data_pointers = FlatVector::GetData<data_ptr_t>(addresses);
 	uint32_t group_values[STANDARD_VECTOR_SIZE];
 
@@ -233,13 +370,27 @@ void PerfectAggregateHashTable::Scan(idx_t &scan_position, DataChunk &result) {
 	}
 	if (entry_count == 0) {
 		// no entries found
-		return;
+		return 0;
 	}
-	// first reconstruct the groups from the group index
+	// reconstruct the groups from the group index
 	idx_t shift = total_required_bits;
 	for (idx_t i = 0; i < grouping_columns; i++) {
 		shift -= required_bits[i];
-		ReconstructGroupVector(group_values, group_minima[i], required_bits[i], shift, entry_count, result.data[i]);
+		if (dictionaries[i]) {
+			ReconstructDictionaryGroupVector(group_values, *dictionaries[i], required_bits[i], shift, entry_count,
+			                                 result.data[i]);
+		} else {
+			ReconstructGroupVector(group_values, group_minima[i], required_bits[i], shift, entry_count,
+			                       result.data[i]);
+		}
+	}
+	return entry_count;
+}
+
+void PerfectAggregateHashTable::Scan(idx_t &scan_position, DataChunk &result) {
+	auto entry_count = ScanGroups(scan_position, result);
+	if (entry_count == 0) {
+		return;
 	}
 	// then construct the payloads
 	result.SetCardinality(entry_count);
@@ -77,6 +77,12 @@ void PhysicalOperator::GetData(ExecutionContext &context, DataChunk &chunk, Glob
 	throw InternalException("Calling GetData on a node that is not a source!");
 }
 
+SourceResultType PhysicalOperator::PollData(ExecutionContext &context, DataChunk &chunk,
+                                            OperatorSourceInput &input) const {
+	GetData(context, chunk, input.global_state, input.local_state);
+	return chunk.size() == 0 ? SourceResultType::FINISHED : SourceResultType::HAVE_MORE_OUTPUT;
+}
+
 idx_t PhysicalOperator::GetBatchIndex(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate,
                                       LocalSourceState &lstate) const {
 	throw InternalException("Calling GetBatchIndex on a node that does not support it");
@@ -2,6 +2,7 @@
 #include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_perfecthash_aggregate.hpp"
+#include "duckdb/execution/operator/aggregate/physical_sort_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
@@ -23,6 +24,17 @@ static uint32_t RequiredBitsForValue(uint32_t n) {
 	return required_bits;
 }
 
+static bool CanUseSortAggregate(ClientContext &context, LogicalAggregate &op) {
+	if (ClientConfig::GetConfig(context).holistic_aggregate_mode == HolisticAggregateMode::IN_MEMORY) {
+		return false;
+	}
+	if (op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
+		return false;
+	}
+	// only holistic aggregates benefit from aggregating one group at a time
+	return PhysicalSortAggregate::CanSortAggregate(op.expressions);
+}
+
 static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate &op, vector<idx_t> &bits_per_group) {
 	if (op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
 		return false;
@@ -35,33 +47,68 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 		auto &group = op.groups[group_idx];
 		auto &stats = op.group_stats[group_idx];
 
-		switch (group->return_type.InternalType()) {
+		auto &group_type = group->return_type;
+		switch (group_type.InternalType()) {
 		case PhysicalType::INT8:
 		case PhysicalType::INT16:
 		case PhysicalType::INT32:
 		case PhysicalType::INT64:
+		case PhysicalType::UINT8:
+		case PhysicalType::UINT16:
+		case PhysicalType::UINT32:
 			break;
+		case PhysicalType::VARCHAR: {
+			if (group_type.id() != LogicalTypeId::VARCHAR) {
+				return false;
+			}
+			// strings are encoded with dense codes that are assigned while aggregating
+			// this requires an estimate of the distinct count, as the dictionary is sized up front: reserve room for
+			// twice the estimate. if the dictionary overflows anyway, the aggregate falls back to a radix partitioned
+			// hash table
+			idx_t distinct_count = stats ? stats->GetDistinctCount() : 0;
+			if (distinct_count == 0 || distinct_count >= NumericLimits<int32_t>::Maximum() / 2) {
+				return false;
+			}
+			auto required_bits = RequiredBitsForValue(distinct_count * 2);
+			bits_per_group.push_back(required_bits);
+			perfect_hash_bits += required_bits;
+			if (perfect_hash_bits > ClientConfig::GetConfig(context).perfect_ht_threshold) {
+				return false;
+			}
+			continue;
+		}
 		default:
-			// we only support simple integer types for perfect hashing
+			// we only support simple integer types and strings for perfect hashing
 			return false;
 		}
 		// check if the group has stats available
-		auto &group_type = group->return_type;
 		if (!stats) {
 			// no stats, but we might still be able to use perfect hashing if the type is small enough
 			// for small types we can just set the stats to [type_min, type_max]
-			switch (group_type.InternalType()) {
-			case PhysicalType::INT8:
-			case PhysicalType::INT16:
-				break;
-			default:
-				// type is too large and there are no stats: skip perfect hashing
-				return false;
-			}
-			// construct stats with the min and max value of the type
 			stats = NumericStats::CreateUnknown(group_type).ToUnique();
-			NumericStats::SetMin(*stats, Value::MinimumValue(group_type));
-			NumericStats::SetMax(*stats, Value::MaximumValue(group_type));
+			if (group_type.id() == LogicalTypeId::ENUM) {
+				// the values of an enum are the indexes into its dictionary
+				auto enum_size = EnumType::GetSize(group_type);
+				if (enum_size == 0) {
+					return false;
+				}
+				NumericStats::SetMin(*stats, Value::ENUM(0, group_type));
+				NumericStats::SetMax(*stats, Value::ENUM(enum_size - 1, group_type));
+			} else {
+				switch (group_type.InternalType()) {
+				case PhysicalType::INT8:
+				case PhysicalType::INT16:
+				case PhysicalType::UINT8:
+				case PhysicalType::UINT16:
+					break;
+				default:
+					// type is too large and there are no stats: skip perfect hashing
+					return false;
+				}
+				// construct stats with the min and max value of the type
+				NumericStats::SetMin(*stats, Value::MinimumValue(group_type));
+				NumericStats::SetMax(*stats, Value::MaximumValue(group_type));
+			}
 		}
 		auto &nstats = *stats;
 
@@ -88,6 +135,15 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 				return false;
 			}
 			break;
+		case PhysicalType::UINT8:
+			range = int64_t(NumericStats::GetMax<uint8_t>(nstats)) - int64_t(NumericStats::GetMin<uint8_t>(nstats));
+			break;
+		case PhysicalType::UINT16:
+			range = int64_t(NumericStats::GetMax<uint16_t>(nstats)) - int64_t(NumericStats::GetMin<uint16_t>(nstats));
+			break;
+		case PhysicalType::UINT32:
+			range = int64_t(NumericStats::GetMax<uint32_t>(nstats)) - int64_t(NumericStats::GetMin<uint32_t>(nstats));
+			break;
 		default:
 			throw InternalException("Unsupported type for perfect hash (should be caught before)");
 		}
@@ -145,9 +201,13 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate
 		}
 	} else {
 		// groups! create a GROUP BY aggregator
-		// use a perfect hash aggregate if possible
+		// spill holistic aggregates by sorting on the groups if requested
+		// otherwise use a perfect hash aggregate if possible
 		vector<idx_t> required_bits;
-		if (CanUsePerfectHashAggregate(context, op, required_bits)) {
+		if (CanUseSortAggregate(context, op)) {
+			groupby = make_uniq_base<PhysicalOperator, PhysicalSortAggregate>(
+			    context, op.types, std::move(op.expressions), std::move(op.groups), op.estimated_cardinality);
+		} else if (CanUsePerfectHashAggregate(context, op, required_bits)) {
 			groupby = make_uniq_base<PhysicalOperator, PhysicalPerfectHashAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(op.group_stats),
 			    std::move(required_bits), op.estimated_cardinality);
@@ -11,6 +11,7 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalTopN &op)
 
 	auto top_n =
 	    make_uniq<PhysicalTopN>(op.types, std::move(op.orders), (idx_t)op.limit, op.offset, op.estimated_cardinality);
+	top_n->dynamic_filter = std::move(op.dynamic_filter);
 	top_n->children.push_back(std::move(plan));
 	return std::move(top_n);
 }
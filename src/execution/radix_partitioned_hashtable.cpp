@@ -208,6 +208,32 @@ void RadixPartitionedHashTable::Combine(ExecutionContext &context, GlobalSinkSta
 	gstate.intermediate_hts.push_back(std::move(llstate.ht));
 }
 
+void RadixPartitionedHashTable::CombineHashTable(ClientContext &context, GlobalSinkState &state,
+                                                 unique_ptr<GroupedAggregateHashTable> ht) const {
+	auto &gstate = state.Cast<RadixHTGlobalState>();
+	D_ASSERT(!gstate.is_finalized);
+	if (ht->Count() == 0) {
+		return;
+	}
+
+	lock_guard<mutex> glock(gstate.lock);
+	gstate.is_empty = false;
+	if (ForceSingleHT(state)) {
+		if (gstate.finalized_hts.empty()) {
+			gstate.finalized_hts.push_back(make_shared<GroupedAggregateHashTable>(
+			    context, Allocator::Get(context), group_types, op.payload_types, op.bindings, HtEntryType::HT_WIDTH_64));
+		}
+		gstate.finalized_hts[0]->Combine(*ht);
+		return;
+	}
+	// wrap the hash table so it is partitioned and merged together with the hash tables of the threads
+	auto pht = make_uniq<PartitionableHashTable>(context, Allocator::Get(context), gstate.partition_info, group_types,
+	                                             op.payload_types, op.bindings);
+	ht->Finalize();
+	pht->AddHashTable(std::move(ht));
+	gstate.intermediate_hts.push_back(std::move(pht));
+}
+
 bool RadixPartitionedHashTable::Finalize(ClientContext &context, GlobalSinkState &gstate_p) const {
 	auto &gstate = gstate_p.Cast<RadixHTGlobalState>();
 	D_ASSERT(!gstate.is_finalized);
@@ -287,6 +313,7 @@ public:
 				gstate.finalized_hts[radix]->Combine(*ht);
 				ht.reset();
 			}
+			pht->CombineBypassedPartition(radix, *gstate.finalized_hts[radix]);
 		}
 		gstate.finalized_hts[radix]->Finalize();
 	}
@@ -38,7 +38,7 @@ void WindowAggregateState::Sink(DataChunk &payload_chunk, SelectionVector *filte
 void WindowAggregateState::Finalize() {
 }
 
-void WindowAggregateState::Compute(Vector &result, idx_t rid, idx_t start, idx_t end) {
+void WindowAggregateState::Compute(Vector &result, idx_t rid, idx_t start, idx_t end) const {
 }
 
 //===--------------------------------------------------------------------===//
@@ -160,11 +160,12 @@ void WindowConstantAggregate::Finalize() {
 	row = 0;
 }
 
-void WindowConstantAggregate::Compute(Vector &target, idx_t rid, idx_t start, idx_t end) {
+void WindowConstantAggregate::Compute(Vector &target, idx_t rid, idx_t start, idx_t end) const {
 	//	Find the partition containing [start, end)
-	while (start < partition_offsets[partition] || partition_offsets[partition + 1] <= start) {
-		++partition;
-	}
+	//	(Rows can be computed in any order, so search instead of keeping a cursor.)
+	auto upper = std::upper_bound(partition_offsets.begin(), partition_offsets.end(), start);
+	D_ASSERT(upper != partition_offsets.begin());
+	const idx_t partition = (upper - partition_offsets.begin()) - 1;
 	D_ASSERT(partition_offsets[partition] <= start);
 	D_ASSERT(partition + 1 < partition_offsets.size());
 	D_ASSERT(end <= partition_offsets[partition + 1]);
@@ -174,28 +175,50 @@ void WindowConstantAggregate::Compute(Vector &target, idx_t rid, idx_t start, id
 }
 
 //===--------------------------------------------------------------------===//
-// WindowSegmentTree
+// WindowSegmentTreeState
 //===--------------------------------------------------------------------===//
-WindowSegmentTree::WindowSegmentTree(AggregateObject aggr, const LogicalType &result_type_p, DataChunk *input,
-                                     const ValidityMask &filter_mask_p, WindowAggregationMode mode_p)
-    : aggr(std::move(aggr)), result_type(result_type_p), state(aggr.function.state_size()),
-      statep(Value::POINTER((idx_t)state.data())), frame(0, 0), statev(Value::POINTER((idx_t)state.data())),
-      internal_nodes(0), input_ref(input), filter_mask(filter_mask_p), mode(mode_p) {
-	statep.Flatten(input->size());
+WindowSegmentTreeState::WindowSegmentTreeState(const WindowSegmentTree &tree, idx_t capacity)
+    : tree(tree), state(tree.state_size), statep(Value::POINTER((idx_t)state.data())), frame(0, 0),
+      statev(Value::POINTER((idx_t)state.data())) {
+	statep.Flatten(capacity);
 	statev.SetVectorType(VectorType::FLAT_VECTOR); // Prevent conversion of results to constants
 
+	auto input_ref = tree.input_ref;
 	if (input_ref && input_ref->ColumnCount() > 0) {
-		filter_sel.Initialize(input->size());
+		filter_sel.Initialize(capacity);
 		inputs.Initialize(Allocator::DefaultAllocator(), input_ref->GetTypes());
 		// if we have a frame-by-frame method, share the single state
-		if (aggr.function.window && UseWindowAPI()) {
-			AggregateInit();
+		if (tree.aggr.function.window && tree.UseWindowAPI()) {
+			tree.AggregateInit(*this);
 			inputs.Reference(*input_ref);
 		} else {
 			inputs.SetCapacity(*input_ref);
-			if (aggr.function.combine && UseCombineAPI()) {
-				ConstructTree();
-			}
+		}
+	}
+}
+
+WindowSegmentTreeState::~WindowSegmentTreeState() {
+	auto &aggr = tree.aggr;
+	if (!aggr.function.destructor || !tree.input_ref || !tree.input_ref->ColumnCount()) {
+		return;
+	}
+	if (aggr.function.window && tree.UseWindowAPI()) {
+		AggregateInputData aggr_input_data(aggr.GetFunctionData(), Allocator::DefaultAllocator());
+		aggr.function.destructor(statev, aggr_input_data, 1);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// WindowSegmentTree
+//===--------------------------------------------------------------------===//
+WindowSegmentTree::WindowSegmentTree(AggregateObject aggr, const LogicalType &result_type_p, DataChunk *input,
+                                     const ValidityMask &filter_mask_p, WindowAggregationMode mode_p)
+    : aggr(std::move(aggr)), result_type(result_type_p), state_size(this->aggr.function.state_size()),
+      internal_nodes(0), input_ref(input), filter_mask(filter_mask_p), mode(mode_p) {
+
+	if (input_ref && input_ref->ColumnCount() > 0) {
+		if (!(this->aggr.function.window && UseWindowAPI()) && this->aggr.function.combine && UseCombineAPI()) {
+			ConstructTree();
 		}
 	}
 }
@@ -211,7 +234,7 @@ WindowSegmentTree::~WindowSegmentTree() {
 	Vector addresses(LogicalType::POINTER, (data_ptr_t)address_data);
 	idx_t count = 0;
 	for (idx_t i = 0; i < internal_nodes; i++) {
-		address_data[count++] = data_ptr_t(levels_flat_native.get() + i * state.size());
+		address_data[count++] = data_ptr_t(levels_flat_native.get() + i * state_size);
 		if (count == STANDARD_VECTOR_SIZE) {
 			aggr.function.destructor(addresses, aggr_input_data, count);
 			count = 0;
@@ -220,29 +243,36 @@ WindowSegmentTree::~WindowSegmentTree() {
 	if (count > 0) {
 		aggr.function.destructor(addresses, aggr_input_data, count);
 	}
+}
 
-	if (aggr.function.window && UseWindowAPI()) {
-		aggr.function.destructor(statev, aggr_input_data, 1);
+unique_ptr<WindowSegmentTreeState> WindowSegmentTree::GetLocalState() const {
+	//	The combine API never touches more than TREE_FANOUT states or rows at once,
+	//	but aggregating a frame directly can touch all of the input.
+	idx_t capacity = TREE_FANOUT;
+	if (input_ref && !(aggr.function.combine && UseCombineAPI())) {
+		capacity = MaxValue<idx_t>(capacity, input_ref->size());
 	}
+	return make_uniq<WindowSegmentTreeState>(*this, capacity);
 }
 
-void WindowSegmentTree::AggregateInit() {
-	aggr.function.initialize(state.data());
+void WindowSegmentTree::AggregateInit(WindowSegmentTreeState &lstate) const {
+	aggr.function.initialize(lstate.state.data());
 }
 
-void WindowSegmentTree::AggegateFinal(Vector &result, idx_t rid) {
+void WindowSegmentTree::AggegateFinal(WindowSegmentTreeState &lstate, Vector &result, idx_t rid) const {
 	AggregateInputData aggr_input_data(aggr.GetFunctionData(), Allocator::DefaultAllocator());
-	aggr.function.finalize(statev, aggr_input_data, result, 1, rid);
+	aggr.function.finalize(lstate.statev, aggr_input_data, result, 1, rid);
 
 	if (aggr.function.destructor) {
-		aggr.function.destructor(statev, aggr_input_data, 1);
+		aggr.function.destructor(lstate.statev, aggr_input_data, 1);
 	}
 }
 
-void WindowSegmentTree::ExtractFrame(idx_t begin, idx_t end) {
+void WindowSegmentTree::ExtractFrame(WindowSegmentTreeState &lstate, idx_t begin, idx_t end) const {
 	const auto size = end - begin;
 
 	auto &chunk = *input_ref;
+	auto &inputs = lstate.inputs;
 	const auto input_count = input_ref->ColumnCount();
 	inputs.SetCardinality(size);
 	for (idx_t i = 0; i < input_count; ++i) {
@@ -254,6 +284,7 @@ void WindowSegmentTree::ExtractFrame(idx_t begin, idx_t end) {
 
 	// Slice to any filtered rows
 	if (!filter_mask.AllValid()) {
+		auto &filter_sel = lstate.filter_sel;
 		idx_t filtered = 0;
 		for (idx_t i = begin; i < end; ++i) {
 			if (filter_mask.RowIsValid(i)) {
@@ -266,27 +297,29 @@ void WindowSegmentTree::ExtractFrame(idx_t begin, idx_t end) {
 	}
 }
 
-void WindowSegmentTree::WindowSegmentValue(idx_t l_idx, idx_t begin, idx_t end) {
+void WindowSegmentTree::WindowSegmentValue(WindowSegmentTreeState &lstate, idx_t l_idx, idx_t begin,
+                                           idx_t end) const {
 	D_ASSERT(begin <= end);
+	auto &inputs = lstate.inputs;
 	if (begin == end || inputs.ColumnCount() == 0) {
 		return;
 	}
 
 	const auto count = end - begin;
-	Vector s(statep, 0, count);
+	Vector s(lstate.statep, 0, count);
 	if (l_idx == 0) {
-		ExtractFrame(begin, end);
+		ExtractFrame(lstate, begin, end);
 		AggregateInputData aggr_input_data(aggr.GetFunctionData(), Allocator::DefaultAllocator());
 		D_ASSERT(!inputs.data.empty());
 		aggr.function.update(&inputs.data[0], aggr_input_data, input_ref->ColumnCount(), s, inputs.size());
 	} else {
 		// find out where the states begin
-		data_ptr_t begin_ptr = levels_flat_native.get() + state.size() * (begin + levels_flat_start[l_idx - 1]);
+		data_ptr_t begin_ptr = levels_flat_native.get() + state_size * (begin + levels_flat_start[l_idx - 1]);
 		// set up a vector of pointers that point towards the set of states
 		Vector v(LogicalType::POINTER, count);
 		auto pdata = FlatVector::GetData<data_ptr_t>(v);
 		for (idx_t i = 0; i < count; i++) {
-			pdata[i] = begin_ptr + i * state.size();
+			pdata[i] = begin_ptr + i * state_size;
 		}
 		v.Verify(count);
 		AggregateInputData aggr_input_data(aggr.GetFunctionData(), Allocator::DefaultAllocator());
@@ -296,7 +329,11 @@ void WindowSegmentTree::WindowSegmentValue(idx_t l_idx, idx_t begin, idx_t end)
 
 void WindowSegmentTree::ConstructTree() {
 	D_ASSERT(input_ref);
-	D_ASSERT(inputs.ColumnCount() > 0);
+	D_ASSERT(input_ref->ColumnCount() > 0);
+
+	// the tree is built with a private scratch space
+	WindowSegmentTreeState lstate(*this, TREE_FANOUT);
+	auto &state = lstate.state;
 
 	// compute space required to store internal nodes of segment tree
 	internal_nodes = 0;
@@ -305,7 +342,7 @@ void WindowSegmentTree::ConstructTree() {
 		level_nodes = (level_nodes + (TREE_FANOUT - 1)) / TREE_FANOUT;
 		internal_nodes += level_nodes;
 	} while (level_nodes > 1);
-	levels_flat_native = unique_ptr<data_t[]>(new data_t[internal_nodes * state.size()]);
+	levels_flat_native = unique_ptr<data_t[]>(new data_t[internal_nodes * state_size]);
 	levels_flat_start.push_back(0);
 
 	idx_t levels_flat_offset = 0;
@@ -317,10 +354,10 @@ void WindowSegmentTree::ConstructTree() {
 	                                         : levels_flat_offset - levels_flat_start[level_current - 1])) > 1) {
 		for (idx_t pos = 0; pos < level_size; pos += TREE_FANOUT) {
 			// compute the aggregate for this entry in the segment tree
-			AggregateInit();
-			WindowSegmentValue(level_current, pos, MinValue(level_size, pos + TREE_FANOUT));
+			AggregateInit(lstate);
+			WindowSegmentValue(lstate, level_current, pos, MinValue(level_size, pos + TREE_FANOUT));
 
-			memcpy(levels_flat_native.get() + (levels_flat_offset * state.size()), state.data(), state.size());
+			memcpy(levels_flat_native.get() + (levels_flat_offset * state_size), state.data(), state_size);
 
 			levels_flat_offset++;
 		}
@@ -335,28 +372,30 @@ void WindowSegmentTree::ConstructTree() {
 	}
 }
 
-void WindowSegmentTree::Compute(Vector &result, idx_t rid, idx_t begin, idx_t end) {
+void WindowSegmentTree::Compute(WindowSegmentTreeState &lstate, Vector &result, idx_t rid, idx_t begin,
+                                idx_t end) const {
 	D_ASSERT(input_ref);
+	D_ASSERT(&lstate.tree == this);
 
 	// If we have a window function, use that
 	if (aggr.function.window && UseWindowAPI()) {
 		// Frame boundaries
-		auto prev = frame;
-		frame = FrameBounds(begin, end);
+		auto prev = lstate.frame;
+		lstate.frame = FrameBounds(begin, end);
 
 		// Extract the range
 		AggregateInputData aggr_input_data(aggr.GetFunctionData(), Allocator::DefaultAllocator());
-		aggr.function.window(input_ref->data.data(), filter_mask, aggr_input_data, inputs.ColumnCount(), state.data(),
-		                     frame, prev, result, rid, 0);
+		aggr.function.window(input_ref->data.data(), filter_mask, aggr_input_data, lstate.inputs.ColumnCount(),
+		                     lstate.state.data(), lstate.frame, prev, result, rid, 0);
 		return;
 	}
 
-	AggregateInit();
+	AggregateInit(lstate);
 
 	// Aggregate everything at once if we can't combine states
 	if (!aggr.function.combine || !UseCombineAPI()) {
-		WindowSegmentValue(0, begin, end);
-		AggegateFinal(result, rid);
+		WindowSegmentValue(lstate, 0, begin, end);
+		AggegateFinal(lstate, result, rid);
 		return;
 	}
 
@@ -364,23 +403,23 @@ void WindowSegmentTree::Compute(Vector &result, idx_t rid, idx_t begin, idx_t en
 		idx_t parent_begin = begin / TREE_FANOUT;
 		idx_t parent_end = end / TREE_FANOUT;
 		if (parent_begin == parent_end) {
-			WindowSegmentValue(l_idx, begin, end);
+			WindowSegmentValue(lstate, l_idx, begin, end);
 			break;
 		}
 		idx_t group_begin = parent_begin * TREE_FANOUT;
 		if (begin != group_begin) {
-			WindowSegmentValue(l_idx, begin, group_begin + TREE_FANOUT);
+			WindowSegmentValue(lstate, l_idx, begin, group_begin + TREE_FANOUT);
 			parent_begin++;
 		}
 		idx_t group_end = parent_end * TREE_FANOUT;
 		if (end != group_end) {
-			WindowSegmentValue(l_idx, group_end, end);
+			WindowSegmentValue(lstate, l_idx, group_end, end);
 		}
 		begin = parent_begin;
 		end = parent_end;
 	}
 
-	AggegateFinal(result, rid);
+	AggegateFinal(lstate, result, rid);
 }
 
 } // namespace duckdb
@@ -16,14 +16,8 @@ struct ApproxDistinctCountState {
 			delete log;
 		}
 	}
-	void Resize(idx_t count) {
-		indices.resize(count);
-		counts.resize(count);
-	}
 
 	HyperLogLog *log;
-	vector<uint64_t> indices;
-	vector<uint8_t> counts;
 };
 
 struct ApproxCountDistinctFunction {
@@ -42,9 +36,7 @@ struct ApproxCountDistinctFunction {
 		}
 		D_ASSERT(target->log);
 		D_ASSERT(source.log);
-		auto new_log = target->log->MergePointer(*source.log);
-		delete target->log;
-		target->log = new_log;
+		target->log->MergeInPlace(*source.log);
 	}
 
 	template <class T, class STATE>
@@ -74,15 +66,7 @@ static void ApproxCountDistinctSimpleUpdateFunction(Vector inputs[], AggregateIn
 		agg_state->log = new HyperLogLog();
 	}
 
-	UnifiedVectorFormat vdata;
-	inputs[0].ToUnifiedFormat(count, vdata);
-
-	agg_state->Resize(count);
-	auto indices = agg_state->indices.data();
-	auto counts = agg_state->counts.data();
-
-	HyperLogLog::ProcessEntries(vdata, inputs[0].GetType(), indices, counts, count);
-	agg_state->log->AddToLog(vdata, count, indices, counts);
+	agg_state->log->Update(inputs[0], count);
 }
 
 static void ApproxCountDistinctUpdateFunction(Vector inputs[], AggregateInputData &, idx_t input_count,
@@ -93,20 +77,16 @@ static void ApproxCountDistinctUpdateFunction(Vector inputs[], AggregateInputDat
 	state_vector.ToUnifiedFormat(count, sdata);
 	auto states = (ApproxDistinctCountState **)sdata.data;
 
-	uint64_t *indices = nullptr;
-	uint8_t *counts = nullptr;
 	for (idx_t i = 0; i < count; i++) {
 		auto agg_state = states[sdata.sel->get_index(i)];
 		if (!agg_state->log) {
 			agg_state->log = new HyperLogLog();
 		}
-		if (i == 0) {
-			agg_state->Resize(count);
-			indices = agg_state->indices.data();
-			counts = agg_state->counts.data();
-		}
 	}
 
+	uint64_t indices[STANDARD_VECTOR_SIZE];
+	uint8_t counts[STANDARD_VECTOR_SIZE];
+
 	UnifiedVectorFormat vdata;
 	inputs[0].ToUnifiedFormat(count, vdata);
 
@@ -71,6 +71,23 @@ struct CountFunction : public BaseCountFunction {
 	}
 };
 
+struct SumCountsFunction : public BaseCountFunction {
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Operation(STATE *state, AggregateInputData &, INPUT_TYPE *input, ValidityMask &mask, idx_t idx) {
+		*state += input[idx];
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void ConstantOperation(STATE *state, AggregateInputData &, INPUT_TYPE *input, ValidityMask &mask,
+	                              idx_t count) {
+		*state += *input * int64_t(count);
+	}
+
+	static bool IgnoreNull() {
+		return true;
+	}
+};
+
 AggregateFunction CountFun::GetFunction() {
 	auto fun = AggregateFunction::UnaryAggregate<int64_t, int64_t, int64_t, CountFunction>(
 	    LogicalType(LogicalTypeId::ANY), LogicalType::BIGINT);
@@ -123,6 +140,21 @@ void CountFun::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(count);
 }
 
+AggregateFunction SumCountsFun::GetFunction() {
+	auto fun = AggregateFunction::UnaryAggregate<int64_t, int64_t, int64_t, SumCountsFunction>(LogicalType::BIGINT,
+	                                                                                           LogicalType::BIGINT);
+	fun.name = "sum_counts";
+	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+	return fun;
+}
+
+void SumCountsFun::RegisterFunction(BuiltinFunctions &set) {
+	// sums up partial counts: unlike SUM this results in a BIGINT, and in 0 if there are no counts
+	AggregateFunctionSet sum_counts("sum_counts");
+	sum_counts.AddFunction(SumCountsFun::GetFunction());
+	set.AddFunction(sum_counts);
+}
+
 void CountStarFun::RegisterFunction(BuiltinFunctions &set) {
 	AggregateFunctionSet count("count_star");
 	count.AddFunction(CountStarFun::GetFunction());
@@ -13,6 +13,7 @@ void BuiltinFunctions::RegisterDistributiveAggregates() {
 	Register<BitStringAggFun>();
 	Register<CountStarFun>();
 	Register<CountFun>();
+	Register<SumCountsFun>();
 	Register<FirstFun>();
 	Register<MaxFun>();
 	Register<MinFun>();
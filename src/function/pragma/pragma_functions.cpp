@@ -2,9 +2,11 @@
 
 #include "duckdb/common/enums/output_type.hpp"
 #include "duckdb/common/operator/cast_operators.hpp"
+#include "duckdb/common/trace_recorder.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/planner/expression_binder.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
@@ -108,6 +110,10 @@ static void PragmaDisableCheckpointOnShutdown(ClientContext &context, const Func
 	DBConfig::GetConfig(context).options.checkpoint_on_shutdown = false;
 }
 
+static void PragmaClearCardinalityFeedback(ClientContext &context, const FunctionParameters &parameters) {
+	CardinalityFeedback::Get(context).Clear();
+}
+
 static void PragmaEnableOptimizer(ClientContext &context, const FunctionParameters &parameters) {
 	ClientConfig::GetConfig(context).enable_optimizer = true;
 }
@@ -116,6 +122,27 @@ static void PragmaDisableOptimizer(ClientContext &context, const FunctionParamet
 	ClientConfig::GetConfig(context).enable_optimizer = false;
 }
 
+static void PragmaEnableTracing(ClientContext &context, const FunctionParameters &parameters) {
+	TraceRecorder::Get(context).Enable();
+}
+
+static void PragmaDisableTracing(ClientContext &context, const FunctionParameters &parameters) {
+	TraceRecorder::Get(context).Disable();
+}
+
+static void PragmaExportTrace(ClientContext &context, const FunctionParameters &parameters) {
+	auto &config = DBConfig::GetConfig(context);
+	if (!config.options.enable_external_access) {
+		throw PermissionException("PRAGMA export_trace is disabled through configuration");
+	}
+	auto path = parameters.values[0].ToString();
+	auto trace = TraceRecorder::Get(context).ToChromeTrace();
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+	handle->Write((void *)trace.c_str(), trace.size());
+	handle->Sync();
+}
+
 void PragmaFunctions::RegisterFunction(BuiltinFunctions &set) {
 	RegisterEnableProfiling(set);
 
@@ -141,8 +168,13 @@ void PragmaFunctions::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(PragmaFunction::PragmaStatement("disable_optimizer", PragmaDisableOptimizer));
 
 	set.AddFunction(PragmaFunction::PragmaStatement("force_index_join", PragmaEnableForceIndexJoin));
+	set.AddFunction(PragmaFunction::PragmaStatement("clear_cardinality_feedback", PragmaClearCardinalityFeedback));
 	set.AddFunction(PragmaFunction::PragmaStatement("force_checkpoint", PragmaForceCheckpoint));
 
+	set.AddFunction(PragmaFunction::PragmaStatement("enable_tracing", PragmaEnableTracing));
+	set.AddFunction(PragmaFunction::PragmaStatement("disable_tracing", PragmaDisableTracing));
+	set.AddFunction(PragmaFunction::PragmaCall("export_trace", PragmaExportTrace, {LogicalType::VARCHAR}));
+
 	set.AddFunction(PragmaFunction::PragmaStatement("enable_progress_bar", PragmaEnableProgressBar));
 	set.AddFunction(PragmaFunction::PragmaStatement("disable_progress_bar", PragmaDisableProgressBar));
 
@@ -161,6 +161,14 @@ string PragmaDatabaseSize(ClientContext &context, const FunctionParameters &para
 	return "SELECT * FROM pragma_database_size();";
 }
 
+string PragmaPlanCacheInfo(ClientContext &context, const FunctionParameters &parameters) {
+	return "SELECT * FROM pragma_plan_cache_info();";
+}
+
+string PragmaCardinalityFeedback(ClientContext &context, const FunctionParameters &parameters) {
+	return "SELECT * FROM pragma_cardinality_feedback();";
+}
+
 string PragmaStorageInfo(ClientContext &context, const FunctionParameters &parameters) {
 	return StringUtil::Format("SELECT * FROM pragma_storage_info('%s');", parameters.values[0].ToString());
 }
@@ -176,6 +184,8 @@ void PragmaQueries::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(PragmaFunction::PragmaCall("show", PragmaShow, {LogicalType::VARCHAR}));
 	set.AddFunction(PragmaFunction::PragmaStatement("version", PragmaVersion));
 	set.AddFunction(PragmaFunction::PragmaStatement("database_size", PragmaDatabaseSize));
+	set.AddFunction(PragmaFunction::PragmaStatement("plan_cache_info", PragmaPlanCacheInfo));
+	set.AddFunction(PragmaFunction::PragmaStatement("cardinality_feedback", PragmaCardinalityFeedback));
 	set.AddFunction(PragmaFunction::PragmaStatement("functions", PragmaFunctionsQuery));
 	set.AddFunction(PragmaFunction::PragmaCall("import_database", PragmaImportDatabase, {LogicalType::VARCHAR}));
 	set.AddFunction(PragmaFunction::PragmaStatement("all_profiling_output", PragmaAllProfiling));
@@ -4,6 +4,11 @@
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define DUCKDB_CONTAINS_SIMD
+#include <immintrin.h>
+#endif
+
 namespace duckdb {
 
 template <class UNSIGNED, int NEEDLE_SIZE>
@@ -98,9 +103,146 @@ idx_t ContainsGeneric(const unsigned char *haystack, idx_t haystack_size, const
 	}
 }
 
+#ifdef DUCKDB_CONTAINS_SIMD
+// SIMD contains for needles of at least two characters, following the "generic SIMD" substring search of
+// Wojciech Mula (http://0x80.pl/articles/simd-strfind.html)
+// for a block of candidate positions we compare the haystack with the first character of the needle, and the haystack
+// shifted by (needle_size - 1) with the last character of the needle. only positions for which both characters match
+// are verified with memcmp, which filters out almost all candidates in a single comparison per block.
+static inline bool ContainsVerify(const unsigned char *haystack, const unsigned char *needle, idx_t needle_size,
+                                  idx_t position) {
+	return memcmp(haystack + position + 1, needle + 1, needle_size - 2) == 0;
+}
+
+template <class MASK>
+static inline idx_t ContainsCheckMask(const unsigned char *haystack, const unsigned char *needle, idx_t needle_size,
+                                      idx_t base, MASK mask) {
+	while (mask) {
+		auto position = base + idx_t(sizeof(MASK) == 8 ? __builtin_ctzll(mask) : __builtin_ctz(mask));
+		if (ContainsVerify(haystack, needle, needle_size, position)) {
+			return position;
+		}
+		mask &= mask - 1;
+	}
+	return DConstants::INVALID_INDEX;
+}
+
+static inline uint32_t ContainsMatchSSE(const unsigned char *haystack, idx_t needle_size, __m128i first,
+                                        __m128i last) {
+	auto block_first = _mm_loadu_si128((const __m128i *)haystack);
+	auto block_last = _mm_loadu_si128((const __m128i *)(haystack + needle_size - 1));
+	auto eq = _mm_and_si128(_mm_cmpeq_epi8(first, block_first), _mm_cmpeq_epi8(last, block_last));
+	return uint32_t(_mm_movemask_epi8(eq));
+}
+
+//! SSE2 is part of x86-64, so this is always available: 32 positions per iteration, then 16 at a time
+static idx_t ContainsSSE(const unsigned char *haystack, idx_t haystack_size, const unsigned char *needle,
+                         idx_t needle_size) {
+	static constexpr idx_t BLOCK_SIZE = 16;
+	const idx_t end = haystack_size - needle_size + 1;
+	D_ASSERT(end >= BLOCK_SIZE);
+	auto first = _mm_set1_epi8((char)needle[0]);
+	auto last = _mm_set1_epi8((char)needle[needle_size - 1]);
+	idx_t i = 0;
+	for (; i + 2 * BLOCK_SIZE <= end; i += 2 * BLOCK_SIZE) {
+		auto mask = ContainsMatchSSE(haystack + i, needle_size, first, last) |
+		            (ContainsMatchSSE(haystack + i + BLOCK_SIZE, needle_size, first, last) << BLOCK_SIZE);
+		auto result = ContainsCheckMask<uint32_t>(haystack, needle, needle_size, i, mask);
+		if (result != DConstants::INVALID_INDEX) {
+			return result;
+		}
+	}
+	for (; i + BLOCK_SIZE <= end; i += BLOCK_SIZE) {
+		auto mask = ContainsMatchSSE(haystack + i, needle_size, first, last);
+		auto result = ContainsCheckMask<uint32_t>(haystack, needle, needle_size, i, mask);
+		if (result != DConstants::INVALID_INDEX) {
+			return result;
+		}
+	}
+	if (i < end) {
+		// the remaining positions are covered by a final block that overlaps with the previous one
+		auto start = end - BLOCK_SIZE;
+		auto mask = ContainsMatchSSE(haystack + start, needle_size, first, last) >> (i - start);
+		return ContainsCheckMask<uint32_t>(haystack, needle, needle_size, i, mask);
+	}
+	return DConstants::INVALID_INDEX;
+}
+
+__attribute__((target("avx2"))) static inline uint32_t ContainsMatchAVX2(const unsigned char *haystack,
+                                                                         idx_t needle_size, __m256i first,
+                                                                         __m256i last) {
+	auto block_first = _mm256_loadu_si256((const __m256i *)haystack);
+	auto block_last = _mm256_loadu_si256((const __m256i *)(haystack + needle_size - 1));
+	auto eq = _mm256_and_si256(_mm256_cmpeq_epi8(first, block_first), _mm256_cmpeq_epi8(last, block_last));
+	return uint32_t(_mm256_movemask_epi8(eq));
+}
+
+//! AVX2 version (selected at runtime): 64 positions per iteration, then 32 at a time
+__attribute__((target("avx2"))) static idx_t ContainsAVX2(const unsigned char *haystack, idx_t haystack_size,
+                                                          const unsigned char *needle, idx_t needle_size) {
+	static constexpr idx_t BLOCK_SIZE = 32;
+	const idx_t end = haystack_size - needle_size + 1;
+	D_ASSERT(end >= BLOCK_SIZE);
+	auto first = _mm256_set1_epi8((char)needle[0]);
+	auto last = _mm256_set1_epi8((char)needle[needle_size - 1]);
+	idx_t i = 0;
+	for (; i + 2 * BLOCK_SIZE <= end; i += 2 * BLOCK_SIZE) {
+		auto mask = uint64_t(ContainsMatchAVX2(haystack + i, needle_size, first, last)) |
+		            (uint64_t(ContainsMatchAVX2(haystack + i + BLOCK_SIZE, needle_size, first, last)) << BLOCK_SIZE);
+		auto result = ContainsCheckMask<uint64_t>(haystack, needle, needle_size, i, mask);
+		if (result != DConstants::INVALID_INDEX) {
+			return result;
+		}
+	}
+	for (; i + BLOCK_SIZE <= end; i += BLOCK_SIZE) {
+		auto mask = ContainsMatchAVX2(haystack + i, needle_size, first, last);
+		auto result = ContainsCheckMask<uint32_t>(haystack, needle, needle_size, i, mask);
+		if (result != DConstants::INVALID_INDEX) {
+			return result;
+		}
+	}
+	if (i < end) {
+		// the remaining positions are covered by a final block that overlaps with the previous one
+		auto start = end - BLOCK_SIZE;
+		auto mask = ContainsMatchAVX2(haystack + start, needle_size, first, last) >> (i - start);
+		return ContainsCheckMask<uint32_t>(haystack, needle, needle_size, i, mask);
+	}
+	return DConstants::INVALID_INDEX;
+}
+
+static bool ContainsSupportsAVX2() {
+	static const bool supports_avx2 = __builtin_cpu_supports("avx2");
+	return supports_avx2;
+}
+
+//! Runs the widest SIMD search the CPU supports, if the haystack fills at least one block of candidate positions
+static bool TryContainsSIMD(const unsigned char *haystack, idx_t haystack_size, const unsigned char *needle,
+                            idx_t needle_size, idx_t &result) {
+	if (needle_size < 2 || haystack_size < needle_size) {
+		return false;
+	}
+	const idx_t positions = haystack_size - needle_size + 1;
+	if (positions >= 32 && ContainsSupportsAVX2()) {
+		result = ContainsAVX2(haystack, haystack_size, needle, needle_size);
+		return true;
+	}
+	if (positions >= 16) {
+		result = ContainsSSE(haystack, haystack_size, needle, needle_size);
+		return true;
+	}
+	return false;
+}
+#endif
+
 idx_t ContainsFun::Find(const unsigned char *haystack, idx_t haystack_size, const unsigned char *needle,
                         idx_t needle_size) {
 	D_ASSERT(needle_size > 0);
+#ifdef DUCKDB_CONTAINS_SIMD
+	idx_t simd_result;
+	if (TryContainsSIMD(haystack, haystack_size, needle, needle_size, simd_result)) {
+		return simd_result;
+	}
+#endif
 	// start off by performing a memchr to find the first character of the
 	auto location = memchr(haystack, needle[0], haystack_size);
 	if (location == nullptr) {
@@ -74,12 +74,19 @@ struct LikeSegment {
 struct LikeMatcher : public FunctionData {
 	LikeMatcher(string like_pattern_p, vector<LikeSegment> segments, bool has_start_percentage, bool has_end_percentage)
 	    : like_pattern(std::move(like_pattern_p)), segments(std::move(segments)),
-	      has_start_percentage(has_start_percentage), has_end_percentage(has_end_percentage) {
+	      has_start_percentage(has_start_percentage), has_end_percentage(has_end_percentage), min_length(0) {
+		for (auto &segment : this->segments) {
+			min_length += segment.pattern.size();
+		}
 	}
 
 	bool Match(string_t &str) {
 		auto str_data = (const unsigned char *)str.GetData();
 		auto str_len = str.GetSize();
+		if (str_len < min_length) {
+			// the segments cannot overlap: the string is too short to contain all of them
+			return false;
+		}
 		idx_t segment_idx = 0;
 		idx_t end_idx = segments.size() - 1;
 		if (!has_start_percentage) {
@@ -188,6 +195,8 @@ private:
 	vector<LikeSegment> segments;
 	bool has_start_percentage;
 	bool has_end_percentage;
+	//! The total length of all segments
+	idx_t min_length;
 };
 
 static unique_ptr<FunctionData> LikeBindFunction(ClientContext &context, ScalarFunction &bound_function,
@@ -904,6 +904,11 @@ unique_ptr<NodeStatistics> CSVReaderCardinality(ClientContext &context, const Fu
 	return make_uniq<NodeStatistics>(bind_data.files.size() * per_file_cardinality);
 }
 
+vector<string> CSVReaderGetFiles(const FunctionData *bind_data_p) {
+	auto &bind_data = bind_data_p->Cast<ReadCSVData>();
+	return bind_data.files;
+}
+
 void BufferedCSVReaderOptions::Serialize(FieldWriter &writer) const {
 	// common options
 	writer.WriteField<bool>(has_delimiter);
@@ -1019,6 +1024,7 @@ TableFunction ReadCSVTableFunction::GetFunction() {
 	read_csv.deserialize = CSVReaderDeserialize;
 	read_csv.get_batch_index = CSVReaderGetBatchIndex;
 	read_csv.cardinality = CSVReaderCardinality;
+	read_csv.get_files = CSVReaderGetFiles;
 	read_csv.projection_pushdown = true;
 	ReadCSVAddNamedParameters(read_csv);
 	return read_csv;
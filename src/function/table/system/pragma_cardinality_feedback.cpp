@@ -0,0 +1,64 @@
+#include "duckdb/function/table/system_functions.hpp"
+
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
+
+namespace duckdb {
+
+struct PragmaCardinalityFeedbackData : public GlobalTableFunctionState {
+	PragmaCardinalityFeedbackData() : offset(0) {
+	}
+
+	vector<CardinalityFeedbackEntry> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> PragmaCardinalityFeedbackBind(ClientContext &context, TableFunctionBindInput &input,
+                                                              vector<LogicalType> &return_types,
+                                                              vector<string> &names) {
+	names.emplace_back("hash");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("subplan");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("estimated_cardinality");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("actual_cardinality");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("observations");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> PragmaCardinalityFeedbackInit(ClientContext &context,
+                                                                   TableFunctionInitInput &input) {
+	auto result = make_uniq<PragmaCardinalityFeedbackData>();
+	result->entries = CardinalityFeedback::Get(context).GetEntries();
+	return std::move(result);
+}
+
+void PragmaCardinalityFeedbackFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<PragmaCardinalityFeedbackData>();
+	idx_t count = 0;
+	for (; data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE; data.offset++) {
+		auto &entry = data.entries[data.offset];
+		idx_t col = 0;
+		output.data[col++].SetValue(count, Value::UBIGINT(entry.hash));
+		output.data[col++].SetValue(count, Value(entry.subplan));
+		output.data[col++].SetValue(count, Value::BIGINT(entry.estimated_cardinality));
+		output.data[col++].SetValue(count, Value::BIGINT(entry.actual_cardinality));
+		output.data[col++].SetValue(count, Value::BIGINT(entry.observations));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void PragmaCardinalityFeedback::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("pragma_cardinality_feedback", {}, PragmaCardinalityFeedbackFunction,
+	                              PragmaCardinalityFeedbackBind, PragmaCardinalityFeedbackInit));
+}
+
+} // namespace duckdb
@@ -0,0 +1,69 @@
+#include "duckdb/function/table/system_functions.hpp"
+
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/main/plan_cache.hpp"
+
+namespace duckdb {
+
+struct PragmaPlanCacheInfoData : public GlobalTableFunctionState {
+	PragmaPlanCacheInfoData() : finished(false) {
+	}
+
+	bool finished;
+};
+
+static unique_ptr<FunctionData> PragmaPlanCacheInfoBind(ClientContext &context, TableFunctionBindInput &input,
+                                                        vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("cache_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("entries");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("hits");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("misses");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("invalidations");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("evictions");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("hit_rate");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> PragmaPlanCacheInfoInit(ClientContext &context, TableFunctionInitInput &input) {
+	return make_uniq<PragmaPlanCacheInfoData>();
+}
+
+void PragmaPlanCacheInfoFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<PragmaPlanCacheInfoData>();
+	if (data.finished) {
+		return;
+	}
+	auto &cache = PlanCache::Get(context);
+	auto lookups = cache.hits + cache.misses;
+	idx_t col = 0;
+	output.data[col++].SetValue(0, Value::BIGINT(ClientConfig::GetConfig(context).plan_cache_size));
+	output.data[col++].SetValue(0, Value::BIGINT(cache.Count()));
+	output.data[col++].SetValue(0, Value::BIGINT(cache.hits));
+	output.data[col++].SetValue(0, Value::BIGINT(cache.misses));
+	output.data[col++].SetValue(0, Value::BIGINT(cache.invalidations));
+	output.data[col++].SetValue(0, Value::BIGINT(cache.evictions));
+	output.data[col++].SetValue(0, lookups == 0 ? Value() : Value::DOUBLE(double(cache.hits) / double(lookups)));
+	output.SetCardinality(1);
+	data.finished = true;
+}
+
+void PragmaPlanCacheInfo::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("pragma_plan_cache_info", {}, PragmaPlanCacheInfoFunction, PragmaPlanCacheInfoBind,
+	                              PragmaPlanCacheInfoInit));
+}
+
+} // namespace duckdb
@@ -24,9 +24,16 @@ public:
 
 	//! Append a data chunk to the underlying arrow array
 	DUCKDB_API void Append(DataChunk &input, idx_t from, idx_t to, idx_t input_size);
+	//! Append a data chunk to the (empty) appender without copying the columns whose layout matches the arrow layout:
+	//! the arrow arrays point directly at the memory of those vectors, which is taken over from the chunk (see
+	//! DataChunk::TryDetachVector). The remaining columns are copied. No other chunks can be appended afterwards.
+	DUCKDB_API void AppendZeroCopy(Allocator &allocator, DataChunk &input);
 	//! Returns the underlying arrow array
 	DUCKDB_API ArrowArray Finalize();
 
+	//! Whether or not arrow arrays of the type have the same memory layout as DuckDB vectors of the type
+	DUCKDB_API static bool LayoutMatches(const LogicalType &type);
+
 private:
 	//! The types of the chunks that will be appended in
 	vector<LogicalType> types;
@@ -34,6 +41,8 @@ private:
 	vector<unique_ptr<ArrowAppendData>> root_data;
 	//! The total row count that has been appended
 	idx_t row_count = 0;
+	//! Whether or not the arrays reference the memory of an appended chunk
+	bool zero_copy = false;
 };
 
 } // namespace duckdb
@@ -0,0 +1,50 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/arrow/arrow_query_result.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/main/query_result.hpp"
+#include "duckdb/common/arrow/arrow_wrapper.hpp"
+
+namespace duckdb {
+
+//! The ArrowQueryResult holds the result of a query as a set of Arrow record batches, which are produced by the
+//! PhysicalArrowCollector while the query runs. The record batches can only be consumed once.
+class ArrowQueryResult : public QueryResult {
+public:
+	//! Creates a successful query result with the specified names and types
+	DUCKDB_API ArrowQueryResult(StatementType statement_type, StatementProperties properties, vector<string> names,
+	                            vector<LogicalType> types, ClientProperties client_properties, idx_t batch_size);
+	//! Creates an unsuccessful query result with error condition
+	DUCKDB_API explicit ArrowQueryResult(PreservedError error);
+
+public:
+	//! Fetching DataChunks is not supported, the record batches should be consumed instead
+	DUCKDB_API unique_ptr<DataChunk> Fetch() override;
+	DUCKDB_API unique_ptr<DataChunk> FetchRaw() override;
+	//! Converts the QueryResult to a string
+	DUCKDB_API string ToString() override;
+
+	//! The (maximum) amount of rows of a record batch
+	DUCKDB_API idx_t BatchSize() const;
+	//! The total amount of rows in the record batches
+	DUCKDB_API idx_t RowCount() const;
+	//! Takes the record batches out of the result
+	DUCKDB_API vector<unique_ptr<ArrowArrayWrapper>> ConsumeArrays();
+	//! Takes the next record batch out of the result, or returns nullptr if all record batches have been consumed
+	DUCKDB_API unique_ptr<ArrowArrayWrapper> ConsumeNextArray();
+	DUCKDB_API void SetArrays(vector<unique_ptr<ArrowArrayWrapper>> arrays);
+
+private:
+	idx_t batch_size;
+	vector<unique_ptr<ArrowArrayWrapper>> arrays;
+	//! The index of the next record batch returned by ConsumeNextArray
+	idx_t next_array;
+};
+
+} // namespace duckdb
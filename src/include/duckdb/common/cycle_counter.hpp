@@ -10,6 +10,7 @@
 
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/chrono.hpp"
+#include "duckdb/common/hardware_counters.hpp"
 
 namespace duckdb {
 
@@ -28,6 +29,9 @@ public:
 	void BeginSample() {
 		if (current_count >= next_sample) {
 			tmp = Tick();
+			if (count_hardware_events) {
+				HardwareCounters::Read(counters_start);
+			}
 		}
 	}
 
@@ -35,6 +39,10 @@ public:
 	void EndSample(int chunk_size) {
 		if (current_count >= next_sample) {
 			time += Tick() - tmp;
+			HardwareCounterValues counters_end;
+			if (count_hardware_events && HardwareCounters::Read(counters_end)) {
+				counters += counters_end - counters_start;
+			}
 		}
 		if (current_count >= next_sample) {
 			next_sample = SAMPLING_RATE;
@@ -47,6 +55,10 @@ public:
 		tuples_count += chunk_size;
 	}
 
+public:
+	//! Whether or not the hardware counters are sampled together with the time
+	bool count_hardware_events = false;
+
 private:
 	uint64_t Tick() const;
 	// current number on RDT register
@@ -63,6 +75,10 @@ private:
 	uint64_t sample_tuples_count = 0;
 	//! Count the number of ALL tuples
 	uint64_t tuples_count = 0;
+	//! The hardware counters at the start of the current sample
+	HardwareCounterValues counters_start;
+	//! The hardware counters accumulated over all samples
+	HardwareCounterValues counters;
 };
 
 } // namespace duckdb
@@ -0,0 +1,22 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/holistic_aggregate_mode.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! How grouped holistic aggregates (quantiles, mode, string_agg, list, ...) keep the values of their groups
+//! IN_MEMORY: every group accumulates its values in memory in the aggregate hash table
+//! SPILL: the input is partitioned and sorted by the groups in spillable memory, and every group is aggregated on its
+//! own while scanning the sorted partitions
+//! APPROXIMATE: quantiles are computed with constant-size sketches, the remaining holistic aggregates spill
+enum class HolisticAggregateMode : uint8_t { IN_MEMORY = 0, SPILL = 1, APPROXIMATE = 2 };
+
+} // namespace duckdb
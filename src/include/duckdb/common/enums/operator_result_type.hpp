@@ -29,10 +29,21 @@ enum class OperatorResultType : uint8_t { NEED_MORE_INPUT, HAVE_MORE_OUTPUT, FIN
 enum class OperatorFinalizeResultType : uint8_t { HAVE_MORE_OUTPUT, FINISHED };
 
 //! The SinkResultType is used to indicate the result of data flowing into a sink
-//! There are two possible results:
+//! There are three possible results:
 //! NEED_MORE_INPUT means the sink needs more input
 //! FINISHED means the sink is finished executing, and more input will not change the result any further
-enum class SinkResultType : uint8_t { NEED_MORE_INPUT, FINISHED };
+//! BLOCKED means the sink consumed the input, but cannot accept more input for now (e.g. because a buffer is full).
+//! The pipeline is paused until the callback of the InterruptState of the ExecutionContext has been made
+enum class SinkResultType : uint8_t { NEED_MORE_INPUT, FINISHED, BLOCKED };
+
+//! The SourceResultType is used to indicate the result of data being pulled out of a source
+//! There are three possible results:
+//! HAVE_MORE_OUTPUT means the source has more output, this flag should only be set when data is returned, empty results
+//! should only occur for the FINISHED and BLOCKED flags
+//! FINISHED means the source is exhausted
+//! BLOCKED means the source is currently blocked, e.g. by some async I/O. The source will be called again once the
+//! callback of its InterruptState has been made
+enum class SourceResultType : uint8_t { HAVE_MORE_OUTPUT, FINISHED, BLOCKED };
 
 //! The SinkFinalizeType is used to indicate the result of a Finalize call on a sink
 //! There are two possible results:
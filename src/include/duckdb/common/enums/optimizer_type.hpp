@@ -22,6 +22,7 @@ enum class OptimizerType : uint32_t {
 	JOIN_ORDER,
 	DELIMINATOR,
 	UNNEST_REWRITER,
+	AGGREGATE_PUSHDOWN,
 	UNUSED_COLUMNS,
 	STATISTICS_PROPAGATION,
 	COMMON_SUBEXPRESSIONS,
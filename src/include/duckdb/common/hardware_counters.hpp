@@ -0,0 +1,55 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/hardware_counters.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+
+//! The values of the hardware performance counters that are attributed to operators and expressions
+struct HardwareCounterValues {
+	uint64_t cycles = 0;
+	uint64_t instructions = 0;
+	uint64_t llc_misses = 0;
+	uint64_t branch_misses = 0;
+
+	HardwareCounterValues &operator+=(const HardwareCounterValues &other) {
+		cycles += other.cycles;
+		instructions += other.instructions;
+		llc_misses += other.llc_misses;
+		branch_misses += other.branch_misses;
+		return *this;
+	}
+	//! The difference between this (later) reading and an earlier reading
+	HardwareCounterValues operator-(const HardwareCounterValues &start) const {
+		HardwareCounterValues result;
+		result.cycles = cycles - start.cycles;
+		result.instructions = instructions - start.instructions;
+		result.llc_misses = llc_misses - start.llc_misses;
+		result.branch_misses = branch_misses - start.branch_misses;
+		return result;
+	}
+	bool IsEmpty() const {
+		return cycles == 0 && instructions == 0 && llc_misses == 0 && branch_misses == 0;
+	}
+};
+
+//! HardwareCounters reads the hardware performance counters (cycles, instructions, last-level cache misses and
+//! branch misses) of the calling thread. The counters are opened through perf_event_open on first use and only
+//! count user-space events. On platforms without perf events, or when they are not permitted (see
+//! /proc/sys/kernel/perf_event_paranoid), no counters are available and all values are zero.
+class HardwareCounters {
+public:
+	//! Read the current counter values of the calling thread. Returns false if no counters are available.
+	DUCKDB_API static bool Read(HardwareCounterValues &result);
+	//! Whether or not hardware counters are available on the calling thread
+	DUCKDB_API static bool IsAvailable();
+};
+
+} // namespace duckdb
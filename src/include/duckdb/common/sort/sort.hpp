@@ -51,6 +51,14 @@ public:
 	unordered_map<idx_t, idx_t> sorting_to_blob_col;
 };
 
+//! The slices of the sorted blocks that fall into one key range of a k-way merge
+struct KWayMergePartition {
+	//! The slices (one per sorted block that has rows in this key range)
+	vector<unique_ptr<SortedBlock>> slices;
+	//! The entry index of the first row of every slice
+	vector<idx_t> entry_idxs;
+};
+
 struct GlobalSortState {
 public:
 	GlobalSortState(BufferManager &buffer_manager, const vector<BoundOrderByNode> &orders, RowLayout &payload_layout);
@@ -64,6 +72,14 @@ public:
 	//! Completes the cascaded merge sort round.
 	//! Pass true if you wish to use the radix data for further comparisons.
 	void CompleteMergeRound(bool keep_radix_data = false);
+	//! The maximum number of sorted blocks that the given number of threads can merge with a single k-way merge
+	idx_t KWayMergeFanIn(idx_t threads) const;
+	//! Initializes the global sort state for merging all sorted blocks at once with a k-way merge,
+	//! range-partitioned into (at most) partition_count partitions that can be merged independently
+	void InitializeKWayMerge(idx_t partition_count);
+	//! Completes the k-way merge by concatenating the merged partitions into a single sorted block.
+	//! Pass true if you wish to use the radix data for further comparisons.
+	void CompleteKWayMerge(bool keep_radix_data = false);
 	//! Print the sorted data to the console.
 	void Print();
 
@@ -96,6 +112,10 @@ public:
 	idx_t num_pairs;
 	idx_t l_start;
 	idx_t r_start;
+
+	//! Progress in the k-way merge stage (the merged partitions are written to sorted_blocks_temp)
+	vector<KWayMergePartition> kway_partitions;
+	idx_t kway_partition_idx;
 };
 
 struct LocalSortState {
@@ -204,4 +224,61 @@ private:
 	                data_ptr_t &target_heap_ptr, idx_t &copied, const idx_t &count);
 };
 
+//! Merges all sorted blocks in a single pass. The key range is split into partitions using splitters that are
+//! sampled from the sorted blocks, so that every partition can be merged by a single thread with a loser tree.
+struct KWayMergeSorter {
+public:
+	KWayMergeSorter(GlobalSortState &state, BufferManager &buffer_manager);
+
+	//! Range-partitions the sorted blocks of the global state (see GlobalSortState::InitializeKWayMerge)
+	static void ComputePartitions(GlobalSortState &state, idx_t partition_count);
+	//! Merges partitions until all partitions of the k-way merge are merged
+	void PerformKWayMerge();
+
+private:
+	//! Merges the slices of a single partition into a sequence of sorted blocks
+	void MergePartition(KWayMergePartition &partition, vector<unique_ptr<SortedBlock>> &result);
+
+	//! Skips exhausted blocks of an input, and pins the block that it is positioned in
+	void PinInput(SBScanState &input);
+	//! Whether an input has no rows left
+	inline bool Exhausted(const SBScanState &input) const {
+		return input.block_idx == input.sb->radix_sorting_data.size();
+	}
+	//! Whether the current row of input l sorts before the current row of input r
+	bool InputIsSmaller(idx_t l, idx_t r);
+
+	//! Builds the loser tree over all inputs
+	void InitializeLoserTree();
+	//! Replays the matches of the winner after it has been advanced, and returns the new winner
+	idx_t ReplayLoserTree(idx_t winner);
+
+	//! Starts a new sorted block to write the merged rows to
+	void InitializeWrite(vector<unique_ptr<SortedBlock>> &result);
+	//! Copies the current row of an input to the result
+	void CopyRow(SBScanState &input);
+	//! Copies the current row of the SortedData of an input to the result SortedData
+	void CopyData(SortedData &target, SortedData &source, SBScanState &input, BufferHandle &target_data_handle,
+	              BufferHandle &target_heap_handle);
+
+private:
+	//! The global sorting state
+	GlobalSortState &state;
+	BufferManager &buffer_manager;
+	const SortLayout &sort_layout;
+
+	//! The readers of the slices of the partition that is being merged
+	vector<unique_ptr<SBScanState>> inputs;
+	//! The internal nodes of the loser tree (the inputs that lost the match in that node)
+	vector<idx_t> losers;
+
+	//! The sorted block that is being written to, and the pinned blocks it is writing to
+	SortedBlock *result;
+	BufferHandle radix_handle;
+	BufferHandle blob_data_handle;
+	BufferHandle blob_heap_handle;
+	BufferHandle payload_data_handle;
+	BufferHandle payload_heap_handle;
+};
+
 } // namespace duckdb
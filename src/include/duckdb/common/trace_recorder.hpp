@@ -0,0 +1,148 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/trace_recorder.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/vector.hpp"
+
+namespace duckdb {
+class ClientContext;
+class DatabaseInstance;
+
+//! A single event recorded by the TraceRecorder: a span of time on a thread, or an instant if it has no duration
+struct TraceEvent {
+	static constexpr const idx_t MAX_NAME_LENGTH = 95;
+
+	char name[MAX_NAME_LENGTH + 1];
+	//! The category of the event (a string literal)
+	const char *category;
+	//! The thread the event was recorded on
+	idx_t thread_id;
+	//! Start time and duration (in nanoseconds, relative to the creation of the recorder)
+	uint64_t start;
+	uint64_t duration;
+	//! The number of bytes involved (e.g. in a read), or -1 if not applicable
+	int64_t bytes;
+	bool instant;
+};
+
+//! The TraceRecorder records a timeline of task executions, event transitions, buffer evictions and file reads, and
+//! exports it in the Chrome trace format (loadable in chrome://tracing or Perfetto).
+//! Every database has its own recorder. File handles and buffer pools are not tied to a database: their events are
+//! recorded into the recorder of the database whose task the thread is executing (see TraceThreadScope).
+//! Every thread records into its own ring buffer, so recording does not contend between threads; when a ring buffer
+//! is full the oldest events of that thread are overwritten.
+class TraceRecorder {
+public:
+	//! The maximum number of events kept per thread
+	static constexpr const idx_t RING_BUFFER_CAPACITY = 1 << 16;
+
+	struct ThreadBuffer {
+		mutex lock;
+		//! The thread currently recording into this buffer
+		idx_t thread_id;
+		//! Whether or not a live thread owns the buffer
+		bool in_use = false;
+		//! The recording generation the events belong to (events of earlier generations are discarded)
+		idx_t generation = 0;
+		vector<TraceEvent> events;
+		//! The position to overwrite next once the ring buffer is full
+		idx_t next = 0;
+	};
+
+public:
+	TraceRecorder();
+	~TraceRecorder();
+
+	DUCKDB_API static TraceRecorder &Get(DatabaseInstance &db);
+	DUCKDB_API static TraceRecorder &Get(ClientContext &context);
+	//! The recorder of the database whose task the calling thread is executing, or nullptr
+	static TraceRecorder *Current();
+
+	//! Whether or not events are being recorded - this is checked (cheaply) before recording anything
+	bool IsEnabled() const {
+		return enabled.load(std::memory_order_relaxed);
+	}
+	//! Discard the previously recorded events and start recording
+	DUCKDB_API void Enable();
+	//! Stop recording, the events recorded so far are kept until the recorder is enabled again
+	DUCKDB_API void Disable();
+
+	//! The current time in nanoseconds relative to the creation of the recorder
+	uint64_t Now() const;
+	//! Record a span [start, end) on the calling thread
+	void Record(const char *category, const string &name, uint64_t start, uint64_t end, int64_t bytes = -1);
+	//! Record an instant event on the calling thread
+	void RecordInstant(const char *category, const string &name);
+
+	//! The number of events that are currently held by the recorder
+	DUCKDB_API idx_t EventCount();
+	//! Render the recorded events as Chrome trace JSON
+	DUCKDB_API string ToChromeTrace();
+
+	//! Release the buffer of a thread that is exiting, the buffer can be reused by another thread
+	void ReleaseThreadBuffer(ThreadBuffer &buffer);
+
+private:
+	ThreadBuffer &GetThreadBuffer();
+	TraceEvent &AddEvent(ThreadBuffer &buffer);
+
+private:
+	//! Identifies the recorder in the buffer caches of the threads (unique within the process)
+	const idx_t recorder_id;
+	atomic<bool> enabled;
+	//! Incremented every time the recorder is enabled
+	atomic<idx_t> generation;
+	uint64_t epoch;
+
+	mutex lock;
+	vector<unique_ptr<ThreadBuffer>> buffers;
+	idx_t next_thread_id;
+};
+
+//! Makes the recorder of a database the recorder of the calling thread for the lifetime of the scope
+class TraceThreadScope {
+public:
+	explicit TraceThreadScope(TraceRecorder &recorder);
+	~TraceThreadScope();
+
+private:
+	TraceRecorder *previous;
+};
+
+//! Records the time between its construction and destruction as a span into the recorder of the calling thread, if
+//! tracing is enabled
+class TraceScope {
+public:
+	TraceScope(const char *category, const char *name, int64_t bytes = -1);
+	~TraceScope();
+
+	bool IsActive() const {
+		return active;
+	}
+	//! Set a dynamic name for the span (only call this if the scope is active)
+	void SetName(string name_p) {
+		name = std::move(name_p);
+	}
+	void SetBytes(int64_t bytes_p) {
+		bytes = bytes_p;
+	}
+
+private:
+	TraceRecorder *recorder;
+	bool active;
+	const char *category;
+	string name;
+	int64_t bytes;
+	uint64_t start;
+};
+
+} // namespace duckdb
@@ -80,6 +80,11 @@ public:
 	DUCKDB_API void Reference(DataChunk &chunk);
 	//! Set the DataChunk to own the data of data chunk, destroying the other chunk in the process
 	DUCKDB_API void Move(DataChunk &chunk);
+	//! Makes the result vector take over the memory of the (flat, fixed-size) vector at the given index, so that it
+	//! stays valid after this chunk is Reset: the chunk allocates new memory for the column instead of re-using the
+	//! old memory. Returns false if the vector references memory that the chunk does not own (e.g. the memory of
+	//! another chunk), which can be overwritten at any time.
+	DUCKDB_API bool TryDetachVector(Allocator &allocator, idx_t col_idx, Vector &result);
 
 	//! Initializes the DataChunk with the specified types to an empty DataChunk
 	//! This will create one vector of the specified type for each LogicalType in the
@@ -29,11 +29,16 @@ public:
 
 	//! Adds an element of the specified size to the HyperLogLog counter
 	void Add(data_ptr_t element, idx_t size);
+	//! Adds the (non-NULL) values of a vector to the HyperLogLog counter
+	void Update(Vector &input, idx_t count);
+	void Update(UnifiedVectorFormat &vdata, const LogicalType &type, idx_t count);
 	//! Return the count of this HyperLogLog counter
 	idx_t Count() const;
 	//! Merge this HyperLogLog counter with another counter to create a new one
 	unique_ptr<HyperLogLog> Merge(HyperLogLog &other);
 	HyperLogLog *MergePointer(HyperLogLog &other);
+	//! Merge another HyperLogLog counter into this counter
+	void MergeInPlace(HyperLogLog &other);
 	//! Merge a set of HyperLogLogs to create one big one
 	static unique_ptr<HyperLogLog> Merge(HyperLogLog logs[], idx_t count);
 	//! Get the size (in bytes) of a HLL
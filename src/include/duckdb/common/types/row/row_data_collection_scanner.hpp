@@ -50,6 +50,11 @@ public:
 	RowDataCollectionScanner(RowDataCollection &rows, RowDataCollection &heap, const RowLayout &layout, bool external,
 	                         bool flush = true);
 
+	//! Scan a single block, whose first row is block_start. The scan positions are still relative to the start of
+	//! the collection, and only the scanned block is flushed, so different threads can scan different blocks.
+	RowDataCollectionScanner(RowDataCollection &rows, RowDataCollection &heap, const RowLayout &layout, bool external,
+	                         idx_t block_idx, idx_t block_start, bool flush);
+
 	//! The type layout of the payload
 	inline const vector<LogicalType> &GetTypes() const {
 		return layout.GetTypes();
@@ -96,6 +101,10 @@ private:
 	const idx_t total_count;
 	//! The number of rows scanned so far
 	idx_t total_scanned;
+	//! The first block being scanned
+	const idx_t block_begin;
+	//! The number of rows before the first block
+	const idx_t scan_begin;
 	//! Addresses used to gather from the sorted data
 	Vector addresses = Vector(LogicalType::POINTER);
 	//! Whether the blocks can be flushed to disk
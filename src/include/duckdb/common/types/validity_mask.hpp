@@ -136,6 +136,10 @@ public:
 	inline V *GetData() const {
 		return validity_mask;
 	}
+	//! Whether or not the mask is stored in memory that is kept alive by (copies of) this mask
+	inline bool IsOwned() const {
+		return !validity_mask || (validity_data && validity_mask == validity_data->owned_data.get());
+	}
 	inline void Reset() {
 		validity_mask = nullptr;
 		validity_data.reset();
@@ -27,6 +27,8 @@ public:
 
 public:
 	void ResetFromCache(Vector &result) const;
+	//! Whether or not the data of the (non-nested) vector is the memory owned by this cache
+	bool OwnsData(const Vector &vector) const;
 
 	const LogicalType &GetType() const;
 };
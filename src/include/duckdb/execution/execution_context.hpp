@@ -15,6 +15,7 @@ namespace duckdb {
 class ClientContext;
 class ThreadContext;
 class Pipeline;
+class InterruptState;
 
 class ExecutionContext {
 public:
@@ -28,6 +29,8 @@ public:
 	ThreadContext &thread;
 	//! Reference to the pipeline for this execution, can be used for example by operators determine caching strategy
 	optional_ptr<Pipeline> pipeline;
+	//! The interrupt state of the pipeline executor (if any), used by sinks that return SinkResultType::BLOCKED
+	optional_ptr<InterruptState> interrupt_state;
 };
 
 } // namespace duckdb
@@ -13,8 +13,12 @@
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/pair.hpp"
 #include "duckdb/common/reference_map.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/unordered_set.hpp"
 #include "duckdb/parallel/pipeline.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 class ClientContext;
 class DataChunk;
@@ -88,12 +92,26 @@ public:
 	bool HasResultCollector();
 	//! Returns the query result - can only be used if `HasResultCollector` returns true
 	unique_ptr<QueryResult> GetResult();
+	//! Whether or not the root of the pipeline is a result collector that streams the result through FetchChunk
+	bool HasStreamingResultCollector();
 
 	//! Returns true if all pipelines have been completed
 	bool ExecutionIsFinished();
 
+	//! Parks a task that returned TASK_BLOCKED until it is rescheduled (or the executor is cancelled)
+	void AddToBeRescheduled(shared_ptr<Task> &task);
+	//! Reschedules a task that was blocked, if it was woken up before being parked it is rescheduled immediately
+	void RescheduleTask(shared_ptr<Task> &task);
+	//! Schedules a partially executed task again (unless the executor was cancelled)
+	void RequeueTask(shared_ptr<Task> &task);
+	//! Whether or not there are tasks that are waiting to be rescheduled
+	bool HasBlockedTasks();
+	//! Waits (for at most WAIT_TIME_MICROS) until a blocked task is rescheduled
+	void WaitForTask();
+
 private:
 	void InitializeInternal(PhysicalOperator &physical_plan);
+	PendingExecutionResult ExecuteTaskInternal();
 
 	void ScheduleEvents(const vector<shared_ptr<MetaPipeline>> &meta_pipelines);
 	static void ScheduleEventsInternal(ScheduleEventData &event_data);
@@ -146,6 +164,15 @@ private:
 	//! The last pending execution result (if any)
 	PendingExecutionResult execution_result;
 	//! The current task in process (if any)
-	unique_ptr<Task> task;
+	shared_ptr<Task> task;
+
+	//! The maximum time to wait for a blocked task to be rescheduled in WaitForTask
+	static constexpr const int64_t WAIT_TIME_MICROS = 20000;
+	//! Tasks that returned TASK_BLOCKED and are waiting for their InterruptState callback
+	unordered_map<Task *, shared_ptr<Task>> to_be_rescheduled_tasks;
+	//! Tasks of which the callback was made before the task was parked
+	unordered_set<Task *> woken_up_tasks;
+	//! Signalled whenever a blocked task is rescheduled
+	std::condition_variable task_reschedule;
 };
 } // namespace duckdb
@@ -11,6 +11,7 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/cycle_counter.hpp"
+#include "duckdb/execution/fused_expression.hpp"
 #include "duckdb/function/function.hpp"
 
 namespace duckdb {
@@ -59,6 +60,8 @@ struct ExpressionExecutorState {
 	unique_ptr<ExpressionState> root_state;
 	ExpressionExecutor *executor = nullptr;
 	CycleCounter profiler;
+	//! The fused form of the expression, if it could be compiled into one
+	unique_ptr<FusedExpression> fused_expression;
 
 	void Verify();
 };
@@ -0,0 +1,95 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/fused_expression.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+
+namespace duckdb {
+class Expression;
+
+//! A fused kernel computes a single operation over a block of values, and returns false if the operation overflowed
+typedef bool (*fused_kernel_t)(const_data_ptr_t left, const_data_ptr_t right, data_ptr_t result, idx_t count);
+//! Returns the kernel instantiated for the given input type and constant-ness of the inputs (or nullptr)
+typedef fused_kernel_t (*fused_kernel_selector_t)(PhysicalType type, bool left_constant, bool right_constant);
+
+enum class FusedOperandType : uint8_t { COLUMN, CONSTANT, REGISTER };
+
+struct FusedOperand {
+	FusedOperandType type;
+	//! The column, constant or register index
+	idx_t index;
+	//! The width of a single value of the operand in bytes
+	idx_t width;
+};
+
+struct FusedInstruction {
+	fused_kernel_t kernel;
+	FusedOperand left;
+	FusedOperand right;
+	FusedOperand result;
+};
+
+//! A FusedExpression evaluates a tree of arithmetic (+, -, *), comparisons and conjunctions over flat numeric columns
+//! without materializing any intermediate Vectors. The tree is compiled into a program of pre-instantiated,
+//! type-specialized kernels, which runs over blocks of BLOCK_SIZE rows so that all intermediates stay in small,
+//! cache-resident registers. Chunks that the program cannot handle (NULL values, non-flat inputs, overflows) are left
+//! to the regular expression interpreter.
+class FusedExpression {
+public:
+	//! The amount of rows the kernels process at a time
+	static constexpr const idx_t BLOCK_SIZE = 128;
+
+public:
+	//! Compiles the expression, or returns nullptr if it is not worth fusing (or cannot be fused)
+	static unique_ptr<FusedExpression> TryCompile(const Expression &expr);
+
+	//! Computes the expression for the input into the (flat) result vector
+	//! Returns false if the input could not be handled, in which case the interpreter should be used instead
+	bool Execute(DataChunk &input, Vector &result);
+	//! Computes the rows of the input for which the (boolean) expression holds
+	//! Returns false if the input could not be handled, in which case the interpreter should be used instead
+	bool Select(DataChunk &input, SelectionVector &true_sel, idx_t &true_count);
+
+private:
+	FusedExpression() = default;
+
+	bool CompileExpression(const Expression &expr, FusedOperand &result);
+	bool CompileBinary(const Expression &left, const Expression &right, fused_kernel_selector_t selector,
+	                   PhysicalType result_type, FusedOperand &result);
+	bool AddInstruction(const FusedOperand &left, const FusedOperand &right, PhysicalType input_type,
+	                    fused_kernel_selector_t selector, PhysicalType result_type, FusedOperand &result);
+	FusedOperand AddRegister(idx_t width);
+
+	//! Prepares the column pointers for the input chunk, returns false if any of the inputs is not flat or has NULLs
+	bool PrepareInput(DataChunk &input);
+	//! Runs the program over a block of rows, writing the final result to the given target (if set)
+	bool RunBlock(idx_t offset, idx_t count, data_ptr_t target);
+	const_data_ptr_t GetOperandData(const FusedOperand &operand, idx_t offset);
+
+private:
+	//! The program, the last instruction computes the result
+	vector<FusedInstruction> program;
+	//! The referenced columns of the input and their types
+	vector<idx_t> column_indexes;
+	vector<PhysicalType> column_types;
+	//! The constants used by the program (each occupies 8 bytes)
+	vector<int64_t> constants;
+	//! The amount of registers used by the program
+	idx_t register_count = 0;
+	//! The type of the result
+	PhysicalType result_type;
+	//! The registers, each holds BLOCK_SIZE values of up to 8 bytes
+	unique_ptr<data_t[]> registers;
+	//! The column data of the current input chunk
+	vector<const_data_ptr_t> column_data;
+};
+
+} // namespace duckdb
@@ -10,12 +10,17 @@
 
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/execution/base_aggregate_hashtable.hpp"
+#include "duckdb/execution/operator/aggregate/grouped_aggregate_data.hpp"
+#include "duckdb/execution/radix_partitioned_hashtable.hpp"
 
 namespace duckdb {
 class ClientContext;
 class PerfectAggregateHashTable;
+class PerfectHashGroupDictionary;
 
-//! PhysicalPerfectHashAggregate performs a group-by and aggregation using a perfect hash table
+//! PhysicalPerfectHashAggregate performs a group-by and aggregation using a perfect hash table. String groups are
+//! encoded with dictionaries that are built while the input is sunk; if a dictionary overflows, the remaining input is
+//! aggregated in a radix partitioned hash table instead.
 class PhysicalPerfectHashAggregate : public PhysicalOperator {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::PERFECT_HASH_GROUP_BY;
@@ -34,6 +39,8 @@ public:
 public:
 	// Source interface
 	unique_ptr<GlobalSourceState> GetGlobalSourceState(ClientContext &context) const override;
+	unique_ptr<LocalSourceState> GetLocalSourceState(ExecutionContext &context,
+	                                                 GlobalSourceState &gstate) const override;
 	void GetData(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate,
 	             LocalSourceState &lstate) const override;
 
@@ -49,6 +56,8 @@ public:
 	SinkResultType Sink(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate,
 	                    DataChunk &input) const override;
 	void Combine(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate) const override;
+	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+	                          GlobalSinkState &gstate) const override;
 
 	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
 	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
@@ -56,7 +65,9 @@ public:
 	string ParamsToString() const override;
 
 	//! Create a perfect aggregate hash table for this node
-	unique_ptr<PerfectAggregateHashTable> CreateHT(Allocator &allocator, ClientContext &context) const;
+	unique_ptr<PerfectAggregateHashTable>
+	CreateHT(Allocator &allocator, ClientContext &context,
+	         const vector<shared_ptr<PerfectHashGroupDictionary>> &dictionaries) const;
 
 	bool IsSink() const override {
 		return true;
@@ -77,12 +88,19 @@ public:
 	vector<LogicalType> payload_types;
 	//! The aggregates to be computed
 	vector<AggregateObject> aggregate_objects;
-	//! The minimum value of each of the groups
+	//! The minimum value of each of the groups (NULL for string groups)
 	vector<Value> group_minima;
 	//! The number of bits we need to completely cover each of the groups
 	vector<idx_t> required_bits;
 
 	unordered_map<Expression *, size_t> filter_indexes;
+
+	//! The groups and aggregates of the radix partitioned hash table that is used once a dictionary has overflowed
+	GroupingSet grouping_set;
+	GroupedAggregateData grouped_aggregate_data;
+	unique_ptr<RadixPartitionedHashTable> fallback_table;
+	//! The indexes of the aggregates that are computed by the fallback table (all of them)
+	vector<idx_t> fallback_filter;
 };
 
 } // namespace duckdb
@@ -0,0 +1,94 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/aggregate/physical_sort_aggregate.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/execution/operator/aggregate/aggregate_object.hpp"
+#include "duckdb/common/types/row/tuple_data_layout.hpp"
+#include "duckdb/planner/bound_result_modifier.hpp"
+
+namespace duckdb {
+class ClientContext;
+
+//! PhysicalSortAggregate performs a group-by and aggregation by sorting the input on the groups. The input is
+//! partitioned on the hash of the groups, and every partition is sorted with the (external) sort, so that the values
+//! of the groups are kept in memory managed by the buffer manager that can be offloaded to disk. Every group is then
+//! aggregated on its own while scanning the sorted partitions, so that only the state of a single group per thread is
+//! alive at any time. This bounds the memory used by holistic aggregates (e.g. quantiles) that keep all of the values
+//! of their group, which the hash aggregate keeps alive for all groups at the same time.
+class PhysicalSortAggregate : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::SORT_GROUP_BY;
+	//! The maximum amount of partitions the input is divided into
+	static constexpr const idx_t MAX_PARTITIONS = 32;
+
+public:
+	PhysicalSortAggregate(ClientContext &context, vector<LogicalType> types, vector<unique_ptr<Expression>> aggregates,
+	                      vector<unique_ptr<Expression>> groups, idx_t estimated_cardinality);
+
+	//! The groups
+	vector<unique_ptr<Expression>> groups;
+	//! The aggregates that have to be computed
+	vector<unique_ptr<Expression>> aggregates;
+	//! The orders the partitions are sorted on (the groups)
+	vector<BoundOrderByNode> orders;
+	//! The aggregates to be computed
+	vector<AggregateObject> aggregate_objects;
+	//! The layout of the aggregate states of a single group
+	TupleDataLayout layout;
+	//! The amount of partitions the input is divided into
+	idx_t partition_count;
+
+public:
+	//! Whether or not a grouped aggregate with the given aggregates can be computed by sorting
+	static bool CanSortAggregate(const vector<unique_ptr<Expression>> &aggregates);
+
+public:
+	// Source interface
+	unique_ptr<GlobalSourceState> GetGlobalSourceState(ClientContext &context) const override;
+	unique_ptr<LocalSourceState> GetLocalSourceState(ExecutionContext &context,
+	                                                 GlobalSourceState &gstate) const override;
+	void GetData(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate,
+	             LocalSourceState &lstate) const override;
+
+	bool IsSource() const override {
+		return true;
+	}
+	bool ParallelSource() const override {
+		return true;
+	}
+	OrderPreservationType SourceOrder() const override {
+		return OrderPreservationType::NO_ORDER;
+	}
+
+public:
+	// Sink interface
+	SinkResultType Sink(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate,
+	                    DataChunk &input) const override;
+	void Combine(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate) const override;
+	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+	                          GlobalSinkState &gstate) const override;
+
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+
+	bool IsSink() const override {
+		return true;
+	}
+	bool ParallelSink() const override {
+		return true;
+	}
+	bool SinkOrderDependent() const override {
+		return false;
+	}
+
+	string ParamsToString() const override;
+};
+
+} // namespace duckdb
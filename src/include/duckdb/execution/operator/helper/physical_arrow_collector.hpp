@@ -0,0 +1,65 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/helper/physical_arrow_collector.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/operator/helper/physical_result_collector.hpp"
+
+namespace duckdb {
+
+//! PhysicalArrowCollector converts the result of a query into Arrow record batches (an ArrowQueryResult). Every thread
+//! of the final pipeline converts the chunks it produces itself. If insertion order has to be preserved, the record
+//! batches are ordered by the batch index of the chunks they were produced from.
+//! In zero-copy mode every chunk becomes its own record batch, and the arrays of the columns whose layout matches the
+//! arrow layout point directly at the memory of the vectors instead of copying them.
+class PhysicalArrowCollector : public PhysicalResultCollector {
+public:
+	PhysicalArrowCollector(PreparedStatementData &data, bool parallel, bool ordered, idx_t batch_size,
+	                       bool zero_copy);
+
+	//! Whether or not the chunks are converted by multiple threads
+	bool parallel;
+	//! Whether or not the record batches are ordered by batch index
+	bool ordered;
+	//! The (maximum) amount of rows of a record batch
+	idx_t batch_size;
+	//! Whether or not the record batches reference the vector memory
+	bool zero_copy;
+
+public:
+	//! Creates an arrow collector for the statement, which can be used as the ClientConfig::result_collector
+	static unique_ptr<PhysicalResultCollector> Create(ClientContext &context, PreparedStatementData &data,
+	                                                  idx_t batch_size, bool zero_copy = false);
+
+	unique_ptr<QueryResult> GetResult(GlobalSinkState &state) override;
+
+public:
+	// Sink interface
+	SinkResultType Sink(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate,
+	                    DataChunk &input) const override;
+	void Combine(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate) const override;
+	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+	                          GlobalSinkState &gstate) const override;
+
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+
+	bool RequiresBatchIndex() const override {
+		return ordered;
+	}
+
+	bool ParallelSink() const override {
+		return parallel;
+	}
+
+	bool SinkOrderDependent() const override {
+		return true;
+	}
+};
+
+} // namespace duckdb
@@ -0,0 +1,68 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/helper/physical_buffered_collector.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/operator/helper/physical_result_collector.hpp"
+
+namespace duckdb {
+
+//! PhysicalBufferedCollector streams the result of a query to the client through a bounded buffer. The final pipeline
+//! is executed by regular (parallel) tasks that push their chunks into the buffer, while the client fetches chunks from
+//! it. Once the buffer is full the tasks are blocked until the client has made room (back-pressure). If insertion
+//! order has to be preserved, chunks are handed out in batch index order.
+class PhysicalBufferedCollector : public PhysicalResultCollector {
+public:
+	PhysicalBufferedCollector(PreparedStatementData &data, bool parallel, bool ordered);
+
+	//! Whether or not the final pipeline is executed by multiple threads
+	bool parallel;
+	//! Whether or not the chunks are handed out in batch index order
+	bool ordered;
+
+public:
+	//! Creates a buffered collector for the statement, preserving the insertion order if required
+	static unique_ptr<PhysicalResultCollector> Create(ClientContext &context, PreparedStatementData &data);
+
+	unique_ptr<QueryResult> GetResult(GlobalSinkState &state) override;
+	bool IsStreaming() const override {
+		return true;
+	}
+
+	//! Takes the next chunk that can be handed to the client out of the buffer, or returns nullptr if there is none
+	//! (yet). Sets finished if all chunks of the result have been handed out.
+	unique_ptr<DataChunk> FetchChunk(GlobalSinkState &state, bool &finished) const;
+	//! Whether or not the client should start fetching: a chunk can be handed out, the buffer is full or the result
+	//! is complete
+	bool IsReady(GlobalSinkState &state) const;
+
+public:
+	// Sink interface
+	SinkResultType Sink(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate,
+	                    DataChunk &input) const override;
+	void Combine(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate) const override;
+	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+	                          GlobalSinkState &gstate) const override;
+
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+
+	bool RequiresBatchIndex() const override {
+		return ordered;
+	}
+
+	bool ParallelSink() const override {
+		return parallel;
+	}
+
+	bool SinkOrderDependent() const override {
+		return true;
+	}
+};
+
+} // namespace duckdb
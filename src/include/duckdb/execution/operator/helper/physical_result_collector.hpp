@@ -30,6 +30,10 @@ public:
 public:
 	//! The final method used to fetch the query result from this operator
 	virtual unique_ptr<QueryResult> GetResult(GlobalSinkState &state) = 0;
+	//! Whether or not the result is streamed to the client while the query runs (instead of through GetResult)
+	virtual bool IsStreaming() const {
+		return false;
+	}
 
 	bool IsSink() const override {
 		return true;
@@ -34,6 +34,9 @@ public:
 
 	//! Initialize HT for this operator
 	unique_ptr<JoinHashTable> InitializeHashTable(ClientContext &context) const;
+	//! The amount of tuples on the build side, or DConstants::INVALID_INDEX if the build has not been finalized yet
+	//! (or the join is executed externally, in which case the hash table only holds a partition of the build)
+	idx_t GetBuildCardinality() const;
 
 	vector<idx_t> right_projection_map;
 	//! The types of the keys
@@ -13,6 +13,7 @@
 #include "duckdb/planner/bound_query_node.hpp"
 
 namespace duckdb {
+struct DynamicFilterData;
 
 //! Represents a physical ordering of the data. Note that this will not change
 //! the data but only add a selection vector.
@@ -27,6 +28,8 @@ public:
 	vector<BoundOrderByNode> orders;
 	idx_t limit;
 	idx_t offset;
+	//! The filter on the first order that was pushed into the scan, set to the boundary of the heap (optional)
+	shared_ptr<DynamicFilterData> dynamic_filter;
 
 public:
 	// Source interface
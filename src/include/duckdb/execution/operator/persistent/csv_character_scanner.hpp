@@ -0,0 +1,36 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/persistent/csv_character_scanner.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+
+//! The CSVCharacterScanner finds the next occurrence of any of a small set of characters (e.g. the delimiter, quote
+//! and newline characters) in a buffer. The CSV readers use it to skip over the bytes of a value that cannot change the
+//! state of the parser in bulk, instead of testing them one by one.
+class CSVCharacterScanner {
+public:
+	static constexpr idx_t MAX_CHARACTERS = 4;
+
+	explicit CSVCharacterScanner(const vector<char> &characters);
+
+	//! Returns the position of the first character in [start, end) that is in the set, or end if there is none
+	idx_t Find(const char *buffer, idx_t start, idx_t end) const;
+
+private:
+	//! The characters to look for (padded by repeating the first character)
+	char characters[MAX_CHARACTERS];
+	//! Lookup table for the scalar scan, used where SIMD is not available
+	bool is_special[256];
+	//! Every character repeated over a SIMD register, built once so that Find only has to load them
+	char patterns[MAX_CHARACTERS][16];
+};
+
+} // namespace duckdb
@@ -12,6 +12,7 @@
 #include "duckdb/execution/operator/persistent/csv_reader_options.hpp"
 #include "duckdb/execution/operator/persistent/csv_file_handle.hpp"
 #include "duckdb/execution/operator/persistent/csv_buffer.hpp"
+#include "duckdb/execution/operator/persistent/csv_character_scanner.hpp"
 
 #include <sstream>
 #include <utility>
@@ -50,6 +51,21 @@ struct CSVBufferRead {
 		return next_ptr[i - buffer->GetBufferSize()];
 	}
 
+	//! Returns the first position in [position, end) that holds one of the characters of the scanner, or end
+	idx_t Find(const CSVCharacterScanner &scanner, idx_t position, idx_t end) const {
+		auto buffer_size = buffer->GetBufferSize();
+		if (position < buffer_size) {
+			auto limit = MinValue<idx_t>(end, buffer_size);
+			position = scanner.Find(buffer->Ptr(), position, limit);
+			if (position < limit || limit == end) {
+				return position;
+			}
+		}
+		// The remainder is in the next buffer
+		D_ASSERT(next_buffer);
+		return buffer_size + scanner.Find(next_buffer->Ptr(), position - buffer_size, end - buffer_size);
+	}
+
 	string_t GetValue(idx_t start_buffer, idx_t position_buffer, idx_t offset) {
 		idx_t length = position_buffer - start_buffer - offset;
 		// 1) It's all in the current buffer
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/execution/aggregate_hashtable.hpp"
 
 namespace duckdb {
@@ -35,12 +36,22 @@ public:
 	idx_t AddChunk(DataChunk &groups, DataChunk &payload, bool do_partition, const vector<idx_t> &filter);
 	void Partition();
 	bool IsPartitioned();
+	//! Adds a (finalized) hash table to the unpartitioned hash tables
+	void AddHashTable(unique_ptr<GroupedAggregateHashTable> ht);
 
 	HashTableList GetPartition(idx_t partition);
 	HashTableList GetUnpartitioned();
+	//! Aggregates the tuples of a partition that bypassed the local hash tables into the given hash table
+	void CombineBypassedPartition(idx_t partition, GroupedAggregateHashTable &target);
 
 	void Finalize();
 
+public:
+	//! The number of tuples a partitioned table has to see before it decides whether or not to bypass pre-aggregation
+	static constexpr const idx_t BYPASS_SAMPLE_SIZE = 16 * STANDARD_VECTOR_SIZE;
+	//! Pre-aggregation is bypassed if fewer than this many tuples were sunk per group that was created
+	static constexpr const double BYPASS_MINIMUM_REDUCTION = 1.25;
+
 private:
 	ClientContext &context;
 	Allocator &allocator;
@@ -60,7 +71,22 @@ private:
 	vector<HashTableList> radix_partitioned_hts;
 	idx_t tuple_size;
 
+	//! The number of tuples and groups that were added to the partitioned hash tables
+	idx_t partitioned_tuple_count;
+	idx_t partitioned_group_count;
+	//! Once pre-aggregation is found to barely reduce the input, tuples are scattered to these partitions instead
+	unique_ptr<RadixPartitionedTupleData> bypass_data;
+	PartitionedTupleDataAppendState bypass_append_state;
+	DataChunk bypass_chunk;
+	//! The payload columns that are passed in (none for the tables of distinct aggregates)
+	vector<LogicalType> bypass_payload_types;
+	vector<idx_t> bypass_filter;
+
 private:
+	//! Scatters the tuples into the bypass partitions
+	void BypassAddChunk(DataChunk &groups, DataChunk &payload);
+	//! Decides whether or not to stop pre-aggregating, based on the reduction achieved so far
+	bool ShouldBypass() const;
 	idx_t ListAddChunk(HashTableList &list, DataChunk &groups, Vector &group_hashes, DataChunk &payload,
 	                   const vector<idx_t> &filter);
 	//! Returns the HT entry size used for intermediate hash tables
@@ -8,24 +8,57 @@
 
 #pragma once
 
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/string_map_set.hpp"
+#include "duckdb/common/types/string_heap.hpp"
 #include "duckdb/execution/base_aggregate_hashtable.hpp"
 #include "duckdb/storage/arena_allocator.hpp"
 
 namespace duckdb {
+class GroupedAggregateHashTable;
+
+//! The PerfectHashGroupDictionary assigns dense codes to the values of a string group column as they are found, so
+//! that they can be used as the index into a perfect aggregate hash table. Code 0 is reserved for NULL. The dictionary
+//! is shared by the hash tables of all threads, so that their codes agree.
+class PerfectHashGroupDictionary {
+public:
+	explicit PerfectHashGroupDictionary(idx_t capacity);
+
+	//! Looks up the code of a value, assigning the next code if the value was not found before. Returns false if the
+	//! dictionary is full. "stored_value" is set to the copy of the value that is owned by the dictionary.
+	bool TryGetCode(const string_t &value, uint32_t &code, string_t &stored_value);
+	//! Returns the value of a code
+	string_t GetValue(uint32_t code);
+
+private:
+	mutex lock;
+	//! The maximum amount of values
+	idx_t capacity;
+	//! The heap the values are stored in
+	StringHeap heap;
+	//! Map of value -> code
+	string_map_t<uint32_t> codes;
+	//! The values, ordered by their code
+	vector<string_t> values;
+};
 
 class PerfectAggregateHashTable : public BaseAggregateHashTable {
 public:
 	PerfectAggregateHashTable(ClientContext &context, Allocator &allocator, const vector<LogicalType> &group_types,
 	                          vector<LogicalType> payload_types_p, vector<AggregateObject> aggregate_objects,
-	                          vector<Value> group_minima, vector<idx_t> required_bits);
+	                          vector<Value> group_minima, vector<idx_t> required_bits,
+	                          vector<shared_ptr<PerfectHashGroupDictionary>> dictionaries = {});
 	~PerfectAggregateHashTable() override;
 
 public:
-	//! Add the given data to the HT
-	void AddChunk(DataChunk &groups, DataChunk &payload);
+	//! Add the given data to the HT. Returns false, without adding any data, if a value of a string group does not fit
+	//! into its dictionary.
+	bool AddChunk(DataChunk &groups, DataChunk &payload);
 
 	//! Combines the target perfect aggregate HT into this one
 	void Combine(PerfectAggregateHashTable &other);
+	//! Combines the groups of this HT into the given regular hash table
+	void Combine(GroupedAggregateHashTable &target);
 
 	//! Scan the HT starting from the scan_position
 	void Scan(idx_t &scan_position, DataChunk &result);
@@ -42,6 +75,8 @@ protected:
 	idx_t tuple_size;
 	//! The number of grouping columns
 	idx_t grouping_columns;
+	//! The types of the grouping columns
+	vector<LogicalType> group_types;
 
 	// The actual pointer to the data
 	data_ptr_t data;
@@ -52,6 +87,10 @@ protected:
 
 	//! The minimum values for each of the group columns
 	vector<Value> group_minima;
+	//! The dictionaries of the string group columns (nullptr for the other columns)
+	vector<shared_ptr<PerfectHashGroupDictionary>> dictionaries;
+	//! The codes of the dictionary values that this HT has already looked up
+	vector<string_map_t<uint32_t>> dictionary_caches;
 
 	//! Reused selection vector
 	SelectionVector sel;
@@ -60,6 +99,12 @@ protected:
 	ArenaAllocator aggregate_allocator;
 
 private:
+	//! Computes the location of a string group in the HT, returns false if the dictionary overflows
+	bool ComputeDictionaryGroupLocation(idx_t group_idx, Vector &group, uintptr_t *address_data, idx_t current_shift,
+	                                    idx_t count);
+	//! Collects the next groups that are set in the HT: their keys are placed in the first columns of the result, and
+	//! the addresses are set to their aggregate states. Returns the amount of groups found.
+	idx_t ScanGroups(idx_t &scan_position, DataChunk &result);
 	//! Destroy the perfect aggregate HT (called automatically by the destructor)
 	void Destroy();
 };
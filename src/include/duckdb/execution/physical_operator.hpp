@@ -104,6 +104,10 @@ public:
 	virtual unique_ptr<GlobalSourceState> GetGlobalSourceState(ClientContext &context) const;
 	virtual void GetData(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate,
 	                     LocalSourceState &lstate) const;
+	//! Fetches a chunk from the source like GetData, but sources that have to wait for a resource (e.g. asynchronous
+	//! I/O) can return SourceResultType::BLOCKED instead, after arranging for input.interrupt_state.Callback() to be
+	//! called once the resource is available. The default implementation calls GetData and never blocks.
+	virtual SourceResultType PollData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const;
 	virtual idx_t GetBatchIndex(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate,
 	                            LocalSourceState &lstate) const;
 
@@ -15,6 +15,7 @@
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/execution/execution_context.hpp"
 #include "duckdb/optimizer/join_order/join_node.hpp"
+#include "duckdb/parallel/interrupt.hpp"
 
 namespace duckdb {
 class Event;
@@ -147,4 +148,11 @@ public:
 
 // LCOV_EXCL_STOP
 
+//! The input of a (possibly interrupted) call to the source interface of an operator
+struct OperatorSourceInput {
+	GlobalSourceState &global_state;
+	LocalSourceState &local_state;
+	InterruptState &interrupt_state;
+};
+
 } // namespace duckdb
@@ -44,6 +44,9 @@ public:
 	void Sink(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate, DataChunk &input,
 	          DataChunk &aggregate_input_chunk, const vector<idx_t> &filter) const;
 	void Combine(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate) const;
+	//! Adds a hash table with partial aggregates that were computed outside of the radix partitioned hash table
+	void CombineHashTable(ClientContext &context, GlobalSinkState &state,
+	                      unique_ptr<GroupedAggregateHashTable> ht) const;
 	bool Finalize(ClientContext &context, GlobalSinkState &gstate_p) const;
 
 	void ScheduleTasks(Executor &executor, const shared_ptr<Event> &event, GlobalSinkState &state,
@@ -23,7 +23,7 @@ public:
 
 	virtual void Sink(DataChunk &payload_chunk, SelectionVector *filter_sel, idx_t filtered);
 	virtual void Finalize();
-	virtual void Compute(Vector &result, idx_t rid, idx_t start, idx_t end);
+	virtual void Compute(Vector &result, idx_t rid, idx_t start, idx_t end) const;
 
 protected:
 	void AggregateInit();
@@ -54,20 +54,48 @@ public:
 
 	void Sink(DataChunk &payload_chunk, SelectionVector *filter_sel, idx_t filtered) override;
 	void Finalize() override;
-	void Compute(Vector &result, idx_t rid, idx_t start, idx_t end) override;
+	void Compute(Vector &result, idx_t rid, idx_t start, idx_t end) const override;
 
 private:
 	//! Partition starts
 	vector<idx_t> partition_offsets;
 	//! Aggregate results
 	unique_ptr<Vector> results;
-	//! The current result partition being built/read
+	//! The current result partition being built
 	idx_t partition;
-	//! The current input row being built/read
+	//! The current input row being built
 	idx_t row;
 };
 
+class WindowSegmentTree;
+
+//! The per-thread scratch space used to compute frames from a (shared) WindowSegmentTree
+class WindowSegmentTreeState {
+public:
+	WindowSegmentTreeState(const WindowSegmentTree &tree, idx_t capacity);
+	~WindowSegmentTreeState();
+
+	//! The tree this state computes frames for
+	const WindowSegmentTree &tree;
+	//! Data pointer that contains a single state, used for intermediate window segment aggregation
+	vector<data_t> state;
+	//! Input data chunk, used for intermediate window segment aggregation
+	DataChunk inputs;
+	//! The filtered rows in inputs.
+	SelectionVector filter_sel;
+	//! A vector of pointers to "state", used for intermediate window segment aggregation
+	Vector statep;
+	//! The frame boundaries, used for the window functions
+	std::pair<idx_t, idx_t> frame;
+	//! Reused result state container for the window functions
+	Vector statev;
+};
+
+//! The segment tree is read-only once constructed, so several threads can Compute frames from it concurrently,
+//! each with their own WindowSegmentTreeState.
 class WindowSegmentTree {
+	friend class WindowSegmentTreeState;
+
 public:
 	using FrameBounds = std::pair<idx_t, idx_t>;
 
@@ -75,15 +103,18 @@ public:
 	                  const ValidityMask &filter_mask, WindowAggregationMode mode);
 	~WindowSegmentTree();
 
+	//! Create the scratch space a thread needs to Compute frames
+	unique_ptr<WindowSegmentTreeState> GetLocalState() const;
+
 	//! First row contains the result.
-	void Compute(Vector &result, idx_t rid, idx_t start, idx_t end);
+	void Compute(WindowSegmentTreeState &lstate, Vector &result, idx_t rid, idx_t start, idx_t end) const;
 
 private:
 	void ConstructTree();
-	void ExtractFrame(idx_t begin, idx_t end);
-	void WindowSegmentValue(idx_t l_idx, idx_t begin, idx_t end);
-	void AggregateInit();
-	void AggegateFinal(Vector &result, idx_t rid);
+	void ExtractFrame(WindowSegmentTreeState &lstate, idx_t begin, idx_t end) const;
+	void WindowSegmentValue(WindowSegmentTreeState &lstate, idx_t l_idx, idx_t begin, idx_t end) const;
+	void AggregateInit(WindowSegmentTreeState &lstate) const;
+	void AggegateFinal(WindowSegmentTreeState &lstate, Vector &result, idx_t rid) const;
 
 	//! Use the window API, if available
 	inline bool UseWindowAPI() const {
@@ -98,19 +129,8 @@ private:
 	AggregateObject aggr;
 	//! The result type of the window function
 	LogicalType result_type;
-
-	//! Data pointer that contains a single state, used for intermediate window segment aggregation
-	vector<data_t> state;
-	//! Input data chunk, used for intermediate window segment aggregation
-	DataChunk inputs;
-	//! The filtered rows in inputs.
-	SelectionVector filter_sel;
-	//! A vector of pointers to "state", used for intermediate window segment aggregation
-	Vector statep;
-	//! The frame boundaries, used for the window functions
-	FrameBounds frame;
-	//! Reused result state container for the window functions
-	Vector statev;
+	//! The size of a single aggregate state
+	idx_t state_size;
 
 	//! The actual window segment tree: an array of aggregate states that represent all the intermediate nodes
 	unique_ptr<data_t[]> levels_flat_native;
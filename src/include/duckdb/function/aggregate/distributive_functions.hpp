@@ -44,6 +44,12 @@ struct CountFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct SumCountsFun {
+	static AggregateFunction GetFunction();
+
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct BoolAndFun {
 	static AggregateFunction GetFunction();
 
@@ -41,6 +41,14 @@ struct PragmaDatabaseSize {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct PragmaCardinalityFeedback {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
+struct PragmaPlanCacheInfo {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct DuckDBSchemasFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
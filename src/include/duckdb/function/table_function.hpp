@@ -22,6 +22,7 @@ namespace duckdb {
 
 class BaseStatistics;
 class DependencyList;
+class InterruptState;
 class LogicalGet;
 class TableFilterSet;
 
@@ -131,6 +132,11 @@ public:
 	optional_ptr<const FunctionData> bind_data;
 	optional_ptr<LocalTableFunctionState> local_state;
 	optional_ptr<GlobalTableFunctionState> global_state;
+	//! The interrupt state of the caller (if it can be interrupted)
+	optional_ptr<InterruptState> interrupt_state;
+	//! Set to true by a function that cannot produce data yet (e.g. because it is waiting for I/O). The output chunk
+	//! must be empty, and the function has to make sure interrupt_state->Callback() is called once it can make progress
+	bool blocked = false;
 };
 
 enum ScanType { TABLE, PARQUET };
@@ -193,6 +199,8 @@ typedef idx_t (*table_function_get_batch_index_t)(ClientContext &context, const
 
 typedef BindInfo (*table_function_get_bind_info)(const FunctionData *bind_data);
 
+typedef vector<string> (*table_function_get_files_t)(const FunctionData *bind_data);
+
 typedef double (*table_function_progress_t)(ClientContext &context, const FunctionData *bind_data,
                                             const GlobalTableFunctionState *global_state);
 typedef void (*table_function_dependency_t)(DependencyList &dependencies, const FunctionData *bind_data);
@@ -263,6 +271,8 @@ public:
 	table_function_get_batch_index_t get_batch_index;
 	//! (Optional) returns the extra batch info, currently only used for the substrait extension
 	table_function_get_bind_info get_batch_info;
+	//! (Optional) returns the files read by the scan, used to look up the statistics computed by ANALYZE
+	table_function_get_files_t get_files;
 
 	table_function_serialize_t serialize;
 	table_function_deserialize_t deserialize;
@@ -276,6 +286,9 @@ public:
 	//! Whether or not the table function can immediately prune out filter columns that are unused in the remainder of
 	//! the query plan, e.g., "SELECT i FROM tbl WHERE j = 42;" - j does not need to leave the table function at all
 	bool filter_prune;
+	//! Whether or not the table function supports dynamic filters, i.e. filters whose constant is set while the query
+	//! runs (e.g. by a top-n above the scan). This does not require filter_pushdown.
+	bool dynamic_filter_pushdown;
 	//! Additional function info, passed to the bind
 	shared_ptr<TableFunctionInfo> function_info;
 
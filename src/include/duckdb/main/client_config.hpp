@@ -10,6 +10,7 @@
 
 #include "duckdb/common/case_insensitive_map.hpp"
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/holistic_aggregate_mode.hpp"
 #include "duckdb/common/enums/output_type.hpp"
 #include "duckdb/common/enums/profiler_format.hpp"
 #include "duckdb/common/types/value.hpp"
@@ -30,6 +31,10 @@ struct ClientConfig {
 	bool enable_profiler = false;
 	//! If detailed query profiling is enabled
 	bool enable_detailed_profiling = false;
+	//! If the profiler attributes hardware performance counters (cycles, instructions, ...) to operators
+	bool enable_hardware_counters = false;
+	//! Whether or not arithmetic/comparison expression trees are executed as fused kernels
+	bool enable_expression_fusion = true;
 	//! The format to print query profiling information in (default: query_tree), if enabled.
 	ProfilerPrintFormat profiler_print_format = ProfilerPrintFormat::QUERY_TREE;
 	//! The file to save query profiling information to, instead of printing it to the console
@@ -94,6 +99,25 @@ struct ClientConfig {
 	//! The maximum amount of pivot columns
 	idx_t pivot_limit = 100000;
 
+	//! The maximum amount of planned statements kept in the plan cache (0 disables the plan cache)
+	idx_t plan_cache_size = 0;
+
+	//! The scheduling priority of the queries of this connection: the share of the threads a query receives under
+	//! concurrent load is proportional to its priority
+	idx_t query_priority = 100;
+	//! The maximum number of threads a single query of this connection may use (0 = no limit)
+	idx_t query_max_threads = 0;
+	//! Whether or not the number of tasks of parallel pipelines is adapted to their observed throughput
+	bool adaptive_parallelism = false;
+	//! The factor by which the observed cardinality of a hash join build may deviate from its estimate before the
+	//! hash join probes of the pipelines that have not started yet are re-planned (0 disables adaptive join ordering)
+	double adaptive_join_threshold = 0;
+	//! The maximum amount of bytes a streaming query result buffers ahead of the client (0 disables the buffer, in
+	//! which case streaming results are produced by a single thread while fetching)
+	idx_t streaming_buffer_size = 0;
+	//! How grouped holistic aggregates keep the values of their groups
+	HolisticAggregateMode holistic_aggregate_mode = HolisticAggregateMode::IN_MEMORY;
+
 	//! Whether or not the "/" division operator defaults to integer division or floating point division
 	bool integer_division = false;
 
@@ -23,6 +23,7 @@ class FileOpener;
 class HTTPState;
 class QueryProfiler;
 class QueryProfilerHistory;
+class PlanCache;
 class PreparedStatementData;
 class SchemaCatalogEntry;
 struct RandomEngine;
@@ -40,6 +41,8 @@ struct ClientData {
 	shared_ptr<AttachedDatabase> temporary_objects;
 	//! The set of bound prepared statements that belong to this client
 	case_insensitive_map_t<shared_ptr<PreparedStatementData>> prepared_statements;
+	//! The cache of planned statements that belong to this client
+	unique_ptr<PlanCache> plan_cache;
 
 	//! The writer used to log queries (if logging is enabled)
 	unique_ptr<BufferedFileWriter> log_query_writer;
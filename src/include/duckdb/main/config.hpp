@@ -88,6 +88,8 @@ struct DBConfigOptions {
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	//! Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
+	//! The maximum number of observed subplan cardinalities kept in the cardinality feedback store (default: 0)
+	idx_t cardinality_feedback_size = 0;
 	//! Whether or not to use Direct IO, bypassing operating system buffers
 	bool use_direct_io = false;
 	//! Whether extensions should be loaded on start-up
@@ -98,6 +100,8 @@ struct DBConfigOptions {
 	idx_t maximum_threads = (idx_t)-1;
 	//! The number of external threads that work on DuckDB tasks. Default: none.
 	idx_t external_threads = 0;
+	//! Whether worker threads are pinned to NUMA nodes and schedule tasks through per-node queues
+	bool numa_aware_scheduling = false;
 	//! Whether or not to create and use a temporary directory to store intermediates that do not fit in memory
 	bool use_temporary_directory = true;
 	//! Directory to store temporary structures that do not fit in memory
@@ -23,6 +23,9 @@ class ConnectionManager;
 class FileSystem;
 class TaskScheduler;
 class ObjectCache;
+class FileStatisticsCatalog;
+class CardinalityFeedback;
+class TraceRecorder;
 struct AttachInfo;
 
 class DatabaseInstance : public std::enable_shared_from_this<DatabaseInstance> {
@@ -41,6 +44,9 @@ public:
 	DUCKDB_API FileSystem &GetFileSystem();
 	DUCKDB_API TaskScheduler &GetScheduler();
 	DUCKDB_API ObjectCache &GetObjectCache();
+	DUCKDB_API FileStatisticsCatalog &GetFileStatisticsCatalog();
+	DUCKDB_API CardinalityFeedback &GetCardinalityFeedback();
+	DUCKDB_API TraceRecorder &GetTraceRecorder();
 	DUCKDB_API ConnectionManager &GetConnectionManager();
 	DUCKDB_API ValidChecker &GetValidChecker();
 	DUCKDB_API void SetExtensionLoaded(const std::string &extension_name);
@@ -64,10 +70,14 @@ private:
 	void Configure(DBConfig &config);
 
 private:
+	//! Declared first so that it outlives the threads and buffers that record into it
+	unique_ptr<TraceRecorder> trace_recorder;
 	unique_ptr<BufferManager> buffer_manager;
 	unique_ptr<DatabaseManager> db_manager;
 	unique_ptr<TaskScheduler> scheduler;
 	unique_ptr<ObjectCache> object_cache;
+	unique_ptr<FileStatisticsCatalog> file_statistics_catalog;
+	unique_ptr<CardinalityFeedback> cardinality_feedback;
 	unique_ptr<ConnectionManager> connection_manager;
 	unordered_set<std::string> loaded_extensions;
 	ValidChecker db_validity;
@@ -0,0 +1,118 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/plan_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/file_glob_options.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+class ClientContext;
+class DataTable;
+class PreparedStatementData;
+class SQLStatement;
+struct DataTableInfo;
+
+//! A file list that was expanded while binding a cached plan
+struct PlanCacheFileList {
+	//! The (glob) input of the scan
+	Value input;
+	//! The name of the reader that expanded the input
+	string name;
+	FileGlobOptions options;
+	//! The files the input expanded to
+	vector<string> files;
+};
+
+//! A table that was scanned by a cached plan
+struct PlanCacheTable {
+	shared_ptr<DataTableInfo> info;
+	//! The data version of the table when the plan was made
+	idx_t data_version;
+};
+
+//! The file lists and tables a cached plan depends on
+struct PlanCacheDependencies {
+	vector<PlanCacheFileList> file_lists;
+	vector<PlanCacheTable> tables;
+};
+
+//! The PlanCache holds the fully planned statements of a client, so that repeated queries can skip the parser,
+//! binder, optimizer and physical planner. Entries are keyed by the normalized statement text and the parameter
+//! types, and are dropped when the catalog is modified, when data is written to the tables they scan (the plan might
+//! rely on their statistics) or when the files they scan no longer match their globs.
+class PlanCache {
+public:
+	PlanCache();
+	~PlanCache();
+
+	//! The number of plan lookups that were served from the cache
+	idx_t hits = 0;
+	//! The number of plan lookups that had to plan the statement
+	idx_t misses = 0;
+	//! The number of entries dropped because the catalog, their tables or their file lists changed, or because the
+	//! settings changed
+	idx_t invalidations = 0;
+	//! The number of entries dropped to stay within the cache size
+	idx_t evictions = 0;
+
+public:
+	DUCKDB_API static PlanCache &Get(ClientContext &context);
+
+	//! Whether or not statements should be looked up in the cache
+	static bool IsEnabled(ClientContext &context);
+	//! Computes the cache key of a statement, returns false if the statement cannot be cached
+	static bool TryGetKey(SQLStatement &statement, const vector<Value> *values, string &result);
+
+	//! Looks up the plan of a statement, dropping the entry if it is out of date
+	shared_ptr<PreparedStatementData> Lookup(ClientContext &context, const string &key);
+	//! Adds a planned statement to the cache, evicting the least recently used entries if the cache is full
+	void Insert(ClientContext &context, const string &key, shared_ptr<PreparedStatementData> prepared,
+	            PlanCacheDependencies dependencies);
+	//! Removes all entries from the cache, counting them as invalidated
+	void Clear();
+	//! The number of entries in the cache
+	idx_t Count() const {
+		return entries.size();
+	}
+
+	//! Starts recording the file lists expanded and the tables bound by the binder
+	void StartRecording();
+	//! Records a file list expanded by the binder (if recording)
+	void RecordFileList(const Value &input, const string &name, FileGlobOptions options, const vector<string> &files);
+	//! Records a table scanned by the plan (if recording)
+	void RecordTable(DataTable &table);
+	//! Stops recording, and returns the file lists and tables recorded since the recording started
+	PlanCacheDependencies StopRecording();
+
+private:
+	struct PlanCacheEntry {
+		string key;
+		shared_ptr<PreparedStatementData> prepared;
+		PlanCacheDependencies dependencies;
+	};
+	using entry_iterator_t = list<PlanCacheEntry>::iterator;
+
+	bool IsValid(ClientContext &context, const PlanCacheEntry &entry);
+	void Evict(idx_t capacity);
+
+	//! The cached entries, ordered from most to least recently used
+	list<PlanCacheEntry> entries;
+	//! Map of key -> entry
+	unordered_map<string, entry_iterator_t> entry_map;
+
+	//! Whether or not dependencies are being recorded
+	bool recording;
+	//! The dependencies recorded so far
+	PlanCacheDependencies recorded;
+};
+
+} // namespace duckdb
@@ -10,6 +10,7 @@
 
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/enums/profiler_format.hpp"
+#include "duckdb/common/hardware_counters.hpp"
 #include "duckdb/common/profiler.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
@@ -47,6 +48,8 @@ struct ExpressionInfo {
 	uint64_t tuples_count = 0;
 	//! Count the number of tuples sampled
 	uint64_t sample_tuples_count = 0;
+	//! The hardware counters of the function (over all samples)
+	HardwareCounterValues counters;
 };
 
 //! The ExpressionRootInfo keeps information related to the root of an expression tree
@@ -69,6 +72,8 @@ struct ExpressionRootInfo {
 	string name;
 	//! Elapsed time
 	double time;
+	//! The hardware counters of the expression (over all samples)
+	HardwareCounterValues counters;
 	//! Extra Info
 	string extra_info;
 };
@@ -89,6 +94,10 @@ struct OperatorInformation {
 
 	double time = 0;
 	idx_t elements = 0;
+	//! The hardware counters attributed to the operator (only if enable_hardware_counters is set)
+	HardwareCounterValues counters;
+	//! Decisions made while executing the operator (e.g. adaptive re-plans), shown in the profiler output
+	string runtime_info;
 	string name;
 	//! A vector of Expression Executor Info
 	vector<unique_ptr<ExpressionExecutorInfo>> executors_info;
@@ -99,21 +108,27 @@ class OperatorProfiler {
 	friend class QueryProfiler;
 
 public:
-	DUCKDB_API explicit OperatorProfiler(bool enabled);
+	DUCKDB_API explicit OperatorProfiler(bool enabled, bool count_hardware_events = false);
 
 	DUCKDB_API void StartOperator(optional_ptr<const PhysicalOperator> phys_op);
 	DUCKDB_API void EndOperator(optional_ptr<DataChunk> chunk);
 	DUCKDB_API void Flush(const PhysicalOperator &phys_op, ExpressionExecutor &expression_executor, const string &name,
 	                      int id);
+	//! Records a decision made while executing the operator, which is shown in the profiler output
+	DUCKDB_API void AddRuntimeInfo(const PhysicalOperator &phys_op, const string &info);
 
 	~OperatorProfiler() {
 	}
 
 private:
-	void AddTiming(const PhysicalOperator &op, double time, idx_t elements);
+	void AddTiming(const PhysicalOperator &op, double time, idx_t elements, const HardwareCounterValues &counters);
 
 	//! Whether or not the profiler is enabled
 	bool enabled;
+	//! Whether or not the hardware counters are read at the start and end of each operator call
+	bool count_hardware_events;
+	//! The hardware counters at the start of the current operator call
+	HardwareCounterValues counters_start;
 	//! The timer used to time the execution time of the individual Physical Operators
 	Profiler op;
 	//! The stack of Physical Operators that are currently active
@@ -156,7 +171,8 @@ public:
 	DUCKDB_API static QueryProfiler &Get(ClientContext &context);
 
 	DUCKDB_API void StartQuery(string query, bool is_explain_analyze = false, bool start_at_optimizer = false);
-	DUCKDB_API void EndQuery();
+	//! Ends the query; the cardinalities of a query that completed successfully are recorded as cardinality feedback
+	DUCKDB_API void EndQuery(bool success = true);
 
 	DUCKDB_API void StartExplainAnalyze();
 
@@ -185,6 +201,10 @@ public:
 
 	void Finalize(TreeNode &node);
 
+private:
+	//! Records the cardinalities of the operators that carry a cardinality feedback key
+	void RecordCardinalityFeedback();
+
 private:
 	ClientContext &context;
 
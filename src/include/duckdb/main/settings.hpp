@@ -25,6 +25,43 @@ struct AccessModeSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct AdaptiveJoinThresholdSetting {
+	static constexpr const char *Name = "adaptive_join_threshold";
+	static constexpr const char *Description =
+	    "The factor by which the observed cardinality of a hash join build may deviate from its estimate before the "
+	    "hash join probes of the remaining pipelines are re-ordered (0 disables adaptive join ordering)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::DOUBLE;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct AdaptiveParallelismSetting {
+	static constexpr const char *Name = "adaptive_parallelism";
+	static constexpr const char *Description =
+	    "Whether or not parallel pipelines start with a single task and launch additional tasks based on their "
+	    "observed throughput, instead of launching a task for every thread up front";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct CardinalityFeedbackSizeSetting {
+	static constexpr const char *Name = "cardinality_feedback_size";
+	static constexpr const char *Description =
+	    "The maximum number of subplan cardinalities observed by the profiler that are kept to correct the estimates "
+	    "of the join order optimizer, 0 disables cardinality feedback (default: 0)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct CheckpointThresholdSetting {
 	static constexpr const char *Name = "checkpoint_threshold";
 	static constexpr const char *Description =
@@ -131,6 +168,17 @@ struct DisabledOptimizersSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct EnableExpressionFusionSetting {
+	static constexpr const char *Name = "enable_expression_fusion";
+	static constexpr const char *Description =
+	    "Execute trees of arithmetic, comparisons and conjunctions over numeric columns as fused kernels, without "
+	    "intermediate vectors";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct EnableExternalAccessSetting {
 	static constexpr const char *Name = "enable_external_access";
 	static constexpr const char *Description =
@@ -280,6 +328,17 @@ struct ForceBitpackingModeSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct HolisticAggregateModeSetting {
+	static constexpr const char *Name = "holistic_aggregate_mode";
+	static constexpr const char *Description =
+	    "How grouped holistic aggregates (quantiles, mode, string_agg, list, ...) keep their values: in_memory, spill "
+	    "(sort the groups in memory that can be offloaded to disk) or approximate (use sketches for quantiles)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct HomeDirectorySetting {
 	static constexpr const char *Name = "home_directory";
 	static constexpr const char *Description = "Sets the home directory used by the system";
@@ -339,6 +398,16 @@ struct MaximumMemorySetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct NumaAwareSchedulingSetting {
+	static constexpr const char *Name = "numa_aware_scheduling";
+	static constexpr const char *Description =
+	    "Pin worker threads to NUMA nodes and give every node its own task queue (can only be set on start-up)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct PasswordSetting {
 	static constexpr const char *Name = "password";
 	static constexpr const char *Description = "The password to use. Ignored for legacy compatibility.";
@@ -367,6 +436,16 @@ struct PivotLimitSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct PlanCacheSizeSetting {
+	static constexpr const char *Name = "plan_cache_size";
+	static constexpr const char *Description =
+	    "The maximum number of planned statements cached per connection, 0 disables the plan cache (default: 0)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct PreserveIdentifierCase {
 	static constexpr const char *Name = "preserve_identifier_case";
 	static constexpr const char *Description =
@@ -407,6 +486,19 @@ struct ProfileOutputSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct ProfilingHardwareCountersSetting {
+	static constexpr const char *Name = "profiling_hardware_counters";
+	static constexpr const char *Description =
+	    "Whether or not the profiler attributes hardware performance counters (cycles, instructions, last-level cache "
+	    "misses and branch misses) to operators and expressions, requires perf events (Linux)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct ProfilingModeSetting {
 	static constexpr const char *Name = "profiling_mode";
 	static constexpr const char *Description = "The profiling mode (STANDARD or DETAILED)";
@@ -426,6 +518,29 @@ struct ProgressBarTimeSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct QueryMaxThreadsSetting {
+	static constexpr const char *Name = "query_max_threads";
+	static constexpr const char *Description =
+	    "The maximum number of threads a single query of this connection may use, 0 means no limit (default: 0)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct QueryPrioritySetting {
+	static constexpr const char *Name = "query_priority";
+	static constexpr const char *Description =
+	    "The scheduling priority of the queries of this connection, queries receive a share of the threads "
+	    "proportional to their priority (default: 100)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct SchemaSetting {
 	static constexpr const char *Name = "schema";
 	static constexpr const char *Description =
@@ -446,6 +561,17 @@ struct SearchPathSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct StreamingBufferSizeSetting {
+	static constexpr const char *Name = "streaming_buffer_size";
+	static constexpr const char *Description =
+	    "The maximum amount of data a streaming query result buffers ahead of the client, e.g. 1MB (0 disables the "
+	    "buffer)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct TempDirectorySetting {
 	static constexpr const char *Name = "temp_directory";
 	static constexpr const char *Description = "Set the directory to which to write temp files";
@@ -0,0 +1,49 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/aggregate_pushdown.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/column_binding_map.hpp"
+#include "duckdb/planner/logical_operator.hpp"
+
+namespace duckdb {
+class BoundAggregateExpression;
+class LogicalAggregate;
+class LogicalComparisonJoin;
+class Optimizer;
+
+//! The AggregatePushdown optimizer performs eager aggregation: it inserts a partial aggregate below an inner join when
+//! all aggregates of the aggregate on top of the join only read one side of the join. The partial aggregate groups on
+//! the columns of that side that are used by the groups and by the join conditions, so that every partial group joins
+//! with exactly the same tuples of the other side as the tuples it replaces. Only aggregates that can be computed
+//! exactly from partial aggregates (SUM over exact types, MIN, MAX and COUNT) are pushed down, and only if the
+//! statistics of the input show that the partial aggregate reduces the input of the join by a large factor.
+class AggregatePushdown {
+public:
+	//! The minimum factor by which the partial aggregate must reduce the amount of tuples that enter the join
+	static constexpr const double MINIMUM_REDUCTION_FACTOR = 4.0;
+
+public:
+	explicit AggregatePushdown(Optimizer &optimizer) : optimizer(optimizer) {
+	}
+
+	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+
+private:
+	//! Try to push a partial aggregate below the join that is the child of the aggregate
+	bool TryPushdown(LogicalAggregate &aggr);
+	//! Rewrite an aggregate so it combines the results of its partial aggregate
+	unique_ptr<Expression> CombinePartialAggregate(BoundAggregateExpression &aggr, ColumnBinding partial_binding);
+	//! Estimate the amount of distinct values of a column produced by the operator, returns 0 if unknown
+	idx_t EstimateDistinctCount(LogicalOperator &op, const ColumnBinding &binding);
+
+private:
+	Optimizer &optimizer;
+};
+
+} // namespace duckdb
@@ -7,6 +7,7 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/optimizer/join_order/join_node.hpp"
 #include "duckdb/planner/column_binding.hpp"
 #include "duckdb/planner/column_binding_map.hpp"
@@ -68,6 +69,13 @@ private:
 
 	vector<RelationsToTDom> relations_to_tdoms;
 
+	//! Whether or not cardinalities are looked up in the cardinality feedback store
+	bool use_feedback = false;
+	//! The feedback signature of every relation
+	vector<string> relation_signatures;
+	//! The feedback signatures of the filters, together with the relations they use
+	vector<pair<reference<JoinRelationSet>, string>> filter_signatures;
+
 public:
 	static constexpr double DEFAULT_SELECTIVITY = 0.2;
 
@@ -90,12 +98,19 @@ public:
 	void InitEquivalentRelations(vector<unique_ptr<FilterInfo>> &filter_infos);
 
 	void InitCardinalityEstimatorProps(vector<NodeOp> &node_ops, vector<unique_ptr<FilterInfo>> &filter_infos);
+	//! Computes the signatures of the relations and filters used to build the keys of the cardinality feedback store
+	void InitFeedbackSignatures(vector<NodeOp> &node_ops, vector<unique_ptr<Expression>> &filters,
+	                            vector<unique_ptr<FilterInfo>> &filter_infos);
+	//! Returns the key of a set of relations in the cardinality feedback store, or nullptr if feedback is disabled
+	shared_ptr<CardinalityFeedbackKey> GetFeedbackKey(JoinRelationSet &set);
 	double EstimateCardinalityWithSet(JoinRelationSet &new_set);
 	void EstimateBaseTableCardinality(JoinNode &node, LogicalOperator &op);
 	double EstimateCrossProduct(const JoinNode &left, const JoinNode &right);
 	static double ComputeCost(JoinNode &left, JoinNode &right, double expected_cardinality);
 
 private:
+	//! Looks up the cardinality of a set of relations observed in earlier executions
+	bool TryGetObservedCardinality(JoinRelationSet &set, double &result);
 	bool SingleColumnFilter(FilterInfo &filter_info);
 	//! Filter & bindings -> list of indexes into the equivalent_relations array.
 	// The column binding set at each index is an equivalence set.
@@ -0,0 +1,89 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/join_order/cardinality_feedback.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+class ClientContext;
+class DatabaseInstance;
+class LogicalOperator;
+
+//! The canonical key of a logical subplan: the signatures of the relations it joins and of the filters applied to them
+struct CardinalityFeedbackKey {
+	explicit CardinalityFeedbackKey(string subplan);
+
+	//! The canonical rendering of the subplan
+	string subplan;
+	//! The hash of the subplan
+	hash_t hash;
+};
+
+//! The cardinality observed for a subplan
+struct CardinalityFeedbackEntry {
+	hash_t hash;
+	string subplan;
+	//! The cardinality the optimizer estimated for the subplan when it was last observed
+	idx_t estimated_cardinality;
+	//! The cardinality of the subplan when it was last observed
+	idx_t actual_cardinality;
+	//! The number of times the subplan has been observed
+	idx_t observations;
+};
+
+//! The CardinalityFeedback store holds the actual cardinalities of subplans observed by the query profiler, so that
+//! the join order optimizer can use them instead of its estimates when the same subplan is planned again. The relation
+//! signatures in the keys contain the cardinalities of the scanned tables, so entries of tables whose contents have
+//! changed are no longer found; these, like all other entries, are evicted in least recently used order once the store
+//! is full.
+class CardinalityFeedback {
+public:
+	CardinalityFeedback();
+
+	//! The number of lookups that found an observed cardinality
+	idx_t hits = 0;
+	//! The number of entries dropped to stay within the store size
+	idx_t evictions = 0;
+
+public:
+	DUCKDB_API static CardinalityFeedback &Get(ClientContext &context);
+
+	//! Whether or not cardinalities are recorded and used
+	static bool IsEnabled(ClientContext &context);
+	//! Computes the signature of a relation of the join order optimizer
+	static string GetRelationSignature(ClientContext &context, LogicalOperator &op);
+
+	//! Looks up the observed cardinality of a subplan
+	bool TryGetCardinality(const CardinalityFeedbackKey &key, double &result);
+	//! Records the observed cardinality of a subplan, evicting the least recently used entries if the store is full
+	void Record(ClientContext &context, const CardinalityFeedbackKey &key, idx_t estimated_cardinality,
+	            idx_t actual_cardinality);
+	//! Evicts the least recently used entries until at most "capacity" entries remain
+	void Evict(idx_t capacity);
+	//! Removes all entries from the store
+	void Clear();
+	//! Returns a copy of the entries, ordered from most to least recently used
+	vector<CardinalityFeedbackEntry> GetEntries();
+
+private:
+	using entry_iterator_t = list<CardinalityFeedbackEntry>::iterator;
+
+	void EvictInternal(idx_t capacity);
+
+	mutex lock;
+	//! The observed cardinalities, ordered from most to least recently used
+	list<CardinalityFeedbackEntry> entries;
+	//! Map of subplan hash -> entry
+	unordered_map<hash_t, entry_iterator_t> entry_map;
+};
+
+} // namespace duckdb
@@ -17,6 +17,7 @@
 #include "duckdb/planner/table_filter.hpp"
 
 namespace duckdb {
+struct CardinalityFeedbackKey;
 
 class EstimatedProperties {
 public:
@@ -31,9 +32,18 @@ public:
 	void SetCost(double new_cost);
 	void SetCardinality(double cardinality);
 
+	//! The key under which the actual cardinality of the operator is recorded in the cardinality feedback store
+	const shared_ptr<CardinalityFeedbackKey> &GetFeedbackKey() const {
+		return feedback_key;
+	}
+	void SetFeedbackKey(shared_ptr<CardinalityFeedbackKey> key) {
+		feedback_key = std::move(key);
+	}
+
 private:
 	double cardinality;
 	double cost;
+	shared_ptr<CardinalityFeedbackKey> feedback_key;
 
 public:
 	unique_ptr<EstimatedProperties> Copy();
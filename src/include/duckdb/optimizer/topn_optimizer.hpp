@@ -12,12 +12,18 @@
 
 namespace duckdb {
 class LogicalOperator;
+class LogicalTopN;
 class Optimizer;
 
 class TopN {
 public:
 	//! Optimize ORDER BY + LIMIT to TopN
 	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+
+private:
+	//! Push a dynamic filter on the first order into the scan below the TopN, which the TopN sets to the boundary of
+	//! its heap while it runs
+	void PushdownDynamicFilter(LogicalTopN &op);
 };
 
 } // namespace duckdb
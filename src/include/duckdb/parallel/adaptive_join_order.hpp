@@ -0,0 +1,49 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/parallel/adaptive_join_order.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/types/data_chunk.hpp"
+
+namespace duckdb {
+class ClientContext;
+class PhysicalOperator;
+
+//! AdaptiveJoinOrder re-plans the order in which a pipeline probes a chain of inner hash joins, once the build sides
+//! of the joins have been finalized. The optimizer fixes the order of the probes from estimated cardinalities. When
+//! the observed cardinality of a build deviates from its estimate by more than the adaptive_join_threshold, the
+//! selectivities of the joins of the chain are corrected with the observed cardinalities, and the joins are probed in
+//! order of increasing selectivity, so that the most selective joins discard tuples before the others probe them.
+//! Only probes whose keys reference the input of the chain are re-ordered; the output of the chain is mapped back to
+//! the column layout the remainder of the pipeline expects.
+class AdaptiveJoinOrder {
+public:
+	//! Re-plans the given pipeline operators, or returns nullptr if the order of the operators is kept
+	static unique_ptr<AdaptiveJoinOrder> TryReorder(ClientContext &context, const PhysicalOperator &source,
+	                                                const vector<reference<PhysicalOperator>> &operators);
+
+	//! Whether or not the operator at the given position ends a re-ordered chain
+	bool EndsChain(idx_t operator_idx) const {
+		return !column_maps[operator_idx].empty();
+	}
+	//! Maps the output of the operator ending a re-ordered chain back to the original column layout
+	void RestoreColumnOrder(idx_t operator_idx, DataChunk &reordered, DataChunk &result) const;
+
+public:
+	//! The operators of the pipeline in the order in which they are executed
+	vector<reference<PhysicalOperator>> operators;
+	//! The types of the output of every operator (in execution order)
+	vector<vector<LogicalType>> output_types;
+	//! For the operators ending a re-ordered chain: the column of the re-ordered output for every output column
+	vector<vector<idx_t>> column_maps;
+	//! Describes the re-plan of every operator in a re-planned chain (shown in the profiler output)
+	vector<string> runtime_info;
+};
+
+} // namespace duckdb
@@ -0,0 +1,67 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/parallel/adaptive_parallelism.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+
+namespace duckdb {
+
+//! The AdaptiveParallelismController decides how many tasks work on a parallel pipeline while it is running.
+//! The pipeline starts out with a single task. Tasks report the rows they fetched from the source and the wall and CPU
+//! time they spent doing so. An additional task is launched while the pipeline is CPU-bound, or while launching more
+//! tasks keeps increasing the throughput of a pipeline that is waiting on I/O. Once an additional task no longer
+//! increases the throughput of an I/O-bound pipeline the devices are saturated, and no further tasks are launched.
+class AdaptiveParallelismController {
+public:
+	//! The minimum duration of a measurement window
+	static constexpr const uint64_t WINDOW_MICROS = 10000;
+	//! The fraction of the wall time spent on the CPU above which a pipeline is considered CPU-bound
+	static constexpr const double CPU_BOUND_RATIO = 0.9;
+	//! The relative throughput increase an additional task must bring for an I/O-bound pipeline to keep growing
+	static constexpr const double MIN_SPEEDUP = 0.1;
+
+public:
+	AdaptiveParallelismController(idx_t initial_tasks, idx_t max_tasks);
+
+	//! Report the work performed by a task in a single time slice
+	//! Returns true if the caller should launch an additional task for the pipeline
+	bool ReportProgress(idx_t rows, uint64_t wall_time, uint64_t cpu_time);
+
+	//! The amount of tasks that have been launched for the pipeline
+	idx_t LaunchedTasks();
+	//! Whether or not the controller stopped launching tasks because throughput stopped improving
+	bool IsSaturated();
+
+	//! The current time in microseconds (monotonic)
+	static uint64_t WallTime();
+	//! The CPU time consumed by the calling thread in microseconds, or the wall time if that is not available
+	static uint64_t ThreadCPUTime();
+
+private:
+	mutex lock;
+	//! The amount of tasks launched so far
+	idx_t launched_tasks;
+	//! The maximum amount of tasks that may be launched
+	idx_t max_tasks;
+	//! Whether or not the throughput stopped increasing with more tasks
+	bool saturated;
+	//! The start of the current measurement window
+	uint64_t window_start;
+	//! The rows, wall time and CPU time reported in the current measurement window
+	idx_t window_rows;
+	uint64_t window_wall_time;
+	uint64_t window_cpu_time;
+	//! The throughput (rows/s) measured with the previous amount of tasks
+	double previous_throughput;
+	//! Whether or not the current window overlaps with the start-up of the last launched task
+	bool skip_window;
+};
+
+} // namespace duckdb
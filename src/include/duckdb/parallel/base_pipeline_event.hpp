@@ -22,6 +22,9 @@ public:
 	void PrintPipeline() override {
 		pipeline->Print();
 	}
+	string TraceName() const override {
+		return pipeline->GetDescription();
+	}
 
 	//! The pipeline that this event belongs to
 	shared_ptr<Pipeline> pipeline;
@@ -42,6 +42,9 @@ public:
 	void CompleteDependency();
 
 	void SetTasks(vector<unique_ptr<Task>> tasks);
+	//! Schedule an additional task for an event that is running
+	//! This must be called from one of the unfinished tasks of the event, so the event cannot finish in the meantime
+	void AddTask(unique_ptr<Task> task);
 
 	void InsertEvent(shared_ptr<Event> replacement_event);
 
@@ -51,6 +54,10 @@ public:
 
 	virtual void PrintPipeline() {
 	}
+	//! The name of the event in traces
+	virtual string TraceName() const {
+		return "Event";
+	}
 
 protected:
 	Executor &executor;
@@ -72,6 +79,8 @@ protected:
 
 	//! Whether or not the event is finished executing
 	atomic<bool> finished;
+	//! The time at which the tasks of the event were scheduled, only set while tracing
+	uint64_t trace_start_time = 0;
 };
 
 } // namespace duckdb
@@ -0,0 +1,33 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/parallel/morsel_sizing.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+
+//! MorselSizing determines the size of the units of work ("morsels") that parallel scans hand out to threads.
+//! Morsels are as large as possible while plenty of work remains, but towards the end of a scan the remaining work is
+//! divided into progressively smaller morsels (guided self-scheduling), so that threads that become idle can pick up
+//! part of the remaining work instead of waiting for the thread that grabbed the last large morsel.
+struct MorselSizing {
+	//! The amount of morsels per thread the remaining work is divided into
+	static constexpr const idx_t MORSELS_PER_THREAD = 2;
+
+	//! Returns the size of the next morsel, given the amount of remaining work units
+	static idx_t NextMorselSize(idx_t remaining, idx_t thread_count, idx_t max_size, idx_t min_size = 1) {
+		D_ASSERT(min_size > 0 && min_size <= max_size);
+		auto divisor = MaxValue<idx_t>(thread_count, 1) * MORSELS_PER_THREAD;
+		auto size = (remaining + divisor - 1) / divisor;
+		size = MinValue<idx_t>(MaxValue<idx_t>(size, min_size), max_size);
+		return MaxValue<idx_t>(MinValue<idx_t>(size, remaining), 1);
+	}
+};
+
+} // namespace duckdb
@@ -0,0 +1,43 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/parallel/numa_topology.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/vector.hpp"
+
+namespace duckdb {
+
+//! The NUMA topology of the machine: the set of NUMA nodes and the CPUs that belong to each of them
+class NumaTopology {
+public:
+	//! Create a topology consisting of a single node without CPU information
+	NumaTopology();
+
+	//! Detect the topology of the current machine. If no NUMA information is available (e.g. on non-Linux
+	//! platforms) the topology consists of a single node without CPU information.
+	static NumaTopology Detect();
+	//! Parse a Linux "cpulist" (e.g. "0-3,8-11") into a list of CPU ids
+	static vector<idx_t> ParseCPUList(const string &cpu_list);
+
+	//! The number of NUMA nodes
+	idx_t NodeCount() const {
+		return node_cpus.size();
+	}
+	//! The CPUs belonging to the given node
+	const vector<idx_t> &NodeCPUs(idx_t node) const {
+		return node_cpus[node];
+	}
+	//! Pin the calling thread to the CPUs of the given node. Returns false if the thread could not be pinned.
+	bool PinCurrentThread(idx_t node) const;
+
+private:
+	vector<vector<idx_t>> node_cpus;
+};
+
+} // namespace duckdb
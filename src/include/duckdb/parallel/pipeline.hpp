@@ -13,12 +13,14 @@
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/common/reference_map.hpp"
+#include "duckdb/common/set.hpp"
 
 namespace duckdb {
 
 class Executor;
 class Event;
 class MetaPipeline;
+class AdaptiveParallelismController;
 
 class PipelineBuildState {
 public:
@@ -52,6 +54,7 @@ class Pipeline : public std::enable_shared_from_this<Pipeline> {
 
 public:
 	explicit Pipeline(Executor &execution_context);
+	~Pipeline();
 
 	Executor &executor;
 
@@ -73,6 +76,8 @@ public:
 	void Finalize(Event &event);
 
 	string ToString() const;
+	//! A single-line description of the pipeline ("SOURCE -> ... -> SINK")
+	string GetDescription() const;
 	void Print() const;
 	void PrintDependencies() const;
 
@@ -94,6 +99,16 @@ public:
 	//! Returns whether any of the operators in the pipeline care about preserving order
 	bool IsOrderDependent() const;
 
+	//! Registers a new pipeline executor that is about to fetch its first batch, returns its (placeholder) batch index
+	idx_t RegisterNewBatchIndex();
+	//! Updates the batch index a pipeline executor is working on, returns the new minimum batch index
+	idx_t UpdateBatchIndex(idx_t old_index, idx_t new_index);
+	//! Removes the batch index of a pipeline executor that has finished
+	void ReleaseBatchIndex(idx_t index);
+	//! Returns the minimum batch index that is still being worked on (or INVALID_INDEX if there is none). Batches with
+	//! a lower batch index are complete: batch indexes are handed out in increasing order.
+	idx_t GetMinimumBatchIndex();
+
 private:
 	//! Whether or not the pipeline has been readied
 	bool ready;
@@ -116,6 +131,12 @@ private:
 
 	//! The base batch index of this pipeline
 	idx_t base_batch_index = 0;
+	//! The batch indexes that the pipeline executors of this pipeline are working on
+	mutex batch_lock;
+	multiset<idx_t> batch_indexes;
+
+	//! Decides how many tasks work on this pipeline while it runs (only set with adaptive parallelism)
+	unique_ptr<AdaptiveParallelismController> parallelism_controller;
 
 private:
 	void ScheduleSequentialTask(shared_ptr<Event> &event);
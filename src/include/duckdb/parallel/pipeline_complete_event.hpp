@@ -22,6 +22,9 @@ public:
 public:
 	void Schedule() override;
 	void FinalizeFinish() override;
+	string TraceName() const override {
+		return "complete";
+	}
 };
 
 } // namespace duckdb
@@ -14,22 +14,33 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/execution/execution_context.hpp"
 #include "duckdb/common/stack.hpp"
+#include "duckdb/parallel/interrupt.hpp"
+#include "duckdb/parallel/adaptive_join_order.hpp"
 
 #include <functional>
 
 namespace duckdb {
 class Executor;
 
+//! The result of executing a pipeline with a sink
+//! NOT_FINISHED means Execute should be called again
+//! FINISHED means the source is exhausted and the pipeline has been finalized
+//! INTERRUPTED means the source or the sink is blocked: Execute should be called again once the interrupt callback has
+//! been made
+enum class PipelineExecuteResult : uint8_t { NOT_FINISHED, FINISHED, INTERRUPTED };
+
 //! The Pipeline class represents an execution pipeline
 class PipelineExecutor {
 public:
 	PipelineExecutor(ClientContext &context, Pipeline &pipeline);
+	~PipelineExecutor();
 
-	//! Fully execute a pipeline with a source and a sink until the source is completely exhausted
-	void Execute();
+	//! Fully execute a pipeline with a source and a sink until the source is completely exhausted (or blocked)
+	PipelineExecuteResult Execute();
 	//! Execute a pipeline with a source and a sink until finished, or until max_chunks have been processed
-	//! Returns true if execution is finished, false if Execute should be called again
-	bool Execute(idx_t max_chunks);
+	PipelineExecuteResult Execute(idx_t max_chunks);
+	//! Makes the callback of a blocked source reschedule the given task, instead of waiting in place
+	void SetTaskForInterrupts(weak_ptr<Task> current_task);
 
 	//! Push a single input DataChunk into the pipeline.
 	//! Returns either OperatorResultType::NEED_MORE_INPUT or OperatorResultType::FINISHED
@@ -48,6 +59,11 @@ public:
 	//! This flushes profiler states
 	void PullFinalize();
 
+	//! The total amount of rows fetched from the source by this executor
+	idx_t GetSourceRowCount() const {
+		return source_row_count;
+	}
+
 private:
 	//! The pipeline to process
 	Pipeline &pipeline;
@@ -56,6 +72,14 @@ private:
 	//! The total execution context of this executor
 	ExecutionContext context;
 
+	//! The operators in the order in which they are executed, which differs from the order of the pipeline if the
+	//! hash join probes were re-planned
+	vector<reference<PhysicalOperator>> operators;
+	//! The re-planned order of the hash join probes (if any)
+	unique_ptr<AdaptiveJoinOrder> join_order;
+	//! For the operators ending a chain of re-ordered hash joins: the chunk the operator writes its output to
+	vector<unique_ptr<DataChunk>> reordered_chunks;
+
 	//! Intermediate chunks for the operators
 	vector<unique_ptr<DataChunk>> intermediate_chunks;
 	//! Intermediate states for the operators
@@ -65,6 +89,10 @@ private:
 	unique_ptr<LocalSourceState> local_source_state;
 	//! The local sink state (if any)
 	unique_ptr<LocalSinkState> local_sink_state;
+	//! Used to wait in place for a blocked source when the executor is not running in a task
+	shared_ptr<InterruptDoneSignalState> interrupt_done_signal;
+	//! The interrupt state that is passed to the source
+	InterruptState interrupt_state;
 
 	//! The final chunk used for moving data into the sink
 	DataChunk final_chunk;
@@ -78,6 +106,12 @@ private:
 	int32_t finished_processing_idx = -1;
 	//! Whether or not this pipeline requires keeping track of the batch index of the source
 	bool requires_batch_index = false;
+	//! The batch index this executor has registered with the pipeline (if requires_batch_index is set)
+	idx_t current_batch_index = DConstants::INVALID_INDEX;
+	//! Whether or not the sink asked to pause the pipeline
+	bool blocked_on_sink = false;
+	//! The amount of rows fetched from the source
+	idx_t source_row_count = 0;
 
 private:
 	void StartOperator(PhysicalOperator &op);
@@ -85,7 +119,7 @@ private:
 
 	//! Reset the operator index to the first operator
 	void GoToSource(idx_t &current_idx, idx_t initial_idx);
-	void FetchFromSource(DataChunk &result);
+	SourceResultType FetchFromSource(DataChunk &result);
 
 	void FinishProcessing(int32_t operator_idx = -1);
 	bool IsFinished();
@@ -95,6 +129,11 @@ private:
 	//! Returns whether or not a new input chunk is needed, or whether or not we are finished
 	OperatorResultType Execute(DataChunk &input, DataChunk &result, idx_t initial_index = 0);
 
+	//! Returns the chunk the operator at the given index writes its output to
+	DataChunk &GetOperatorOutput(idx_t operator_idx, DataChunk &chunk);
+	//! Moves the output of the operator into the chunk, restoring the column order after a re-ordered join chain
+	void FinishOperatorOutput(idx_t operator_idx, DataChunk &output, DataChunk &chunk);
+
 	//! FlushCachedOperators methods push/pull any remaining cached results through the pipeline
 	void FlushCachingOperatorsPull(DataChunk &result);
 	void FlushCachingOperatorsPush();
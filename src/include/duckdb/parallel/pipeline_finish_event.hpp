@@ -20,6 +20,9 @@ public:
 public:
 	void Schedule() override;
 	void FinishEvent() override;
+	string TraceName() const override {
+		return "finalize: " + pipeline->GetDescription();
+	}
 };
 
 } // namespace duckdb
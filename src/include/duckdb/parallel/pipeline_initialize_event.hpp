@@ -21,6 +21,9 @@ public:
 public:
 	void Schedule() override;
 	void FinishEvent() override;
+	string TraceName() const override {
+		return "initialize: " + pipeline->GetDescription();
+	}
 };
 
 } // namespace duckdb
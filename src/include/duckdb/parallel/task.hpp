@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/exception.hpp"
 
 namespace duckdb {
 class ClientContext;
@@ -16,10 +17,10 @@ class Executor;
 
 enum class TaskExecutionMode : uint8_t { PROCESS_ALL, PROCESS_PARTIAL };
 
-enum class TaskExecutionResult : uint8_t { TASK_FINISHED, TASK_NOT_FINISHED, TASK_ERROR };
+enum class TaskExecutionResult : uint8_t { TASK_FINISHED, TASK_NOT_FINISHED, TASK_ERROR, TASK_BLOCKED };
 
 //! Generic parallel task
-class Task {
+class Task : public std::enable_shared_from_this<Task> {
 public:
 	virtual ~Task() {
 	}
@@ -28,7 +29,35 @@ public:
 	//! If mode is PROCESS_ALL, Execute should always finish processing and return TASK_FINISHED
 	//! If mode is PROCESS_PARTIAL, Execute can return TASK_NOT_FINISHED, in which case Execute will be called again
 	//! In case of an error, TASK_ERROR is returned
+	//! In case the task has interrupted, BLOCKED is returned: the task will be rescheduled through Reschedule once
+	//! the resource it is waiting for becomes available
 	virtual TaskExecutionResult Execute(TaskExecutionMode mode) = 0;
+
+	//! Descheduling a task ensures the task is not executed, but remains available for rescheduling as long as
+	//! required, generally until some code in an operator calls the InterruptState::Callback() method of a state of the
+	//! InterruptMode::TASK mode.
+	virtual void Deschedule() {
+		throw InternalException("Cannot deschedule task of base Task class");
+	}
+
+	//! Ensures a task is rescheduled to the correct queue
+	virtual void Reschedule() {
+		throw InternalException("Cannot reschedule task of base Task class");
+	}
+
+	//! Queues a task that returned TASK_NOT_FINISHED again, so that it continues after the tasks ahead of it
+	virtual void Requeue() {
+		throw InternalException("Cannot requeue task of base Task class");
+	}
+
+	//! The name of the task in traces
+	virtual string TraceName() const {
+		return "Task";
+	}
+
+public:
+	//! The time at which the task was last queued (see TraceRecorder), only set while tracing
+	uint64_t trace_queue_time = 0;
 };
 
 //! Execute a task within an executor, including exception handling
@@ -41,6 +70,11 @@ public:
 
 	Executor &executor;
 
+public:
+	void Deschedule() override;
+	void Reschedule() override;
+	void Requeue() override;
+
 public:
 	virtual TaskExecutionResult ExecuteTask(TaskExecutionMode mode) = 0;
 	TaskExecutionResult Execute(TaskExecutionMode mode) override;
@@ -29,7 +29,7 @@ public:
 
 	virtual void Finish() {
 		while (tasks_completed < task_count) {
-			unique_ptr<Task> task;
+			shared_ptr<Task> task;
 			if (scheduler.GetTaskFromProducer(*token, task)) {
 				task->Execute();
 				task.reset();
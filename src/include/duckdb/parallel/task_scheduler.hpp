@@ -11,6 +11,7 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/vector.hpp"
+#include "duckdb/parallel/numa_topology.hpp"
 #include "duckdb/parallel/task.hpp"
 #include "duckdb/common/atomic.hpp"
 
@@ -34,22 +35,31 @@ struct ProducerToken {
 };
 
 //! The TaskScheduler is responsible for managing tasks and threads
+//! While a producer (generally a running query) has a non-default priority or a thread limit, scheduler threads pick
+//! tasks by weighted fair share: every producer accumulates the execution time of its tasks divided by its priority,
+//! and the producer with the least accumulated time is served first. Tasks are then executed in time slices so that
+//! long-running queries yield. Otherwise any queued task is taken and run to completion.
 class TaskScheduler {
 	// timeout for semaphore wait, default 5ms
 	constexpr static int64_t TASK_TIMEOUT_USECS = 5000;
 
 public:
+	//! The priority producers are created with by default
+	constexpr static idx_t DEFAULT_PRIORITY = 100;
+
 	TaskScheduler(DatabaseInstance &db);
 	~TaskScheduler();
 
 	DUCKDB_API static TaskScheduler &GetScheduler(ClientContext &context);
 	DUCKDB_API static TaskScheduler &GetScheduler(DatabaseInstance &db);
 
-	unique_ptr<ProducerToken> CreateProducer();
+	//! Create a producer with the given scheduling priority. max_threads limits the number of scheduler threads
+	//! that execute tasks of the producer at the same time (0 means no limit).
+	unique_ptr<ProducerToken> CreateProducer(idx_t priority = DEFAULT_PRIORITY, idx_t max_threads = 0);
 	//! Schedule a task to be executed by the task scheduler
-	void ScheduleTask(ProducerToken &producer, unique_ptr<Task> task);
+	void ScheduleTask(ProducerToken &producer, shared_ptr<Task> task);
 	//! Fetches a task from a specific producer, returns true if successful or false if no tasks were available
-	bool GetTaskFromProducer(ProducerToken &token, unique_ptr<Task> &task);
+	bool GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task);
 	//! Run tasks forever until "marker" is set to false, "marker" must remain valid until the thread is joined
 	void ExecuteForever(atomic<bool> *marker);
 	//! Run tasks until `marker` is set to false, `max_tasks` have been completed, or until there are no more tasks
@@ -72,7 +82,9 @@ private:
 
 private:
 	DatabaseInstance &db;
-	//! The task queue
+	//! The NUMA topology used to place the worker threads (a single node without NUMA-aware scheduling)
+	NumaTopology topology;
+	//! The task queue (one queue per NUMA node)
 	unique_ptr<ConcurrentQueue> queue;
 	//! Lock for modifying the thread count
 	mutex thread_lock;
@@ -31,6 +31,8 @@ public:
 		if (has_table) {
 			result->ref = ref->Copy();
 		}
+		result->file_statistics_key = file_statistics_key;
+		result->types = types;
 		return result;
 	}
 
@@ -42,6 +44,10 @@ public:
 	optional_ptr<TableCatalogEntry> table;
 	unordered_map<idx_t, idx_t> column_id_map;
 	vector<string> columns;
+	//! The key of the analyzed files in the FileStatisticsCatalog (if a file scan is analyzed instead of a table)
+	string file_statistics_key;
+	//! The types of the columns (for file scans)
+	vector<LogicalType> types;
 };
 
 } // namespace duckdb
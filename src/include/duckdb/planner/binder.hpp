@@ -45,6 +45,7 @@ struct BoundCreateTableInfo;
 struct BoundCreateFunctionInfo;
 struct CommonTableExpressionInfo;
 struct BoundParameterMap;
+struct VacuumInfo;
 
 enum class BindingMode : uint8_t { STANDARD_BINDING, EXTRACT_NAMES };
 
@@ -293,6 +294,8 @@ private:
 	bool BindTableInTableOutFunction(vector<unique_ptr<ParsedExpression>> &expressions,
 	                                 unique_ptr<BoundSubqueryRef> &subquery, string &error);
 	unique_ptr<LogicalOperator> BindTableFunction(TableFunction &function, vector<Value> parameters);
+	//! Plans an ANALYZE of a view over a scan of files, returns nullptr if the view does not scan files
+	unique_ptr<LogicalOperator> BindFileScanAnalyze(VacuumInfo &info, BoundTableRef &ref);
 	unique_ptr<LogicalOperator>
 	BindTableFunctionInternal(TableFunction &table_function, const string &function_name, vector<Value> parameters,
 	                          named_parameter_map_t named_parameters, vector<LogicalType> input_table_types,
@@ -0,0 +1,62 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/dynamic_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+
+namespace duckdb {
+
+//! DynamicFilterData holds the constant of a dynamic filter. The constant is only known (and tightened) while the
+//! query runs, e.g. the boundary of the heap of a top-n that the scan below it can use to skip tuples
+struct DynamicFilterData {
+	explicit DynamicFilterData(ExpressionType comparison_type) : comparison_type(comparison_type), initialized(false) {
+	}
+
+	//! The comparison type (COMPARE_GREATERTHAN(OREQUALTO) or COMPARE_LESSTHAN(OREQUALTO))
+	ExpressionType comparison_type;
+	//! Whether or not the constant has been set
+	atomic<bool> initialized;
+	//! If the values the filter is set with are compressed to (column - offset), the offset (NULL otherwise)
+	Value offset;
+
+public:
+	//! Tighten the filter with a new constant, returns false if the current constant is at least as selective
+	bool SetValue(const Value &new_constant);
+	//! Tighten the filter with a (possibly compressed) value of the operator that sets it
+	bool SetCompressedValue(const Value &compressed_value);
+	//! Returns a copy of the current filter, or nullptr if the constant has not been set yet
+	unique_ptr<ConstantFilter> GetFilter();
+	//! Clear the constant, so that a new execution of the plan does not use the boundary of a previous one
+	void Reset();
+
+private:
+	mutex lock;
+	//! The current constant
+	Value constant;
+};
+
+//! A DynamicFilter is a comparison with a constant that is set while the query runs
+class DynamicFilter : public TableFilter {
+public:
+	explicit DynamicFilter(shared_ptr<DynamicFilterData> filter_data);
+
+	//! The shared data of the filter
+	shared_ptr<DynamicFilterData> filter_data;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	void Serialize(FieldWriter &writer) const override;
+	static unique_ptr<TableFilter> Deserialize(FieldReader &source);
+};
+
+} // namespace duckdb
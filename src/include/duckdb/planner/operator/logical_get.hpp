@@ -13,6 +13,7 @@
 #include "duckdb/planner/table_filter.hpp"
 
 namespace duckdb {
+struct FileStatistics;
 
 //! LogicalGet represents a scan operation from a data source
 class LogicalGet : public LogicalOperator {
@@ -49,11 +50,16 @@ public:
 	vector<string> input_table_names;
 	//! For a table-in-out function, the set of projected input columns
 	vector<column_t> projected_input;
+	//! The statistics computed by ANALYZE for the files read by the scan (if any)
+	shared_ptr<FileStatistics> file_statistics;
 
 	string GetName() const override;
 	string ParamsToString() const override;
 	//! Returns the underlying table that is being scanned, or nullptr if there is none
 	optional_ptr<TableCatalogEntry> GetTable() const;
+	//! Returns the statistics of a column of the scan (as computed by ANALYZE for file scans), or nullptr if there are
+	//! none
+	unique_ptr<BaseStatistics> GetFileStatistics(column_t column_id) const;
 
 public:
 	vector<ColumnBinding> GetColumnBindings() override;
@@ -12,6 +12,7 @@
 #include "duckdb/planner/logical_operator.hpp"
 
 namespace duckdb {
+struct DynamicFilterData;
 
 //! LogicalTopN represents a comibination of ORDER BY and LIMIT clause, using Min/Max Heap
 class LogicalTopN : public LogicalOperator {
@@ -28,6 +29,8 @@ public:
 	int64_t limit;
 	//! The offset from the start to begin emitting elements
 	int64_t offset;
+	//! The filter on the first order that was pushed into the scan, set to the boundary of the heap (optional)
+	shared_ptr<DynamicFilterData> dynamic_filter;
 
 public:
 	vector<ColumnBinding> GetColumnBindings() override {
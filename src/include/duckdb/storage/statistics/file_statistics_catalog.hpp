@@ -0,0 +1,83 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/statistics/file_statistics_catalog.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "duckdb/storage/statistics/distinct_statistics.hpp"
+
+namespace duckdb {
+class ClientContext;
+class DatabaseInstance;
+class LogicalGet;
+
+//! The statistics of the files read by a table function scan, as computed by ANALYZE
+struct FileStatistics {
+	//! The total amount of rows in the files
+	idx_t row_count = 0;
+	//! The names and types of the columns produced by the scan
+	vector<string> names;
+	vector<LogicalType> types;
+	//! The min/max statistics of every column
+	vector<unique_ptr<BaseStatistics>> column_stats;
+	//! The amount of NULL values in every column
+	vector<idx_t> null_counts;
+	//! The HyperLogLog sketches of every column
+	vector<unique_ptr<DistinctStatistics>> distinct_stats;
+
+public:
+	//! Whether or not the statistics were computed for a scan with the given columns
+	bool Matches(const vector<string> &names, const vector<LogicalType> &types) const;
+	//! Returns the statistics of a column (including its distinct count), or nullptr if there are none
+	unique_ptr<BaseStatistics> GetColumnStatistics(column_t column_id) const;
+
+	void Serialize(Serializer &serializer) const;
+	static unique_ptr<FileStatistics> Deserialize(Deserializer &source);
+};
+
+//! The FileStatisticsCatalog holds the statistics of external files computed by ANALYZE, so that the optimizer has
+//! row counts, min/max values and distinct counts for scans over files. Entries are keyed by the scanning function, the
+//! parameters it was bound with and the scanned files together with their modification times, so that statistics of
+//! files that have changed (or that were read with different options) are never used. For persistent databases the
+//! catalog is stored in a file next to the database file.
+class FileStatisticsCatalog {
+public:
+	explicit FileStatisticsCatalog(DatabaseInstance &db);
+
+	DUCKDB_API static FileStatisticsCatalog &Get(ClientContext &context);
+
+	//! Computes the key of the files scanned by a table function, or returns an empty string if the function does not
+	//! scan files
+	static string GetKey(ClientContext &context, const LogicalGet &get);
+
+	//! Returns the statistics of the files scanned by a table function (if they have been analyzed)
+	shared_ptr<FileStatistics> GetStatistics(ClientContext &context, const LogicalGet &get);
+	//! Stores the statistics of a set of files
+	void SetStatistics(ClientContext &context, const string &key, shared_ptr<FileStatistics> statistics);
+
+private:
+	//! Loads the catalog from disk (if it has not been loaded yet)
+	void LoadInternal(ClientContext &context);
+	//! Writes the catalog to disk
+	void SaveInternal(ClientContext &context);
+	//! The path of the file in which the catalog is stored, or an empty string if it is not persisted
+	string GetPath();
+
+private:
+	DatabaseInstance &db;
+	mutex lock;
+	bool loaded;
+	unordered_map<string, shared_ptr<FileStatistics>> entries;
+	//! Map of key without modification times -> key, there is at most one entry for a scan of a set of files
+	unordered_map<string, string> file_keys;
+};
+
+} // namespace duckdb
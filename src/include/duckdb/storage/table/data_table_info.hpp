@@ -26,6 +26,9 @@ struct DataTableInfo {
 	//! The amount of elements in the table. Note that this number signifies the amount of COMMITTED entries in the
 	//! table. It can be inaccurate inside of transactions. More work is needed to properly support that.
 	atomic<idx_t> cardinality;
+	//! Incremented whenever data is written to the table, cached plans that relied on the statistics of the table
+	//! use it to detect that they are out of date
+	atomic<idx_t> data_version;
 	// schema of the table
 	string schema;
 	// name of the table
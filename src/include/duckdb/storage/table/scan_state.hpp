@@ -146,6 +146,9 @@ private:
 };
 
 struct ParallelCollectionScanState {
+	//! The minimum amount of vectors that a parallel scan hands out to a thread at once
+	static constexpr const idx_t MIN_MORSEL_VECTORS = 8;
+
 	ParallelCollectionScanState();
 
 	//! The row group collection we are scanning
@@ -155,6 +158,8 @@ struct ParallelCollectionScanState {
 	idx_t max_row;
 	idx_t batch_index;
 	atomic<idx_t> processed_rows;
+	//! The amount of threads the morsels are sized for (0 if not yet determined)
+	idx_t thread_count;
 	mutex lock;
 };
 
@@ -12,6 +12,7 @@
 #include "duckdb/common/serializer/buffered_serializer.hpp"
 #include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/execution/column_binding_resolver.hpp"
+#include "duckdb/execution/operator/helper/physical_buffered_collector.hpp"
 #include "duckdb/execution/operator/helper/physical_result_collector.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/main/appender.hpp"
@@ -22,6 +23,7 @@
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/error_manager.hpp"
 #include "duckdb/main/materialized_query_result.hpp"
+#include "duckdb/main/plan_cache.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/main/query_result.hpp"
 #include "duckdb/main/relation.hpp"
@@ -154,7 +156,7 @@ void ClientContext::BeginQueryInternal(ClientContextLock &lock, const string &qu
 }
 
 PreservedError ClientContext::EndQueryInternal(ClientContextLock &lock, bool success, bool invalidate_transaction) {
-	client_data->profiler->EndQuery();
+	client_data->profiler->EndQuery(success);
 
 	if (client_data->http_state) {
 		client_data->http_state->Reset();
@@ -250,7 +252,7 @@ unique_ptr<QueryResult> ClientContext::FetchResultInternal(ClientContextLock &lo
 	auto &prepared = *active_query->prepared;
 	bool create_stream_result = prepared.properties.allow_stream_result && pending.allow_stream_result;
 	if (create_stream_result) {
-		D_ASSERT(!executor.HasResultCollector());
+		D_ASSERT(!executor.HasResultCollector() || executor.HasStreamingResultCollector());
 		active_query->progress_bar.reset();
 		query_progress = -1;
 
@@ -418,6 +420,10 @@ unique_ptr<PendingQueryResult> ClientContext::PendingPreparedStatement(ClientCon
 		collector = get_method(*this, statement);
 		D_ASSERT(collector->type == PhysicalOperatorType::RESULT_COLLECTOR);
 		executor.Initialize(std::move(collector));
+	} else if (stream_result && statement.properties.return_type == StatementReturnType::QUERY_RESULT &&
+	           ClientConfig::GetConfig(*this).streaming_buffer_size > 0) {
+		// stream the result through a bounded buffer that is filled by the (parallel) final pipeline
+		executor.Initialize(PhysicalBufferedCollector::Create(*this, statement));
 	} else {
 		executor.Initialize(*statement.plan);
 	}
@@ -607,7 +613,27 @@ unique_ptr<PendingQueryResult> ClientContext::PendingStatementInternal(ClientCon
                                                                        unique_ptr<SQLStatement> statement,
                                                                        PendingQueryParameters parameters) {
 	// prepare the query for execution
-	auto prepared = CreatePreparedStatement(lock, query, std::move(statement), parameters.parameters);
+	shared_ptr<PreparedStatementData> prepared;
+	auto &plan_cache = PlanCache::Get(*this);
+	string cache_key;
+	if (PlanCache::IsEnabled(*this) && PlanCache::TryGetKey(*statement, parameters.parameters, cache_key)) {
+		prepared = plan_cache.Lookup(*this, cache_key);
+		if (!prepared) {
+			plan_cache.StartRecording();
+			try {
+				prepared = CreatePreparedStatement(lock, query, std::move(statement), parameters.parameters);
+			} catch (std::exception &ex) {
+				plan_cache.StopRecording();
+				throw;
+			}
+			auto dependencies = plan_cache.StopRecording();
+			if (prepared->properties.bound_all_parameters) {
+				plan_cache.Insert(*this, cache_key, prepared, std::move(dependencies));
+			}
+		}
+	} else {
+		prepared = CreatePreparedStatement(lock, query, std::move(statement), parameters.parameters);
+	}
 	if (prepared->properties.parameter_count > 0 && !parameters.parameters) {
 		string error_message = StringUtil::Format("Expected %lld parameters, but none were supplied",
 		                                          prepared->properties.parameter_count);
@@ -10,6 +10,7 @@
 #include "duckdb/main/client_context_file_opener.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/plan_cache.hpp"
 #include "duckdb/main/query_profiler.hpp"
 
 namespace duckdb {
@@ -18,6 +19,7 @@ ClientData::ClientData(ClientContext &context) : catalog_search_path(make_uniq<C
 	auto &db = DatabaseInstance::GetDatabase(context);
 	profiler = make_shared<QueryProfiler>(context);
 	query_profiler_history = make_uniq<QueryProfilerHistory>();
+	plan_cache = make_uniq<PlanCache>();
 	temporary_objects = make_shared<AttachedDatabase>(db, AttachedDatabaseType::TEMP_DATABASE);
 	temporary_objects->oid = DatabaseManager::Get(db).ModifyCatalog();
 	random_engine = make_uniq<RandomEngine>();
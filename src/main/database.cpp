@@ -7,6 +7,9 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/object_cache.hpp"
+#include "duckdb/storage/statistics/file_statistics_catalog.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
+#include "duckdb/common/trace_recorder.hpp"
 #include "duckdb/transaction/transaction_manager.hpp"
 #include "duckdb/main/connection_manager.hpp"
 #include "duckdb/function/compression_function.hpp"
@@ -200,10 +203,13 @@ void DatabaseInstance::Initialize(const char *database_path, DBConfig *user_conf
 		config.options.temporary_directory = string();
 	}
 
+	trace_recorder = make_uniq<TraceRecorder>();
 	db_manager = make_uniq<DatabaseManager>(*this);
 	buffer_manager = make_uniq<StandardBufferManager>(*this, config.options.temporary_directory);
 	scheduler = make_uniq<TaskScheduler>(*this);
 	object_cache = make_uniq<ObjectCache>();
+	file_statistics_catalog = make_uniq<FileStatisticsCatalog>(*this);
+	cardinality_feedback = make_uniq<CardinalityFeedback>();
 	connection_manager = make_uniq<ConnectionManager>();
 
 	// check if we are opening a standard DuckDB database or an extension database
@@ -300,6 +306,18 @@ ObjectCache &DatabaseInstance::GetObjectCache() {
 	return *object_cache;
 }
 
+FileStatisticsCatalog &DatabaseInstance::GetFileStatisticsCatalog() {
+	return *file_statistics_catalog;
+}
+
+CardinalityFeedback &DatabaseInstance::GetCardinalityFeedback() {
+	return *cardinality_feedback;
+}
+
+TraceRecorder &DatabaseInstance::GetTraceRecorder() {
+	return *trace_recorder;
+}
+
 FileSystem &DatabaseInstance::GetFileSystem() {
 	return *config.file_system;
 }
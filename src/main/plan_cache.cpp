@@ -0,0 +1,165 @@
+#include "duckdb/main/plan_cache.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/common/multi_file_reader.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/parser/sql_statement.hpp"
+#include "duckdb/storage/data_table.hpp"
+
+namespace duckdb {
+
+PlanCache::PlanCache() : recording(false) {
+}
+
+PlanCache::~PlanCache() {
+}
+
+PlanCache &PlanCache::Get(ClientContext &context) {
+	return *ClientData::Get(context).plan_cache;
+}
+
+bool PlanCache::IsEnabled(ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	// verification compares the results of differently planned statements: don't short-circuit it
+	return config.plan_cache_size > 0 && !config.AnyVerification();
+}
+
+bool PlanCache::TryGetKey(SQLStatement &statement, const vector<Value> *values, string &result) {
+	if (statement.type != StatementType::SELECT_STATEMENT) {
+		return false;
+	}
+	// normalize the statement text by rendering the parsed statement
+	try {
+		result = statement.ToString();
+	} catch (std::exception &ex) {
+		return false;
+	}
+	if (result.empty()) {
+		return false;
+	}
+	// the parameter types are used during binding, so they are part of the key as well
+	if (values) {
+		for (auto &value : *values) {
+			result += '\0';
+			result += value.type().ToString();
+		}
+	}
+	return true;
+}
+
+bool PlanCache::IsValid(ClientContext &context, const PlanCacheEntry &entry) {
+	if (Catalog::GetSystemCatalog(context).GetCatalogVersion() != entry.prepared->catalog_version) {
+		// the catalog was modified since the plan was made
+		return false;
+	}
+	for (auto &table : entry.dependencies.tables) {
+		if (table.info->data_version != table.data_version) {
+			// data was written to the table: the plan might rely on statistics that no longer hold
+			return false;
+		}
+	}
+	for (auto &file_list : entry.dependencies.file_lists) {
+		vector<string> files;
+		try {
+			files = MultiFileReader::GetFileList(context, file_list.input, file_list.name, file_list.options);
+		} catch (std::exception &ex) {
+			// let the planner report the error
+			return false;
+		}
+		if (files != file_list.files) {
+			return false;
+		}
+	}
+	return true;
+}
+
+shared_ptr<PreparedStatementData> PlanCache::Lookup(ClientContext &context, const string &key) {
+	auto entry = entry_map.find(key);
+	if (entry == entry_map.end()) {
+		misses++;
+		return nullptr;
+	}
+	if (!IsValid(context, *entry->second)) {
+		entries.erase(entry->second);
+		entry_map.erase(entry);
+		invalidations++;
+		misses++;
+		return nullptr;
+	}
+	// move the entry to the front of the LRU list
+	entries.splice(entries.begin(), entries, entry->second);
+	hits++;
+	return entries.front().prepared;
+}
+
+void PlanCache::Insert(ClientContext &context, const string &key, shared_ptr<PreparedStatementData> prepared,
+                       PlanCacheDependencies dependencies) {
+	auto capacity = ClientConfig::GetConfig(context).plan_cache_size;
+	if (capacity == 0) {
+		return;
+	}
+	auto entry = entry_map.find(key);
+	if (entry != entry_map.end()) {
+		entries.erase(entry->second);
+		entry_map.erase(entry);
+	}
+	Evict(capacity - 1);
+
+	PlanCacheEntry new_entry;
+	new_entry.key = key;
+	new_entry.prepared = std::move(prepared);
+	new_entry.dependencies = std::move(dependencies);
+	entries.push_front(std::move(new_entry));
+	entry_map[key] = entries.begin();
+}
+
+void PlanCache::Evict(idx_t capacity) {
+	while (entries.size() > capacity) {
+		entry_map.erase(entries.back().key);
+		entries.pop_back();
+		evictions++;
+	}
+}
+
+void PlanCache::Clear() {
+	invalidations += entries.size();
+	entries.clear();
+	entry_map.clear();
+}
+
+void PlanCache::StartRecording() {
+	recording = true;
+	recorded = PlanCacheDependencies();
+}
+
+void PlanCache::RecordFileList(const Value &input, const string &name, FileGlobOptions options,
+                               const vector<string> &files) {
+	if (!recording) {
+		return;
+	}
+	PlanCacheFileList file_list;
+	file_list.input = input;
+	file_list.name = name;
+	file_list.options = options;
+	file_list.files = files;
+	recorded.file_lists.push_back(std::move(file_list));
+}
+
+void PlanCache::RecordTable(DataTable &table) {
+	if (!recording) {
+		return;
+	}
+	PlanCacheTable entry;
+	entry.info = table.info;
+	entry.data_version = table.info->data_version;
+	recorded.tables.push_back(std::move(entry));
+}
+
+PlanCacheDependencies PlanCache::StopRecording() {
+	recording = false;
+	return std::move(recorded);
+}
+
+} // namespace duckdb
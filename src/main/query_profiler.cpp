@@ -14,6 +14,7 @@
 #include "duckdb/main/client_config.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/client_data.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 
 #include <algorithm>
@@ -124,7 +125,7 @@ void QueryProfiler::StartExplainAnalyze() {
 	this->is_explain_analyze = true;
 }
 
-void QueryProfiler::EndQuery() {
+void QueryProfiler::EndQuery(bool success) {
 	lock_guard<mutex> guard(flush_lock);
 	if (!IsEnabled() || !running) {
 		return;
@@ -133,6 +134,9 @@ void QueryProfiler::EndQuery() {
 	main_query.End();
 	if (root) {
 		Finalize(*root);
+		if (success) {
+			RecordCardinalityFeedback();
+		}
 	}
 	this->running = false;
 	// print or output the query profiling after termination
@@ -151,6 +155,32 @@ void QueryProfiler::EndQuery() {
 	}
 	this->is_explain_analyze = false;
 }
+void QueryProfiler::RecordCardinalityFeedback() {
+	if (!CardinalityFeedback::IsEnabled(context)) {
+		return;
+	}
+	for (auto &entry : tree_map) {
+		switch (entry.first.get().type) {
+		case PhysicalOperatorType::LIMIT:
+		case PhysicalOperatorType::LIMIT_PERCENT:
+		case PhysicalOperatorType::STREAMING_LIMIT:
+			// the operators below a limit might not have produced all of their output
+			return;
+		default:
+			break;
+		}
+	}
+	auto &feedback = CardinalityFeedback::Get(context);
+	for (auto &entry : tree_map) {
+		auto &op = entry.first.get();
+		if (!op.estimated_props || !op.estimated_props->GetFeedbackKey()) {
+			continue;
+		}
+		feedback.Record(context, *op.estimated_props->GetFeedbackKey(), op.estimated_props->GetCardinality<idx_t>(),
+		                entry.second.get().info.elements);
+	}
+}
+
 string QueryProfiler::ToString() const {
 	const auto format = GetPrintFormat();
 	switch (format) {
@@ -224,7 +254,8 @@ void QueryProfiler::Initialize(const PhysicalOperator &root_op) {
 	}
 }
 
-OperatorProfiler::OperatorProfiler(bool enabled_p) : enabled(enabled_p), active_operator(nullptr) {
+OperatorProfiler::OperatorProfiler(bool enabled_p, bool count_hardware_events_p)
+    : enabled(enabled_p), count_hardware_events(enabled_p && count_hardware_events_p), active_operator(nullptr) {
 }
 
 void OperatorProfiler::StartOperator(optional_ptr<const PhysicalOperator> phys_op) {
@@ -238,6 +269,9 @@ void OperatorProfiler::StartOperator(optional_ptr<const PhysicalOperator> phys_o
 
 	active_operator = phys_op;
 
+	if (count_hardware_events) {
+		HardwareCounters::Read(counters_start);
+	}
 	// start timing for current element
 	op.Start();
 }
@@ -254,11 +288,17 @@ void OperatorProfiler::EndOperator(optional_ptr<DataChunk> chunk) {
 	// finish timing for the current element
 	op.End();
 
-	AddTiming(*active_operator, op.Elapsed(), chunk ? chunk->size() : 0);
+	HardwareCounterValues counters;
+	HardwareCounterValues counters_end;
+	if (count_hardware_events && HardwareCounters::Read(counters_end)) {
+		counters = counters_end - counters_start;
+	}
+	AddTiming(*active_operator, op.Elapsed(), chunk ? chunk->size() : 0, counters);
 	active_operator = nullptr;
 }
 
-void OperatorProfiler::AddTiming(const PhysicalOperator &op, double time, idx_t elements) {
+void OperatorProfiler::AddTiming(const PhysicalOperator &op, double time, idx_t elements,
+                                 const HardwareCounterValues &counters) {
 	if (!enabled) {
 		return;
 	}
@@ -269,12 +309,26 @@ void OperatorProfiler::AddTiming(const PhysicalOperator &op, double time, idx_t
 	if (entry == timings.end()) {
 		// add new entry
 		timings[op] = OperatorInformation(time, elements);
+		timings[op].counters = counters;
 	} else {
 		// add to existing entry
 		entry->second.time += time;
 		entry->second.elements += elements;
+		entry->second.counters += counters;
 	}
 }
+void OperatorProfiler::AddRuntimeInfo(const PhysicalOperator &phys_op, const string &info) {
+	if (!enabled) {
+		return;
+	}
+	auto entry = timings.find(phys_op);
+	if (entry == timings.end()) {
+		timings[phys_op] = OperatorInformation();
+		entry = timings.find(phys_op);
+	}
+	entry->second.runtime_info = info;
+}
+
 void OperatorProfiler::Flush(const PhysicalOperator &phys_op, ExpressionExecutor &expression_executor,
                              const string &name, int id) {
 	auto entry = timings.find(phys_op);
@@ -302,6 +356,11 @@ void QueryProfiler::Flush(OperatorProfiler &profiler) {
 
 		tree_node.info.time += node.second.time;
 		tree_node.info.elements += node.second.elements;
+		tree_node.info.counters += node.second.counters;
+		if (!node.second.runtime_info.empty()) {
+			// every thread executing the operator makes the same decision
+			tree_node.info.runtime_info = node.second.runtime_info;
+		}
 		if (!IsDetailedEnabled()) {
 			continue;
 		}
@@ -483,9 +542,20 @@ static string JSONSanitize(const string &text) {
 	return result;
 }
 
+static void PrintHardwareCounters(std::ostream &ss, const HardwareCounterValues &counters, int depth) {
+	if (counters.IsEmpty()) {
+		return;
+	}
+	ss << string(depth * 3, ' ') << "   \"cycles\": " + to_string(counters.cycles) + ",\n";
+	ss << string(depth * 3, ' ') << "   \"instructions\": " + to_string(counters.instructions) + ",\n";
+	ss << string(depth * 3, ' ') << "   \"llc_misses\": " + to_string(counters.llc_misses) + ",\n";
+	ss << string(depth * 3, ' ') << "   \"branch_misses\": " + to_string(counters.branch_misses) + ",\n";
+}
+
 // Print a row
 static void PrintRow(std::ostream &ss, const string &annotation, int id, const string &name, double time,
-                     int sample_counter, int tuple_counter, const string &extra_info, int depth) {
+                     int sample_counter, int tuple_counter, const string &extra_info, int depth,
+                     const HardwareCounterValues &counters) {
 	ss << string(depth * 3, ' ') << " {\n";
 	ss << string(depth * 3, ' ') << "   \"annotation\": \"" + JSONSanitize(annotation) + "\",\n";
 	ss << string(depth * 3, ' ') << "   \"id\": " + to_string(id) + ",\n";
@@ -499,6 +569,7 @@ static void PrintRow(std::ostream &ss, const string &annotation, int id, const s
 #endif
 	ss << string(depth * 3, ' ') << "   \"sample_size\": " << to_string(sample_counter) + ",\n";
 	ss << string(depth * 3, ' ') << "   \"input_size\": " << to_string(tuple_counter) + ",\n";
+	PrintHardwareCounters(ss, counters, depth);
 	ss << string(depth * 3, ' ') << "   \"extra_info\": \"" << JSONSanitize(extra_info) + "\"\n";
 	ss << string(depth * 3, ' ') << " },\n";
 }
@@ -507,7 +578,7 @@ static void ExtractFunctions(std::ostream &ss, ExpressionInfo &info, int &fun_id
 	if (info.hasfunction) {
 		double time = info.sample_tuples_count == 0 ? 0 : int(info.function_time) / double(info.sample_tuples_count);
 		PrintRow(ss, "Function", fun_id++, info.function_name, time, info.sample_tuples_count, info.tuples_count, "",
-		         depth);
+		         depth, info.counters);
 	}
 	if (info.children.empty()) {
 		return;
@@ -523,6 +594,7 @@ static void ToJSONRecursive(QueryProfiler::TreeNode &node, std::ostream &ss, int
 	ss << string(depth * 3, ' ') << "   \"name\": \"" + JSONSanitize(node.name) + "\",\n";
 	ss << string(depth * 3, ' ') << "   \"timing\":" + to_string(node.info.time) + ",\n";
 	ss << string(depth * 3, ' ') << "   \"cardinality\":" + to_string(node.info.elements) + ",\n";
+	PrintHardwareCounters(ss, node.info.counters, depth);
 	ss << string(depth * 3, ' ') << "   \"extra_info\": \"" + JSONSanitize(node.extra_info) + "\",\n";
 	ss << string(depth * 3, ' ') << "   \"timings\": [";
 	int32_t function_counter = 1;
@@ -538,7 +610,8 @@ static void ToJSONRecursive(QueryProfiler::TreeNode &node, std::ostream &ss, int
 			                  ? 0
 			                  : double(expr_timer->time) / double(expr_timer->sample_tuples_count);
 			PrintRow(ss, "ExpressionRoot", expression_counter++, expr_timer->name, time,
-			         expr_timer->sample_tuples_count, expr_timer->tuples_count, expr_timer->extra_info, depth + 1);
+			         expr_timer->sample_tuples_count, expr_timer->tuples_count, expr_timer->extra_info, depth + 1,
+			         expr_timer->counters);
 			// Extract all functions inside the tree
 			ExtractFunctions(ss, *expr_timer->root, function_counter, depth + 1);
 		}
@@ -675,6 +748,7 @@ void ExpressionInfo::ExtractExpressionsRecursive(unique_ptr<ExpressionState> &st
 			expr_info->function_time = child->profiler.time;
 			expr_info->sample_tuples_count = child->profiler.sample_tuples_count;
 			expr_info->tuples_count = child->profiler.tuples_count;
+			expr_info->counters = child->profiler.counters;
 		}
 		expr_info->ExtractExpressionsRecursive(child);
 		children.push_back(std::move(expr_info));
@@ -692,7 +766,7 @@ ExpressionExecutorInfo::ExpressionExecutorInfo(ExpressionExecutor &executor, con
 ExpressionRootInfo::ExpressionRootInfo(ExpressionExecutorState &state, string name)
     : current_count(state.profiler.current_count), sample_count(state.profiler.sample_count),
       sample_tuples_count(state.profiler.sample_tuples_count), tuples_count(state.profiler.tuples_count),
-      name("expression"), time(state.profiler.time) {
+      name("expression"), time(state.profiler.time), counters(state.profiler.counters) {
 	// Use the name of expression-tree as extra-info
 	extra_info = std::move(name);
 	auto expression_info_p = make_uniq<ExpressionInfo>();
@@ -703,6 +777,7 @@ ExpressionRootInfo::ExpressionRootInfo(ExpressionExecutorState &state, string na
 		expression_info_p->function_time = state.root_state->profiler.time;
 		expression_info_p->sample_tuples_count = state.root_state->profiler.sample_tuples_count;
 		expression_info_p->tuples_count = state.root_state->profiler.tuples_count;
+		expression_info_p->counters = state.root_state->profiler.counters;
 	}
 	expression_info_p->ExtractExpressionsRecursive(state.root_state);
 	root = std::move(expression_info_p);
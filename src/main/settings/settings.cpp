@@ -5,7 +5,9 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/client_data.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/main/connection_manager.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parser.hpp"
 #include "duckdb/planner/expression_binder.hpp"
@@ -17,6 +19,17 @@
 
 namespace duckdb {
 
+//! Setting a session setting globally sets it for every connection of the database
+static void ForEachConnection(DatabaseInstance *db, const char *name,
+                              const std::function<void(ClientContext &context)> &callback) {
+	if (!db) {
+		throw InvalidInputException("Option \"%s\" can only be set globally on a running database", name);
+	}
+	for (auto &connection : db->GetConnectionManager().GetConnectionList()) {
+		callback(*connection);
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Access Mode
 //===--------------------------------------------------------------------===//
@@ -52,6 +65,77 @@ Value AccessModeSetting::GetSetting(ClientContext &context) {
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Adaptive Join Threshold
+//===--------------------------------------------------------------------===//
+void AdaptiveJoinThresholdSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	ForEachConnection(db, Name, [&](ClientContext &context) { SetLocal(context, input); });
+}
+
+void AdaptiveJoinThresholdSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	ForEachConnection(db, Name, [&](ClientContext &context) { ResetLocal(context); });
+}
+
+void AdaptiveJoinThresholdSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).adaptive_join_threshold = ClientConfig().adaptive_join_threshold;
+}
+
+void AdaptiveJoinThresholdSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto threshold = input.GetValue<double>();
+	if (threshold != 0 && threshold < 1) {
+		throw InvalidInputException("adaptive_join_threshold must be 0 (disabled) or at least 1");
+	}
+	ClientConfig::GetConfig(context).adaptive_join_threshold = threshold;
+}
+
+Value AdaptiveJoinThresholdSetting::GetSetting(ClientContext &context) {
+	return Value::DOUBLE(ClientConfig::GetConfig(context).adaptive_join_threshold);
+}
+
+//===--------------------------------------------------------------------===//
+// Adaptive Parallelism
+//===--------------------------------------------------------------------===//
+void AdaptiveParallelismSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	ForEachConnection(db, Name, [&](ClientContext &context) { SetLocal(context, input); });
+}
+
+void AdaptiveParallelismSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	ForEachConnection(db, Name, [&](ClientContext &context) { ResetLocal(context); });
+}
+
+void AdaptiveParallelismSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).adaptive_parallelism = ClientConfig().adaptive_parallelism;
+}
+
+void AdaptiveParallelismSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).adaptive_parallelism = input.GetValue<bool>();
+}
+
+Value AdaptiveParallelismSetting::GetSetting(ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).adaptive_parallelism);
+}
+
+//===--------------------------------------------------------------------===//
+// Cardinality Feedback Size
+//===--------------------------------------------------------------------===//
+void CardinalityFeedbackSizeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.cardinality_feedback_size = input.GetValue<uint64_t>();
+	if (db) {
+		db->GetCardinalityFeedback().Evict(config.options.cardinality_feedback_size);
+	}
+}
+
+void CardinalityFeedbackSizeSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.cardinality_feedback_size = DBConfig().options.cardinality_feedback_size;
+	if (db) {
+		db->GetCardinalityFeedback().Evict(config.options.cardinality_feedback_size);
+	}
+}
+
+Value CardinalityFeedbackSizeSetting::GetSetting(ClientContext &context) {
+	return Value::UBIGINT(DBConfig::GetConfig(context).options.cardinality_feedback_size);
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint Threshold
 //===--------------------------------------------------------------------===//
@@ -336,6 +420,21 @@ Value DisabledOptimizersSetting::GetSetting(ClientContext &context) {
 	return Value(result);
 }
 
+//===--------------------------------------------------------------------===//
+// Enable Expression Fusion
+//===--------------------------------------------------------------------===//
+void EnableExpressionFusionSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).enable_expression_fusion = ClientConfig().enable_expression_fusion;
+}
+
+void EnableExpressionFusionSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).enable_expression_fusion = input.GetValue<bool>();
+}
+
+Value EnableExpressionFusionSetting::GetSetting(ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).enable_expression_fusion);
+}
+
 //===--------------------------------------------------------------------===//
 // Enable External Access
 //===--------------------------------------------------------------------===//
@@ -684,6 +783,40 @@ Value ForceBitpackingModeSetting::GetSetting(ClientContext &context) {
 	return Value(BitpackingModeToString(context.db->config.options.force_bitpacking_mode));
 }
 
+//===--------------------------------------------------------------------===//
+// Holistic Aggregate Mode
+//===--------------------------------------------------------------------===//
+void HolisticAggregateModeSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).holistic_aggregate_mode = ClientConfig().holistic_aggregate_mode;
+}
+
+void HolisticAggregateModeSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	if (parameter == "in_memory") {
+		ClientConfig::GetConfig(context).holistic_aggregate_mode = HolisticAggregateMode::IN_MEMORY;
+	} else if (parameter == "spill") {
+		ClientConfig::GetConfig(context).holistic_aggregate_mode = HolisticAggregateMode::SPILL;
+	} else if (parameter == "approximate") {
+		ClientConfig::GetConfig(context).holistic_aggregate_mode = HolisticAggregateMode::APPROXIMATE;
+	} else {
+		throw ParserException(
+		    "Unrecognized holistic aggregate mode \"%s\", expected either IN_MEMORY, SPILL or APPROXIMATE", parameter);
+	}
+}
+
+Value HolisticAggregateModeSetting::GetSetting(ClientContext &context) {
+	switch (ClientConfig::GetConfig(context).holistic_aggregate_mode) {
+	case HolisticAggregateMode::IN_MEMORY:
+		return "in_memory";
+	case HolisticAggregateMode::SPILL:
+		return "spill";
+	case HolisticAggregateMode::APPROXIMATE:
+		return "approximate";
+	default:
+		throw InternalException("Unrecognized holistic aggregate mode");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Home Directory
 //===--------------------------------------------------------------------===//
@@ -797,6 +930,28 @@ Value MaximumMemorySetting::GetSetting(ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.maximum_memory));
 }
 
+//===--------------------------------------------------------------------===//
+// NUMA Aware Scheduling
+//===--------------------------------------------------------------------===//
+void NumaAwareSchedulingSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	if (db) {
+		throw InvalidInputException("Cannot change numa_aware_scheduling setting while database is running");
+	}
+	config.options.numa_aware_scheduling = input.GetValue<bool>();
+}
+
+void NumaAwareSchedulingSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	if (db) {
+		throw InvalidInputException("Cannot change numa_aware_scheduling setting while database is running");
+	}
+	config.options.numa_aware_scheduling = DBConfig().options.numa_aware_scheduling;
+}
+
+Value NumaAwareSchedulingSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.numa_aware_scheduling);
+}
+
 //===--------------------------------------------------------------------===//
 // Password Setting
 //===--------------------------------------------------------------------===//
@@ -848,6 +1003,22 @@ Value PivotLimitSetting::GetSetting(ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).pivot_limit);
 }
 
+//===--------------------------------------------------------------------===//
+// Plan Cache Size
+//===--------------------------------------------------------------------===//
+
+void PlanCacheSizeSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).plan_cache_size = ClientConfig().plan_cache_size;
+}
+
+void PlanCacheSizeSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).plan_cache_size = input.GetValue<uint64_t>();
+}
+
+Value PlanCacheSizeSetting::GetSetting(ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).plan_cache_size);
+}
+
 //===--------------------------------------------------------------------===//
 // PreserveIdentifierCase
 //===--------------------------------------------------------------------===//
@@ -921,6 +1092,29 @@ Value ProfileOutputSetting::GetSetting(ClientContext &context) {
 	return Value(config.profiler_save_location);
 }
 
+//===--------------------------------------------------------------------===//
+// Profiling Hardware Counters
+//===--------------------------------------------------------------------===//
+void ProfilingHardwareCountersSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	ForEachConnection(db, Name, [&](ClientContext &context) { SetLocal(context, input); });
+}
+
+void ProfilingHardwareCountersSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	ForEachConnection(db, Name, [&](ClientContext &context) { ResetLocal(context); });
+}
+
+void ProfilingHardwareCountersSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).enable_hardware_counters = ClientConfig().enable_hardware_counters;
+}
+
+void ProfilingHardwareCountersSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).enable_hardware_counters = input.GetValue<bool>();
+}
+
+Value ProfilingHardwareCountersSetting::GetSetting(ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).enable_hardware_counters);
+}
+
 //===--------------------------------------------------------------------===//
 // Profiling Mode
 //===--------------------------------------------------------------------===//
@@ -977,6 +1171,48 @@ Value ProgressBarTimeSetting::GetSetting(ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).wait_time);
 }
 
+//===--------------------------------------------------------------------===//
+// Query Max Threads
+//===--------------------------------------------------------------------===//
+void QueryMaxThreadsSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_max_threads = ClientConfig().query_max_threads;
+}
+
+void QueryMaxThreadsSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).query_max_threads = input.GetValue<uint64_t>();
+}
+
+Value QueryMaxThreadsSetting::GetSetting(ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).query_max_threads);
+}
+
+//===--------------------------------------------------------------------===//
+// Query Priority
+//===--------------------------------------------------------------------===//
+void QueryPrioritySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	ForEachConnection(db, Name, [&](ClientContext &context) { SetLocal(context, input); });
+}
+
+void QueryPrioritySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	ForEachConnection(db, Name, [&](ClientContext &context) { ResetLocal(context); });
+}
+
+void QueryPrioritySetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_priority = ClientConfig().query_priority;
+}
+
+void QueryPrioritySetting::SetLocal(ClientContext &context, const Value &input) {
+	auto priority = input.GetValue<uint64_t>();
+	if (priority == 0) {
+		throw InvalidInputException("Invalid option for query_priority, value must be positive");
+	}
+	ClientConfig::GetConfig(context).query_priority = priority;
+}
+
+Value QueryPrioritySetting::GetSetting(ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).query_priority);
+}
+
 //===--------------------------------------------------------------------===//
 // Schema
 //===--------------------------------------------------------------------===//
@@ -1018,6 +1254,22 @@ Value SearchPathSetting::GetSetting(ClientContext &context) {
 	return Value(CatalogSearchEntry::ListToString(set_paths));
 }
 
+//===--------------------------------------------------------------------===//
+// Streaming Buffer Size
+//===--------------------------------------------------------------------===//
+void StreamingBufferSizeSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).streaming_buffer_size = ClientConfig().streaming_buffer_size;
+}
+
+void StreamingBufferSizeSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).streaming_buffer_size = DBConfig::ParseMemoryLimit(input.ToString());
+}
+
+Value StreamingBufferSizeSetting::GetSetting(ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	return Value(StringUtil::BytesToHumanReadableString(config.streaming_buffer_size));
+}
+
 //===--------------------------------------------------------------------===//
 // Temp Directory
 //===--------------------------------------------------------------------===//
@@ -0,0 +1,289 @@
+#include "duckdb/optimizer/aggregate_pushdown.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
+#include "duckdb/function/function_binder.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+
+namespace duckdb {
+
+static void GetColumnReferences(Expression &expr, vector<ColumnBinding> &result, column_binding_set_t &found) {
+	if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
+		auto &colref = expr.Cast<BoundColumnRefExpression>();
+		if (found.find(colref.binding) == found.end()) {
+			found.insert(colref.binding);
+			result.push_back(colref.binding);
+		}
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { GetColumnReferences(child, result, found); });
+}
+
+static void ReplaceColumnReferences(unique_ptr<Expression> &expr, const column_binding_map_t<ColumnBinding> &map) {
+	if (expr->type == ExpressionType::BOUND_COLUMN_REF) {
+		auto &colref = expr->Cast<BoundColumnRefExpression>();
+		auto entry = map.find(colref.binding);
+		if (entry != map.end()) {
+			colref.binding = entry->second;
+		}
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(
+	    *expr, [&](unique_ptr<Expression> &child) { ReplaceColumnReferences(child, map); });
+}
+
+//! Whether or not the aggregate can be computed exactly from the partial aggregates of disjoint groups of its input
+static bool IsDecomposable(BoundAggregateExpression &aggr) {
+	if (aggr.IsDistinct() || aggr.filter || aggr.order_bys) {
+		return false;
+	}
+	auto &name = aggr.function.name;
+	if (name == "min" || name == "max") {
+		return aggr.children.size() == 1;
+	}
+	if (name == "count" || name == "count_star") {
+		return aggr.children.size() <= 1;
+	}
+	if (name == "sum") {
+		// floating point sums depend on the order in which the values are added
+		if (aggr.children.size() != 1) {
+			return false;
+		}
+		auto &type = aggr.children[0]->return_type;
+		return type.IsIntegral() || type.id() == LogicalTypeId::DECIMAL;
+	}
+	return false;
+}
+
+unique_ptr<LogicalOperator> AggregatePushdown::Optimize(unique_ptr<LogicalOperator> op) {
+	if (op->type == LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY) {
+		TryPushdown(op->Cast<LogicalAggregate>());
+	}
+	for (auto &child : op->children) {
+		child = Optimize(std::move(child));
+	}
+	return op;
+}
+
+bool AggregatePushdown::TryPushdown(LogicalAggregate &aggr) {
+	if (aggr.grouping_sets.size() > 1 || !aggr.grouping_functions.empty() || aggr.expressions.empty()) {
+		return false;
+	}
+	if (aggr.children[0]->type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		return false;
+	}
+	auto &join = aggr.children[0]->Cast<LogicalComparisonJoin>();
+	if (join.join_type != JoinType::INNER || !join.left_projection_map.empty() ||
+	    !join.right_projection_map.empty()) {
+		return false;
+	}
+	// all aggregates have to be decomposable
+	vector<ColumnBinding> aggregate_columns;
+	column_binding_set_t found;
+	for (auto &expr : aggr.expressions) {
+		if (expr->type != ExpressionType::BOUND_AGGREGATE) {
+			return false;
+		}
+		auto &bound_aggr = expr->Cast<BoundAggregateExpression>();
+		if (!IsDecomposable(bound_aggr)) {
+			return false;
+		}
+		for (auto &child : bound_aggr.children) {
+			GetColumnReferences(*child, aggregate_columns, found);
+		}
+	}
+
+	// figure out which side of the join the aggregates read
+	auto &context = optimizer.context;
+	column_binding_set_t side_bindings[2];
+	for (idx_t i = 0; i < 2; i++) {
+		for (auto &binding : join.children[i]->GetColumnBindings()) {
+			side_bindings[i].insert(binding);
+		}
+	}
+	idx_t side;
+	if (aggregate_columns.empty()) {
+		// only COUNT(*): reduce the larger side
+		auto left_cardinality = join.children[0]->EstimateCardinality(context);
+		auto right_cardinality = join.children[1]->EstimateCardinality(context);
+		side = left_cardinality >= right_cardinality ? 0 : 1;
+	} else {
+		side = side_bindings[0].find(aggregate_columns[0]) != side_bindings[0].end() ? 0 : 1;
+	}
+	auto &bindings = side_bindings[side];
+	for (auto &binding : aggregate_columns) {
+		if (bindings.find(binding) == bindings.end()) {
+			return false;
+		}
+	}
+
+	// the partial aggregate groups on all columns of the side that are used by the groups or by the join conditions
+	vector<ColumnBinding> referenced_columns;
+	found.clear();
+	for (auto &group : aggr.groups) {
+		GetColumnReferences(*group, referenced_columns, found);
+	}
+	for (auto &cond : join.conditions) {
+		GetColumnReferences(side == 0 ? *cond.left : *cond.right, referenced_columns, found);
+	}
+	vector<ColumnBinding> partial_groups;
+	for (auto &binding : referenced_columns) {
+		if (bindings.find(binding) != bindings.end()) {
+			partial_groups.push_back(binding);
+		}
+	}
+	if (partial_groups.empty()) {
+		return false;
+	}
+
+	// only push down the aggregate if it reduces its input by a large factor
+	auto &child = *join.children[side];
+	auto cardinality = double(child.EstimateCardinality(context));
+	double group_count = 1;
+	for (auto &binding : partial_groups) {
+		auto distinct_count = EstimateDistinctCount(child, binding);
+		if (distinct_count == 0) {
+			return false;
+		}
+		group_count *= double(distinct_count);
+	}
+	group_count = MinValue<double>(group_count, cardinality);
+	if (cardinality < group_count * MINIMUM_REDUCTION_FACTOR) {
+		return false;
+	}
+
+	// rewrite the aggregates so they combine the partial aggregates
+	auto group_index = optimizer.binder.GenerateTableIndex();
+	auto aggregate_index = optimizer.binder.GenerateTableIndex();
+	vector<unique_ptr<Expression>> combined_aggregates;
+	for (idx_t i = 0; i < aggr.expressions.size(); i++) {
+		auto &bound_aggr = aggr.expressions[i]->Cast<BoundAggregateExpression>();
+		auto combined = CombinePartialAggregate(bound_aggr, ColumnBinding(aggregate_index, i));
+		if (!combined) {
+			return false;
+		}
+		combined_aggregates.push_back(std::move(combined));
+	}
+
+	child.ResolveOperatorTypes();
+	auto child_bindings = child.GetColumnBindings();
+	vector<unique_ptr<Expression>> groups;
+	column_binding_map_t<ColumnBinding> replacement_map;
+	for (idx_t group_idx = 0; group_idx < partial_groups.size(); group_idx++) {
+		auto &binding = partial_groups[group_idx];
+		idx_t column_idx;
+		for (column_idx = 0; column_idx < child_bindings.size(); column_idx++) {
+			if (child_bindings[column_idx] == binding) {
+				break;
+			}
+		}
+		D_ASSERT(column_idx < child_bindings.size());
+		groups.push_back(make_uniq<BoundColumnRefExpression>(child.types[column_idx], binding));
+		replacement_map[binding] = ColumnBinding(group_index, group_idx);
+	}
+
+	// the groups and the join conditions now read the groups of the partial aggregate
+	for (auto &group : aggr.groups) {
+		ReplaceColumnReferences(group, replacement_map);
+	}
+	for (auto &cond : join.conditions) {
+		ReplaceColumnReferences(side == 0 ? cond.left : cond.right, replacement_map);
+	}
+	auto partial_aggr = make_uniq<LogicalAggregate>(group_index, aggregate_index, std::move(aggr.expressions));
+	partial_aggr->groups = std::move(groups);
+	partial_aggr->children.push_back(std::move(join.children[side]));
+	partial_aggr->estimated_cardinality = idx_t(group_count);
+	partial_aggr->has_estimated_cardinality = true;
+	partial_aggr->ResolveOperatorTypes();
+	join.children[side] = std::move(partial_aggr);
+	aggr.expressions = std::move(combined_aggregates);
+	if (join.estimated_props) {
+		// the join now produces fewer tuples than the subplan it was planned for
+		join.estimated_props->SetFeedbackKey(nullptr);
+	}
+	return true;
+}
+
+unique_ptr<Expression> AggregatePushdown::CombinePartialAggregate(BoundAggregateExpression &aggr,
+                                                                  ColumnBinding partial_binding) {
+	auto &name = aggr.function.name;
+	vector<unique_ptr<Expression>> children;
+	children.push_back(make_uniq<BoundColumnRefExpression>(aggr.return_type, partial_binding));
+	if (name == "min" || name == "max") {
+		// the minimum (maximum) of the partial minima (maxima)
+		return make_uniq<BoundAggregateExpression>(aggr.function, std::move(children), nullptr,
+		                                           aggr.bind_info ? aggr.bind_info->Copy() : nullptr,
+		                                           AggregateType::NON_DISTINCT);
+	}
+	// the sum of the partial sums, or the sum of the partial counts
+	auto &context = optimizer.context;
+	QueryErrorContext error_context(nullptr, 0);
+	auto &func = Catalog::GetSystemCatalog(context).GetEntry<AggregateFunctionCatalogEntry>(
+	    context, DEFAULT_SCHEMA, name == "sum" ? "sum" : "sum_counts", error_context);
+	string error;
+	FunctionBinder function_binder(context);
+	auto best_function = function_binder.BindFunction(func.name, func.functions, children, error);
+	if (best_function == DConstants::INVALID_INDEX) {
+		return nullptr;
+	}
+	auto result =
+	    function_binder.BindAggregateFunction(func.functions.GetFunctionByOffset(best_function), std::move(children));
+	if (result->return_type != aggr.return_type) {
+		return nullptr;
+	}
+	return std::move(result);
+}
+
+idx_t AggregatePushdown::EstimateDistinctCount(LogicalOperator &op, const ColumnBinding &binding) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_GET: {
+		auto &get = op.Cast<LogicalGet>();
+		if (get.table_index != binding.table_index || binding.column_index >= get.column_ids.size()) {
+			return 0;
+		}
+		auto column_id = get.column_ids[binding.column_index];
+		if (IsRowIdColumnId(column_id)) {
+			return 0;
+		}
+		unique_ptr<BaseStatistics> stats;
+		if (get.file_statistics) {
+			stats = get.GetFileStatistics(column_id);
+		} else if (get.function.statistics) {
+			stats = get.function.statistics(optimizer.context, get.bind_data.get(), column_id);
+		}
+		return stats ? stats->GetDistinctCount() : 0;
+	}
+	case LogicalOperatorType::LOGICAL_PROJECTION: {
+		auto &proj = op.Cast<LogicalProjection>();
+		if (proj.table_index != binding.table_index) {
+			return 0;
+		}
+		// follow plain column references through the projection
+		auto &expr = *proj.expressions[binding.column_index];
+		if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+			return 0;
+		}
+		return EstimateDistinctCount(*op.children[0], expr.Cast<BoundColumnRefExpression>().binding);
+	}
+	default:
+		break;
+	}
+	// other operators pass the column on from one of their children
+	for (auto &child : op.children) {
+		auto distinct_count = EstimateDistinctCount(*child, binding);
+		if (distinct_count > 0) {
+			return distinct_count;
+		}
+	}
+	return 0;
+}
+
+} // namespace duckdb
@@ -1,6 +1,7 @@
 #include "duckdb/function/table/table_scan.hpp"
 #include "duckdb/optimizer/join_order/join_node.hpp"
 #include "duckdb/optimizer/join_order/join_order_optimizer.hpp"
+#include "duckdb/common/string_util.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
@@ -8,6 +9,7 @@
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 namespace duckdb {
@@ -188,6 +190,10 @@ void FindSubgraphMatchAndMerge(Subgraph2Denominator &merge_to, idx_t find_me,
 }
 
 double CardinalityEstimator::EstimateCardinalityWithSet(JoinRelationSet &new_set) {
+	double observed_cardinality;
+	if (TryGetObservedCardinality(new_set, observed_cardinality)) {
+		return observed_cardinality;
+	}
 	double numerator = 1;
 	unordered_set<idx_t> actual_set;
 	for (idx_t i = 0; i < new_set.count; i++) {
@@ -389,6 +395,10 @@ void CardinalityEstimator::InitCardinalityEstimatorProps(vector<NodeOp> &node_op
 		}
 		// Total domains can be affected by filters. So we update base table cardinality first
 		EstimateBaseTableCardinality(join_node, op);
+		double observed_cardinality;
+		if (TryGetObservedCardinality(join_node.set, observed_cardinality)) {
+			join_node.SetEstimatedCardinality(observed_cardinality);
+		}
 		// Then update total domains.
 		UpdateTotalDomains(join_node, op);
 	}
@@ -397,6 +407,55 @@ void CardinalityEstimator::InitCardinalityEstimatorProps(vector<NodeOp> &node_op
 	std::sort(relations_to_tdoms.begin(), relations_to_tdoms.end(), SortTdoms);
 }
 
+void CardinalityEstimator::InitFeedbackSignatures(vector<NodeOp> &node_ops, vector<unique_ptr<Expression>> &filters,
+                                                  vector<unique_ptr<FilterInfo>> &filter_infos) {
+	use_feedback = CardinalityFeedback::IsEnabled(context);
+	if (!use_feedback) {
+		return;
+	}
+	for (auto &node_op : node_ops) {
+		relation_signatures.push_back(CardinalityFeedback::GetRelationSignature(context, node_op.op));
+	}
+	for (auto &filter_info : filter_infos) {
+		if (filter_info->set.count == 0) {
+			continue;
+		}
+		filter_signatures.emplace_back(filter_info->set, filters[filter_info->filter_index]->ToString());
+	}
+}
+
+shared_ptr<CardinalityFeedbackKey> CardinalityEstimator::GetFeedbackKey(JoinRelationSet &set) {
+	if (!use_feedback) {
+		return nullptr;
+	}
+	// the key consists of the sorted signatures of the relations and of all filters over them
+	vector<string> relations;
+	for (idx_t i = 0; i < set.count; i++) {
+		relations.push_back(relation_signatures[set.relations[i]]);
+	}
+	std::sort(relations.begin(), relations.end());
+	vector<string> filters;
+	for (auto &entry : filter_signatures) {
+		if (JoinRelationSet::IsSubset(set, entry.first.get())) {
+			filters.push_back(entry.second);
+		}
+	}
+	std::sort(filters.begin(), filters.end());
+	auto subplan = StringUtil::Join(relations, "; ");
+	if (!filters.empty()) {
+		subplan += " WHERE " + StringUtil::Join(filters, " AND ");
+	}
+	return make_shared<CardinalityFeedbackKey>(std::move(subplan));
+}
+
+bool CardinalityEstimator::TryGetObservedCardinality(JoinRelationSet &set, double &result) {
+	if (!use_feedback) {
+		return false;
+	}
+	auto key = GetFeedbackKey(set);
+	return CardinalityFeedback::Get(context).TryGetCardinality(*key, result);
+}
+
 void CardinalityEstimator::UpdateTotalDomains(JoinNode &node, LogicalOperator &op) {
 	auto relation_id = node.set.relations[0];
 	relation_attributes[relation_id].cardinality = node.GetCardinality<double>();
@@ -432,9 +491,12 @@ void CardinalityEstimator::UpdateTotalDomains(JoinNode &node, LogicalOperator &o
 			}
 		}
 
-		if (catalog_table && actual_binding != relation_column_to_original_column.end()) {
+		// files that have been analyzed have HLL stats as well
+		bool has_hll_stats = catalog_table || (get && get->file_statistics);
+		if (has_hll_stats && actual_binding != relation_column_to_original_column.end()) {
 			// Get HLL stats here
-			auto base_stats = catalog_table->GetStatistics(context, actual_binding->second.column_index);
+			auto base_stats = catalog_table ? catalog_table->GetStatistics(context, actual_binding->second.column_index)
+			                                : get->GetFileStatistics(actual_binding->second.column_index);
 			if (base_stats) {
 				distinct_count = base_stats->GetDistinctCount();
 			}
@@ -452,7 +514,7 @@ void CardinalityEstimator::UpdateTotalDomains(JoinNode &node, LogicalOperator &o
 			if (i_set.count(key) != 1) {
 				continue;
 			}
-			if (catalog_table) {
+			if (has_hll_stats) {
 				if (relation_to_tdom.tdom_hll < distinct_count) {
 					relation_to_tdom.tdom_hll = distinct_count;
 					relation_to_tdom.has_tdom_hll = true;
@@ -547,6 +609,8 @@ idx_t CardinalityEstimator::InspectTableFilters(idx_t cardinality, LogicalOperat
 		if (get->bind_data && get->function.name.compare("seq_scan") == 0) {
 			auto &table_scan_bind_data = get->bind_data->Cast<TableScanBindData>();
 			column_statistics = get->function.statistics(context, &table_scan_bind_data, it.first);
+		} else if (get->file_statistics) {
+			column_statistics = get->GetFileStatistics(it.first);
 		}
 		if (it.second->filter_type == TableFilterType::CONJUNCTION_AND) {
 			auto &filter = (ConjunctionAndFilter &)*it.second;
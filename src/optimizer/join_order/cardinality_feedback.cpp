@@ -0,0 +1,139 @@
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
+
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+CardinalityFeedbackKey::CardinalityFeedbackKey(string subplan_p)
+    : subplan(std::move(subplan_p)), hash(Hash(subplan.c_str())) {
+}
+
+CardinalityFeedback::CardinalityFeedback() {
+}
+
+CardinalityFeedback &CardinalityFeedback::Get(ClientContext &context) {
+	return DatabaseInstance::GetDatabase(context).GetCardinalityFeedback();
+}
+
+bool CardinalityFeedback::IsEnabled(ClientContext &context) {
+	return DBConfig::GetConfig(context).options.cardinality_feedback_size > 0;
+}
+
+string CardinalityFeedback::GetRelationSignature(ClientContext &context, LogicalOperator &op) {
+	if (op.type == LogicalOperatorType::LOGICAL_GET) {
+		auto &get = op.Cast<LogicalGet>();
+		string result = get.function.name;
+		if (get.function.to_string) {
+			result += " " + get.function.to_string(get.bind_data.get());
+		}
+		for (auto &parameter : get.parameters) {
+			result += " " + parameter.ToString();
+		}
+		vector<string> filters;
+		for (auto &entry : get.table_filters.filters) {
+			auto column_id = entry.first;
+			filters.push_back(entry.second->ToString(column_id < get.names.size() ? get.names[column_id]
+			                                                                       : to_string(column_id)));
+		}
+		std::sort(filters.begin(), filters.end());
+		if (!filters.empty()) {
+			result += " WHERE " + StringUtil::Join(filters, " AND ");
+		}
+		// the cardinality of the scan is part of its signature: when the scanned data changes the entry is not used
+		result += StringUtil::Format(" (%llu rows)", get.EstimateCardinality(context));
+		return result;
+	}
+	string result = op.GetName();
+	auto params = StringUtil::Replace(op.ParamsToString(), "\n", " ");
+	StringUtil::Trim(params);
+	if (!params.empty()) {
+		result += " [" + params + "]";
+	}
+	if (!op.children.empty()) {
+		vector<string> children;
+		for (auto &child : op.children) {
+			children.push_back(GetRelationSignature(context, *child));
+		}
+		result += "(" + StringUtil::Join(children, ", ") + ")";
+	}
+	return result;
+}
+
+bool CardinalityFeedback::TryGetCardinality(const CardinalityFeedbackKey &key, double &result) {
+	lock_guard<mutex> guard(lock);
+	auto entry = entry_map.find(key.hash);
+	if (entry == entry_map.end() || entry->second->subplan != key.subplan) {
+		return false;
+	}
+	// move the entry to the front of the LRU list
+	entries.splice(entries.begin(), entries, entry->second);
+	hits++;
+	result = double(entries.front().actual_cardinality);
+	return true;
+}
+
+void CardinalityFeedback::Record(ClientContext &context, const CardinalityFeedbackKey &key,
+                                 idx_t estimated_cardinality, idx_t actual_cardinality) {
+	auto capacity = DBConfig::GetConfig(context).options.cardinality_feedback_size;
+	if (capacity == 0) {
+		return;
+	}
+	lock_guard<mutex> guard(lock);
+	auto entry = entry_map.find(key.hash);
+	if (entry != entry_map.end()) {
+		if (entry->second->subplan == key.subplan) {
+			auto &feedback = *entry->second;
+			feedback.estimated_cardinality = estimated_cardinality;
+			feedback.actual_cardinality = actual_cardinality;
+			feedback.observations++;
+			entries.splice(entries.begin(), entries, entry->second);
+			return;
+		}
+		// a different subplan with the same hash: replace it
+		entries.erase(entry->second);
+		entry_map.erase(entry);
+	}
+	EvictInternal(capacity - 1);
+
+	CardinalityFeedbackEntry new_entry;
+	new_entry.hash = key.hash;
+	new_entry.subplan = key.subplan;
+	new_entry.estimated_cardinality = estimated_cardinality;
+	new_entry.actual_cardinality = actual_cardinality;
+	new_entry.observations = 1;
+	entries.push_front(std::move(new_entry));
+	entry_map[key.hash] = entries.begin();
+}
+
+void CardinalityFeedback::Evict(idx_t capacity) {
+	lock_guard<mutex> guard(lock);
+	EvictInternal(capacity);
+}
+
+void CardinalityFeedback::EvictInternal(idx_t capacity) {
+	while (entries.size() > capacity) {
+		entry_map.erase(entries.back().hash);
+		entries.pop_back();
+		evictions++;
+	}
+}
+
+void CardinalityFeedback::Clear() {
+	lock_guard<mutex> guard(lock);
+	entries.clear();
+	entry_map.clear();
+}
+
+vector<CardinalityFeedbackEntry> CardinalityFeedback::GetEntries() {
+	lock_guard<mutex> guard(lock);
+	return vector<CardinalityFeedbackEntry>(entries.begin(), entries.end());
+}
+
+} // namespace duckdb
@@ -19,6 +19,7 @@ JoinNode::JoinNode(JoinRelationSet &set, optional_ptr<NeighborInfo> info, JoinNo
 
 unique_ptr<EstimatedProperties> EstimatedProperties::Copy() {
 	auto result = make_uniq<EstimatedProperties>(cardinality, cost);
+	result->feedback_key = feedback_key;
 	return result;
 }
 
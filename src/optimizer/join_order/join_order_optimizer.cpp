@@ -878,6 +878,14 @@ GenerateJoinRelation JoinOrderOptimizer::GenerateJoins(vector<unique_ptr<Logical
 			}
 		}
 	}
+	// the output of the operator is the subplan of the relation set: record its actual cardinality under that key
+	auto feedback_key = cardinality_estimator.GetFeedbackKey(*result_relation);
+	if (feedback_key) {
+		if (!result_operator->estimated_props) {
+			result_operator->estimated_props = node.estimated_props->Copy();
+		}
+		result_operator->estimated_props->SetFeedbackKey(std::move(feedback_key));
+	}
 	return GenerateJoinRelation(*result_relation, std::move(result_operator));
 }
 
@@ -1026,6 +1034,7 @@ unique_ptr<LogicalOperator> JoinOrderOptimizer::Optimize(unique_ptr<LogicalOpera
 		nodes_ops.emplace_back(make_uniq<JoinNode>(node, 0), rel.op);
 	}
 
+	cardinality_estimator.InitFeedbackSignatures(nodes_ops, filters, filter_infos);
 	cardinality_estimator.InitCardinalityEstimatorProps(nodes_ops, filter_infos);
 
 	for (auto &node_op : nodes_ops) {
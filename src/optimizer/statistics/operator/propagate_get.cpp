@@ -3,6 +3,7 @@
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/statistics/file_statistics_catalog.hpp"
 
 namespace duckdb {
 
@@ -32,15 +33,24 @@ void StatisticsPropagator::UpdateFilterStatistics(BaseStatistics &input, TableFi
 
 unique_ptr<NodeStatistics> StatisticsPropagator::PropagateStatistics(LogicalGet &get,
                                                                      unique_ptr<LogicalOperator> *node_ptr) {
-	if (get.function.cardinality) {
+	if (get.file_statistics) {
+		// the files have been analyzed: the amount of rows is known exactly
+		node_stats = make_uniq<NodeStatistics>(get.file_statistics->row_count, get.file_statistics->row_count);
+	} else if (get.function.cardinality) {
 		node_stats = get.function.cardinality(context, get.bind_data.get());
 	}
-	if (!get.function.statistics) {
+	if (!get.function.statistics && !get.file_statistics) {
 		// no column statistics to get
 		return std::move(node_stats);
 	}
 	for (idx_t i = 0; i < get.column_ids.size(); i++) {
-		auto stats = get.function.statistics(context, get.bind_data.get(), get.column_ids[i]);
+		unique_ptr<BaseStatistics> stats;
+		if (get.function.statistics) {
+			stats = get.function.statistics(context, get.bind_data.get(), get.column_ids[i]);
+		}
+		if (!stats) {
+			stats = get.GetFileStatistics(get.column_ids[i]);
+		}
 		if (stats) {
 			ColumnBinding binding(get.table_index, i);
 			statistics_map.insert(make_pair(binding, std::move(stats)));
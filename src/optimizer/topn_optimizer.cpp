@@ -1,6 +1,13 @@
 #include "duckdb/optimizer/topn_optimizer.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_order.hpp"
 #include "duckdb/planner/operator/logical_limit.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
 #include "duckdb/common/limits.hpp"
 
@@ -17,6 +24,7 @@ unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 		if (limit.limit_val != NumericLimits<int64_t>::Maximum() || limit.offset) {
 			auto topn = make_uniq<LogicalTopN>(std::move(order_by.orders), limit.limit_val, limit.offset_val);
 			topn->AddChild(std::move(order_by.children[0]));
+			PushdownDynamicFilter(*topn);
 			op = std::move(topn);
 		}
 	} else {
@@ -27,4 +35,127 @@ unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 	return op;
 }
 
+static bool SupportsDynamicFilter(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::HUGEINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::VARCHAR:
+		return true;
+	default:
+		// floating point values are excluded because of the ordering of NaN
+		return false;
+	}
+}
+
+//! Find the scan that produces the column, following plain column references through projections and filters
+static optional_ptr<LogicalGet> FindScan(LogicalOperator &op, ColumnBinding &binding) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_PROJECTION: {
+		auto &proj = op.Cast<LogicalProjection>();
+		if (proj.table_index != binding.table_index) {
+			return nullptr;
+		}
+		auto &expr = *proj.expressions[binding.column_index];
+		if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+			return nullptr;
+		}
+		binding = expr.Cast<BoundColumnRefExpression>().binding;
+		return FindScan(*op.children[0], binding);
+	}
+	case LogicalOperatorType::LOGICAL_FILTER:
+		return FindScan(*op.children[0], binding);
+	case LogicalOperatorType::LOGICAL_GET: {
+		auto &get = op.Cast<LogicalGet>();
+		if (get.table_index != binding.table_index || !get.children.empty()) {
+			return nullptr;
+		}
+		return &get;
+	}
+	default:
+		return nullptr;
+	}
+}
+
+//! Find the column of an order, looking through the compression of integral keys into CAST((column - min) AS type)
+static optional_ptr<BoundColumnRefExpression> GetOrderColumn(Expression &expr, Value &offset) {
+	if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
+		return &expr.Cast<BoundColumnRefExpression>();
+	}
+	if (expr.type != ExpressionType::OPERATOR_CAST) {
+		return nullptr;
+	}
+	auto &cast = expr.Cast<BoundCastExpression>();
+	if (cast.try_cast || cast.child->expression_class != ExpressionClass::BOUND_FUNCTION) {
+		return nullptr;
+	}
+	auto &minus = cast.child->Cast<BoundFunctionExpression>();
+	if (minus.function.name != "-" || minus.children.size() != 2 ||
+	    minus.children[0]->type != ExpressionType::BOUND_COLUMN_REF ||
+	    minus.children[1]->type != ExpressionType::VALUE_CONSTANT || !minus.return_type.IsIntegral()) {
+		return nullptr;
+	}
+	offset = minus.children[1]->Cast<BoundConstantExpression>().value;
+	if (offset.IsNull() || offset.type() != minus.return_type) {
+		return nullptr;
+	}
+	return &minus.children[0]->Cast<BoundColumnRefExpression>();
+}
+
+void TopN::PushdownDynamicFilter(LogicalTopN &op) {
+	auto &order = op.orders[0];
+	// the filter removes NULL values: these have to be sorted last
+	if (order.null_order != OrderByNullType::NULLS_LAST) {
+		return;
+	}
+	Value offset;
+	auto colref = GetOrderColumn(*order.expression, offset);
+	if (!colref || !SupportsDynamicFilter(colref->return_type)) {
+		return;
+	}
+	auto binding = colref->binding;
+	auto get = FindScan(*op.children[0], binding);
+	if (!get || !get->function.dynamic_filter_pushdown) {
+		return;
+	}
+	auto column_id = get->column_ids[binding.column_index];
+	if (IsRowIdColumnId(column_id) || get->returned_types[column_id] != colref->return_type) {
+		return;
+	}
+	// with a single order, ties with the boundary cannot improve the top-n either
+	bool single_order = op.orders.size() == 1;
+	ExpressionType comparison_type;
+	if (order.type == OrderType::ASCENDING) {
+		comparison_type = single_order ? ExpressionType::COMPARE_LESSTHAN : ExpressionType::COMPARE_LESSTHANOREQUALTO;
+	} else {
+		comparison_type =
+		    single_order ? ExpressionType::COMPARE_GREATERTHAN : ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+	}
+	op.dynamic_filter = make_shared<DynamicFilterData>(comparison_type);
+	op.dynamic_filter->offset = std::move(offset);
+	get->table_filters.PushFilter(column_id, make_uniq<DynamicFilter>(op.dynamic_filter));
+	// the scan and the operators above it now produce fewer tuples than the subplans they were planned for
+	for (auto node = op.children[0].get();; node = node->children[0].get()) {
+		if (node->estimated_props) {
+			node->estimated_props->SetFeedbackKey(nullptr);
+		}
+		if (node == get.get()) {
+			break;
+		}
+	}
+}
+
 } // namespace duckdb
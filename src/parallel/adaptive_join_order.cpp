@@ -0,0 +1,179 @@
+#include "duckdb/parallel/adaptive_join_order.hpp"
+
+#include "duckdb/execution/operator/join/physical_hash_join.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+struct ChainedJoin {
+	explicit ChainedJoin(PhysicalHashJoin &join) : join(join) {
+	}
+
+	PhysicalHashJoin &join;
+	//! The observed and the estimated cardinality of the build side
+	idx_t build_cardinality = 0;
+	idx_t estimated_build_cardinality = 0;
+	//! The fraction of the probed tuples that the join outputs, corrected with the observed build cardinality
+	double selectivity = 0;
+};
+
+static bool ReferencesOnlyColumns(const Expression &expr, idx_t column_count) {
+	if (expr.type == ExpressionType::BOUND_REF) {
+		return expr.Cast<BoundReferenceExpression>().index < column_count;
+	}
+	bool result = true;
+	ExpressionIterator::EnumerateChildren(expr, [&](const Expression &child) {
+		if (!ReferencesOnlyColumns(child, column_count)) {
+			result = false;
+		}
+	});
+	return result;
+}
+
+//! Whether or not the operator can be probed anywhere in a chain whose input has the given amount of columns
+static bool CanChain(PhysicalOperator &op, idx_t input_count, idx_t chain_input_count) {
+	if (op.type != PhysicalOperatorType::HASH_JOIN) {
+		return false;
+	}
+	auto &join = op.Cast<PhysicalHashJoin>();
+	if (join.join_type != JoinType::INNER || join.children[0]->GetTypes().size() != input_count ||
+	    join.GetTypes().size() != input_count + join.build_types.size()) {
+		return false;
+	}
+	if (join.GetBuildCardinality() == DConstants::INVALID_INDEX) {
+		return false;
+	}
+	for (auto &condition : join.conditions) {
+		if (!ReferencesOnlyColumns(*condition.left, chain_input_count)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//! Re-plans the chain of joins, returns the order in which the joins are probed (or nothing if the order is kept)
+static vector<idx_t> ReorderChain(vector<ChainedJoin> &chain, double threshold) {
+	bool misestimated = false;
+	for (auto &entry : chain) {
+		auto &join = entry.join;
+		entry.build_cardinality = join.GetBuildCardinality();
+		entry.estimated_build_cardinality = join.children[1]->estimated_cardinality;
+		auto observed = double(MaxValue<idx_t>(entry.build_cardinality, 1));
+		auto estimated = double(MaxValue<idx_t>(entry.estimated_build_cardinality, 1));
+		if (observed > estimated * threshold || estimated > observed * threshold) {
+			misestimated = true;
+		}
+		// the output of a join grows linearly with its build side: correct the estimated selectivity accordingly
+		auto estimated_selectivity =
+		    double(join.estimated_cardinality) / double(MaxValue<idx_t>(join.children[0]->estimated_cardinality, 1));
+		entry.selectivity = estimated_selectivity * double(entry.build_cardinality) / estimated;
+	}
+	vector<idx_t> order;
+	if (!misestimated) {
+		return order;
+	}
+	for (idx_t i = 0; i < chain.size(); i++) {
+		order.push_back(i);
+	}
+	std::stable_sort(order.begin(), order.end(),
+	                 [&](idx_t a, idx_t b) { return chain[a].selectivity < chain[b].selectivity; });
+	for (idx_t i = 0; i < order.size(); i++) {
+		if (order[i] != i) {
+			return order;
+		}
+	}
+	// the optimizer picked the right order after all
+	order.clear();
+	return order;
+}
+
+unique_ptr<AdaptiveJoinOrder> AdaptiveJoinOrder::TryReorder(ClientContext &context, const PhysicalOperator &source,
+                                                            const vector<reference<PhysicalOperator>> &operators) {
+	auto threshold = ClientConfig::GetConfig(context).adaptive_join_threshold;
+	if (threshold <= 0 || operators.size() < 2) {
+		return nullptr;
+	}
+	auto result = make_uniq<AdaptiveJoinOrder>();
+	result->column_maps.resize(operators.size());
+	bool replanned = false;
+	idx_t op_idx = 0;
+	while (op_idx < operators.size()) {
+		auto &input_types = op_idx == 0 ? source.GetTypes() : operators[op_idx - 1].get().GetTypes();
+		// find the longest chain of joins starting at this operator that probe the input of the chain only
+		auto chain_input_count = input_types.size();
+		auto input_count = chain_input_count;
+		vector<ChainedJoin> chain;
+		while (op_idx + chain.size() < operators.size()) {
+			auto &op = operators[op_idx + chain.size()].get();
+			if (!CanChain(op, input_count, chain_input_count)) {
+				break;
+			}
+			auto &join = op.Cast<PhysicalHashJoin>();
+			chain.emplace_back(join);
+			input_count += join.build_types.size();
+		}
+		if (chain.size() < 2) {
+			// no chain: keep the operator as-is
+			auto &op = operators[op_idx].get();
+			result->operators.push_back(op);
+			result->output_types.push_back(op.GetTypes());
+			result->runtime_info.emplace_back();
+			op_idx++;
+			continue;
+		}
+		auto order = ReorderChain(chain, threshold);
+		if (order.empty()) {
+			for (auto &entry : chain) {
+				result->operators.push_back(entry.join);
+				result->output_types.push_back(entry.join.GetTypes());
+				result->runtime_info.emplace_back();
+			}
+			op_idx += chain.size();
+			continue;
+		}
+		replanned = true;
+		// the re-ordered joins append their build columns in the order in which they are probed
+		auto types = input_types;
+		vector<idx_t> build_offsets(chain.size());
+		for (idx_t i = 0; i < order.size(); i++) {
+			auto &entry = chain[order[i]];
+			build_offsets[order[i]] = types.size();
+			types.insert(types.end(), entry.join.build_types.begin(), entry.join.build_types.end());
+			result->operators.push_back(entry.join);
+			result->output_types.push_back(types);
+			result->runtime_info.push_back(StringUtil::Format(
+			    "Build: %llu (EC: %llu)\nProbe: %llu of %llu (planned %llu)", entry.build_cardinality,
+			    entry.estimated_build_cardinality, i + 1, chain.size(), order[i] + 1));
+		}
+		// the remainder of the pipeline expects the build columns in the original order
+		auto &column_map = result->column_maps[op_idx + chain.size() - 1];
+		for (idx_t col_idx = 0; col_idx < chain_input_count; col_idx++) {
+			column_map.push_back(col_idx);
+		}
+		for (idx_t i = 0; i < chain.size(); i++) {
+			for (idx_t col_idx = 0; col_idx < chain[i].join.build_types.size(); col_idx++) {
+				column_map.push_back(build_offsets[i] + col_idx);
+			}
+		}
+		op_idx += chain.size();
+	}
+	if (!replanned) {
+		return nullptr;
+	}
+	return result;
+}
+
+void AdaptiveJoinOrder::RestoreColumnOrder(idx_t operator_idx, DataChunk &reordered, DataChunk &result) const {
+	auto &column_map = column_maps[operator_idx];
+	D_ASSERT(column_map.size() == result.ColumnCount());
+	for (idx_t col_idx = 0; col_idx < column_map.size(); col_idx++) {
+		result.data[col_idx].Reference(reordered.data[column_map[col_idx]]);
+	}
+	result.SetCardinality(reordered.size());
+}
+
+} // namespace duckdb
@@ -0,0 +1,75 @@
+#include "duckdb/parallel/adaptive_parallelism.hpp"
+
+#include "duckdb/common/chrono.hpp"
+
+#include <time.h>
+
+namespace duckdb {
+
+AdaptiveParallelismController::AdaptiveParallelismController(idx_t initial_tasks, idx_t max_tasks)
+    : launched_tasks(initial_tasks), max_tasks(max_tasks), saturated(false), window_start(WallTime()),
+      window_rows(0), window_wall_time(0), window_cpu_time(0), previous_throughput(0), skip_window(false) {
+}
+
+bool AdaptiveParallelismController::ReportProgress(idx_t rows, uint64_t wall_time, uint64_t cpu_time) {
+	lock_guard<mutex> guard(lock);
+	if (saturated || launched_tasks >= max_tasks) {
+		return false;
+	}
+	window_rows += rows;
+	window_wall_time += wall_time;
+	window_cpu_time += cpu_time;
+	auto now = WallTime();
+	if (now < window_start + WINDOW_MICROS) {
+		// keep on measuring
+		return false;
+	}
+	auto throughput = double(window_rows) * 1000000.0 / double(now - window_start);
+	auto cpu_bound = double(window_cpu_time) >= CPU_BOUND_RATIO * double(window_wall_time);
+	auto measured = !skip_window;
+	window_start = now;
+	window_rows = 0;
+	window_wall_time = 0;
+	window_cpu_time = 0;
+	skip_window = false;
+	if (!measured) {
+		// the previous window overlapped with the start-up of the last launched task
+		return false;
+	}
+	if (!cpu_bound && previous_throughput > 0 && throughput < previous_throughput * (1 + MIN_SPEEDUP)) {
+		// the pipeline is waiting on I/O and the last task did not improve the throughput: the devices are saturated
+		saturated = true;
+		return false;
+	}
+	previous_throughput = throughput;
+	launched_tasks++;
+	skip_window = true;
+	return true;
+}
+
+idx_t AdaptiveParallelismController::LaunchedTasks() {
+	lock_guard<mutex> guard(lock);
+	return launched_tasks;
+}
+
+bool AdaptiveParallelismController::IsSaturated() {
+	lock_guard<mutex> guard(lock);
+	return saturated;
+}
+
+uint64_t AdaptiveParallelismController::WallTime() {
+	return duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+uint64_t AdaptiveParallelismController::ThreadCPUTime() {
+#ifdef CLOCK_THREAD_CPUTIME_ID
+	struct timespec ts;
+	if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0) {
+		return uint64_t(ts.tv_sec) * 1000000 + uint64_t(ts.tv_nsec) / 1000;
+	}
+#endif
+	// the CPU time is not available: every pipeline is treated as CPU-bound
+	return WallTime();
+}
+
+} // namespace duckdb
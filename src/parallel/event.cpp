@@ -1,6 +1,7 @@
 #include "duckdb/parallel/event.hpp"
 #include "duckdb/common/assert.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/trace_recorder.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/execution/executor.hpp"
 
@@ -28,6 +29,14 @@ void Event::Finish() {
 	D_ASSERT(!finished);
 	FinishEvent();
 	finished = true;
+	auto &recorder = TraceRecorder::Get(executor.context);
+	if (recorder.IsEnabled()) {
+		if (trace_start_time > 0) {
+			recorder.Record("event", TraceName(), trace_start_time, recorder.Now());
+		} else {
+			recorder.RecordInstant("event", TraceName());
+		}
+	}
 	// finished processing the pipeline, now we can schedule pipelines that depend on this pipeline
 	for (auto &parent_entry : parents) {
 		auto parent = parent_entry.lock();
@@ -55,8 +64,9 @@ const vector<Event *> &Event::GetParentsVerification() const {
 
 void Event::FinishTask() {
 	D_ASSERT(finished_tasks.load() < total_tasks.load());
-	idx_t current_tasks = total_tasks;
+	// tasks can be added while the event runs (see AddTask): read the total after counting this task as finished
 	idx_t current_finished = ++finished_tasks;
+	idx_t current_tasks = total_tasks;
 	D_ASSERT(current_finished <= current_tasks);
 	if (current_finished == current_tasks) {
 		Finish();
@@ -77,9 +87,21 @@ void Event::SetTasks(vector<unique_ptr<Task>> tasks) {
 	D_ASSERT(total_tasks == 0);
 	D_ASSERT(!tasks.empty());
 	this->total_tasks = tasks.size();
+	auto &recorder = TraceRecorder::Get(executor.context);
+	if (recorder.IsEnabled()) {
+		trace_start_time = recorder.Now();
+	}
 	for (auto &task : tasks) {
 		ts.ScheduleTask(executor.GetToken(), std::move(task));
 	}
 }
 
+void Event::AddTask(unique_ptr<Task> task) {
+	D_ASSERT(total_tasks > 0);
+	D_ASSERT(!finished);
+	auto &ts = TaskScheduler::GetScheduler(executor.context);
+	total_tasks++;
+	ts.ScheduleTask(executor.GetToken(), std::move(task));
+}
+
 } // namespace duckdb
@@ -1,6 +1,7 @@
 #include "duckdb/execution/executor.hpp"
 
 #include "duckdb/execution/execution_context.hpp"
+#include "duckdb/execution/operator/helper/physical_buffered_collector.hpp"
 #include "duckdb/execution/operator/helper/physical_result_collector.hpp"
 #include "duckdb/execution/operator/set/physical_recursive_cte.hpp"
 #include "duckdb/execution/physical_operator.hpp"
@@ -306,7 +307,8 @@ void Executor::InitializeInternal(PhysicalOperator &plan) {
 
 		this->profiler = ClientData::Get(context).profiler;
 		profiler->Initialize(plan);
-		this->producer = scheduler.CreateProducer();
+		auto &client_config = ClientConfig::GetConfig(context);
+		this->producer = scheduler.CreateProducer(client_config.query_priority, client_config.query_max_threads);
 
 		// build and ready the pipelines
 		PipelineBuildState state;
@@ -359,6 +361,8 @@ void Executor::CancelTasks() {
 		}
 		pipelines.clear();
 		root_pipelines.clear();
+		to_be_rescheduled_tasks.clear();
+		woken_up_tasks.clear();
 		events.clear();
 	}
 	WorkOnTasks();
@@ -375,18 +379,87 @@ void Executor::CancelTasks() {
 void Executor::WorkOnTasks() {
 	auto &scheduler = TaskScheduler::GetScheduler(context);
 
-	unique_ptr<Task> task;
+	shared_ptr<Task> task;
 	while (scheduler.GetTaskFromProducer(*producer, task)) {
-		task->Execute(TaskExecutionMode::PROCESS_ALL);
+		auto res = task->Execute(TaskExecutionMode::PROCESS_ALL);
+		if (res == TaskExecutionResult::TASK_BLOCKED) {
+			task->Deschedule();
+		}
 		task.reset();
 	}
 }
 
+void Executor::AddToBeRescheduled(shared_ptr<Task> &task_p) {
+	lock_guard<mutex> l(executor_lock);
+	if (cancelled) {
+		return;
+	}
+	auto entry = woken_up_tasks.find(task_p.get());
+	if (entry != woken_up_tasks.end()) {
+		// the callback was already made: the task can continue right away
+		woken_up_tasks.erase(entry);
+		TaskScheduler::GetScheduler(context).ScheduleTask(*producer, task_p);
+		return;
+	}
+	D_ASSERT(to_be_rescheduled_tasks.find(task_p.get()) == to_be_rescheduled_tasks.end());
+	to_be_rescheduled_tasks[task_p.get()] = task_p;
+}
+
+void Executor::RescheduleTask(shared_ptr<Task> &task_p) {
+	{
+		lock_guard<mutex> l(executor_lock);
+		if (cancelled) {
+			return;
+		}
+		auto entry = to_be_rescheduled_tasks.find(task_p.get());
+		if (entry == to_be_rescheduled_tasks.end()) {
+			// the task has not been parked yet: AddToBeRescheduled will schedule it again
+			woken_up_tasks.insert(task_p.get());
+			return;
+		}
+		TaskScheduler::GetScheduler(context).ScheduleTask(*producer, task_p);
+		to_be_rescheduled_tasks.erase(entry);
+	}
+	task_reschedule.notify_one();
+}
+
+void Executor::RequeueTask(shared_ptr<Task> &task_p) {
+	lock_guard<mutex> l(executor_lock);
+	if (cancelled) {
+		return;
+	}
+	TaskScheduler::GetScheduler(context).ScheduleTask(*producer, task_p);
+}
+
+bool Executor::HasBlockedTasks() {
+	lock_guard<mutex> l(executor_lock);
+	return !to_be_rescheduled_tasks.empty();
+}
+
+void Executor::WaitForTask() {
+	unique_lock<mutex> l(executor_lock);
+	if (to_be_rescheduled_tasks.empty()) {
+		return;
+	}
+	task_reschedule.wait_for(l, std::chrono::microseconds(WAIT_TIME_MICROS));
+}
+
 bool Executor::ExecutionIsFinished() {
 	return completed_pipelines >= total_pipelines || HasError();
 }
 
 PendingExecutionResult Executor::ExecuteTask() {
+	if (execution_result == PendingExecutionResult::RESULT_NOT_READY && HasStreamingResultCollector()) {
+		auto &collector = (PhysicalBufferedCollector &)*physical_plan;
+		if (collector.sink_state && collector.IsReady(*collector.sink_state)) {
+			// the client can start fetching: the remaining tasks are executed while fetching
+			return PendingExecutionResult::RESULT_READY;
+		}
+	}
+	return ExecuteTaskInternal();
+}
+
+PendingExecutionResult Executor::ExecuteTaskInternal() {
 	if (execution_result != PendingExecutionResult::RESULT_NOT_READY) {
 		return execution_result;
 	}
@@ -400,10 +473,17 @@ PendingExecutionResult Executor::ExecuteTask() {
 		if (task) {
 			// if we have a task, partially process it
 			auto result = task->Execute(TaskExecutionMode::PROCESS_PARTIAL);
-			if (result != TaskExecutionResult::TASK_NOT_FINISHED) {
+			if (result == TaskExecutionResult::TASK_BLOCKED) {
+				// the task is waiting for a resource: park it until it is rescheduled
+				task->Deschedule();
+				task.reset();
+			} else if (result != TaskExecutionResult::TASK_NOT_FINISHED) {
 				// if the task is finished, clean it up
 				task.reset();
 			}
+		} else if (HasBlockedTasks()) {
+			// there is nothing to do until one of the blocked tasks is rescheduled
+			WaitForTask();
 		}
 		if (!HasError()) {
 			// we (partially) processed a task and no exceptions were thrown
@@ -444,6 +524,8 @@ void Executor::Reset() {
 	exceptions.clear();
 	pipelines.clear();
 	events.clear();
+	to_be_rescheduled_tasks.clear();
+	woken_up_tasks.clear();
 	execution_result = PendingExecutionResult::RESULT_NOT_READY;
 }
 
@@ -531,9 +613,32 @@ unique_ptr<QueryResult> Executor::GetResult() {
 	return result_collector.GetResult(*result_collector.sink_state);
 }
 
+bool Executor::HasStreamingResultCollector() {
+	return HasResultCollector() && ((PhysicalResultCollector &)*physical_plan).IsStreaming();
+}
+
 unique_ptr<DataChunk> Executor::FetchChunk() {
 	D_ASSERT(physical_plan);
 
+	if (HasStreamingResultCollector()) {
+		// fetch the chunks from the buffer of the collector, executing tasks until one becomes available
+		auto &collector = (PhysicalBufferedCollector &)*physical_plan;
+		while (true) {
+			bool finished = false;
+			if (collector.sink_state) {
+				auto chunk = collector.FetchChunk(*collector.sink_state, finished);
+				if (chunk) {
+					return chunk;
+				}
+			}
+			if (finished) {
+				return make_uniq<DataChunk>();
+			}
+			if (ExecuteTaskInternal() == PendingExecutionResult::RESULT_READY && !collector.sink_state) {
+				return make_uniq<DataChunk>();
+			}
+		}
+	}
 	auto chunk = make_uniq<DataChunk>();
 	root_executor->InitializeChunk(*chunk);
 	while (true) {
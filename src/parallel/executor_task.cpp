@@ -1,4 +1,5 @@
 #include "duckdb/parallel/task.hpp"
+#include "duckdb/common/trace_recorder.hpp"
 #include "duckdb/execution/executor.hpp"
 
 namespace duckdb {
@@ -12,7 +13,32 @@ ExecutorTask::ExecutorTask(ClientContext &context) : ExecutorTask(Executor::Get(
 ExecutorTask::~ExecutorTask() {
 }
 
+void ExecutorTask::Deschedule() {
+	auto this_ptr = shared_from_this();
+	executor.AddToBeRescheduled(this_ptr);
+}
+
+void ExecutorTask::Reschedule() {
+	auto this_ptr = shared_from_this();
+	executor.RescheduleTask(this_ptr);
+}
+
+void ExecutorTask::Requeue() {
+	auto this_ptr = shared_from_this();
+	executor.RequeueTask(this_ptr);
+}
+
 TaskExecutionResult ExecutorTask::Execute(TaskExecutionMode mode) {
+	auto &recorder = TraceRecorder::Get(executor.context);
+	TraceThreadScope thread_scope(recorder);
+	TraceScope trace("task", "Task");
+	if (trace.IsActive()) {
+		trace.SetName(TraceName());
+		if (trace_queue_time > 0) {
+			recorder.Record("queue", "queued: " + TraceName(), trace_queue_time, recorder.Now());
+			trace_queue_time = 0;
+		}
+	}
 	try {
 		return ExecuteTask(mode);
 	} catch (Exception &ex) {
@@ -0,0 +1,53 @@
+#include "duckdb/parallel/interrupt.hpp"
+
+#include "duckdb/common/exception.hpp"
+
+namespace duckdb {
+
+InterruptState::InterruptState() : mode(InterruptMode::NO_INTERRUPTS) {
+}
+
+InterruptState::InterruptState(weak_ptr<Task> task) : mode(InterruptMode::TASK), current_task(std::move(task)) {
+}
+
+InterruptState::InterruptState(weak_ptr<InterruptDoneSignalState> signal_state_p)
+    : mode(InterruptMode::BLOCKING), signal_state(std::move(signal_state_p)) {
+}
+
+void InterruptState::Callback() const {
+	if (mode == InterruptMode::TASK) {
+		auto task = current_task.lock();
+		if (!task) {
+			// the task was cleaned up (e.g. because the query was cancelled): nothing to wake up
+			return;
+		}
+		task->Reschedule();
+	} else if (mode == InterruptMode::BLOCKING) {
+		auto signal_state_l = signal_state.lock();
+		if (!signal_state_l) {
+			return;
+		}
+		// signal the caller that is blocked on the interrupt
+		signal_state_l->Signal();
+	} else {
+		throw InternalException("Callback made on InterruptState without valid interrupt mode specified");
+	}
+}
+
+void InterruptDoneSignalState::Signal() {
+	{
+		unique_lock<mutex> lck(lock);
+		done = true;
+	}
+	cv.notify_all();
+}
+
+void InterruptDoneSignalState::Await() {
+	unique_lock<mutex> lck(lock);
+	cv.wait(lck, [&]() { return done; });
+
+	// reset so the state can be reused for the next interrupt
+	done = false;
+}
+
+} // namespace duckdb
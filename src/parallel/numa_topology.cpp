@@ -0,0 +1,99 @@
+#include "duckdb/parallel/numa_topology.hpp"
+
+#include "duckdb/common/string_util.hpp"
+
+#include <fstream>
+
+#if defined(__linux__) && !defined(DUCKDB_NO_THREADS)
+#include <sched.h>
+#define DUCKDB_NUMA_LINUX
+#endif
+
+namespace duckdb {
+
+NumaTopology::NumaTopology() {
+	node_cpus.emplace_back();
+}
+
+vector<idx_t> NumaTopology::ParseCPUList(const string &cpu_list) {
+	vector<idx_t> result;
+	for (auto &range : StringUtil::Split(cpu_list, ',')) {
+		StringUtil::Trim(range);
+		if (range.empty()) {
+			continue;
+		}
+		auto dash = range.find('-');
+		try {
+			if (dash == string::npos) {
+				result.push_back(std::stoull(range));
+				continue;
+			}
+			idx_t start = std::stoull(range.substr(0, dash));
+			idx_t end = std::stoull(range.substr(dash + 1));
+			for (idx_t cpu = start; cpu <= end; cpu++) {
+				result.push_back(cpu);
+			}
+		} catch (...) {
+			// malformed entry: ignore it
+		}
+	}
+	return result;
+}
+
+#ifdef DUCKDB_NUMA_LINUX
+static bool ReadFirstLine(const string &path, string &result) {
+	std::ifstream file(path);
+	if (!file.is_open()) {
+		return false;
+	}
+	std::getline(file, result);
+	return true;
+}
+#endif
+
+NumaTopology NumaTopology::Detect() {
+	NumaTopology topology;
+	topology.node_cpus.clear();
+#ifdef DUCKDB_NUMA_LINUX
+	const string node_directory = "/sys/devices/system/node/";
+	string online_nodes;
+	if (ReadFirstLine(node_directory + "online", online_nodes)) {
+		for (auto node : ParseCPUList(online_nodes)) {
+			string cpu_list;
+			if (!ReadFirstLine(node_directory + "node" + std::to_string(node) + "/cpulist", cpu_list)) {
+				continue;
+			}
+			auto cpus = ParseCPUList(cpu_list);
+			if (cpus.empty()) {
+				// memory-only node: there are no CPUs to pin workers to
+				continue;
+			}
+			topology.node_cpus.push_back(std::move(cpus));
+		}
+	}
+#endif
+	if (topology.node_cpus.empty()) {
+		topology.node_cpus.emplace_back();
+	}
+	return topology;
+}
+
+bool NumaTopology::PinCurrentThread(idx_t node) const {
+#ifdef DUCKDB_NUMA_LINUX
+	if (node >= node_cpus.size() || node_cpus[node].empty()) {
+		return false;
+	}
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	for (auto cpu : node_cpus[node]) {
+		if (cpu < CPU_SETSIZE) {
+			CPU_SET(cpu, &cpu_set);
+		}
+	}
+	return sched_setaffinity(0, sizeof(cpu_set), &cpu_set) == 0;
+#else
+	return false;
+#endif
+}
+
+} // namespace duckdb
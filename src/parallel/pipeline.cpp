@@ -9,6 +9,7 @@
 #include "duckdb/execution/operator/set/physical_recursive_cte.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/parallel/adaptive_parallelism.hpp"
 #include "duckdb/parallel/pipeline_event.hpp"
 #include "duckdb/parallel/pipeline_executor.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
@@ -20,37 +21,79 @@ class PipelineTask : public ExecutorTask {
 	static constexpr const idx_t PARTIAL_CHUNK_COUNT = 50;
 
 public:
-	explicit PipelineTask(Pipeline &pipeline_p, shared_ptr<Event> event_p)
-	    : ExecutorTask(pipeline_p.executor), pipeline(pipeline_p), event(std::move(event_p)) {
+	explicit PipelineTask(Pipeline &pipeline_p, shared_ptr<Event> event_p,
+	                      optional_ptr<AdaptiveParallelismController> controller_p = nullptr)
+	    : ExecutorTask(pipeline_p.executor), pipeline(pipeline_p), event(std::move(event_p)), controller(controller_p) {
 	}
 
 	Pipeline &pipeline;
 	shared_ptr<Event> event;
 	unique_ptr<PipelineExecutor> pipeline_executor;
+	//! The controller that decides whether to launch more tasks for the pipeline (if any)
+	optional_ptr<AdaptiveParallelismController> controller;
 
 public:
+	string TraceName() const override {
+		return pipeline.GetDescription();
+	}
+
 	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
 		if (!pipeline_executor) {
 			pipeline_executor = make_uniq<PipelineExecutor>(pipeline.GetClientContext(), pipeline);
+			// a blocked source reschedules this task once it can make progress again
+			pipeline_executor->SetTaskForInterrupts(shared_from_this());
 		}
+		PipelineExecuteResult result;
 		if (mode == TaskExecutionMode::PROCESS_PARTIAL) {
-			bool finished = pipeline_executor->Execute(PARTIAL_CHUNK_COUNT);
-			if (!finished) {
-				return TaskExecutionResult::TASK_NOT_FINISHED;
+			if (controller) {
+				result = ExecuteTimeSlice();
+			} else {
+				result = pipeline_executor->Execute(PARTIAL_CHUNK_COUNT);
 			}
 		} else {
-			pipeline_executor->Execute();
+			result = pipeline_executor->Execute();
+		}
+		if (result == PipelineExecuteResult::INTERRUPTED) {
+			return TaskExecutionResult::TASK_BLOCKED;
+		}
+		if (result == PipelineExecuteResult::NOT_FINISHED) {
+			D_ASSERT(mode == TaskExecutionMode::PROCESS_PARTIAL);
+			return TaskExecutionResult::TASK_NOT_FINISHED;
 		}
 		event->FinishTask();
 		pipeline_executor.reset();
 		return TaskExecutionResult::TASK_FINISHED;
 	}
+
+private:
+	//! Execute a time slice and report the progress to the controller, launching another task if it asks for one
+	PipelineExecuteResult ExecuteTimeSlice() {
+		auto start_rows = pipeline_executor->GetSourceRowCount();
+		auto start_wall_time = AdaptiveParallelismController::WallTime();
+		auto start_cpu_time = AdaptiveParallelismController::ThreadCPUTime();
+		auto result = pipeline_executor->Execute(PARTIAL_CHUNK_COUNT);
+		if (result == PipelineExecuteResult::FINISHED) {
+			// the source is exhausted: more tasks would not help anymore
+			return result;
+		}
+		auto rows = pipeline_executor->GetSourceRowCount() - start_rows;
+		auto wall_time = AdaptiveParallelismController::WallTime() - start_wall_time;
+		auto cpu_time = AdaptiveParallelismController::ThreadCPUTime() - start_cpu_time;
+		if (controller->ReportProgress(rows, wall_time, cpu_time)) {
+			// this task has not finished yet, so the event cannot finish before the new task is added
+			event->AddTask(make_uniq<PipelineTask>(pipeline, event, controller));
+		}
+		return result;
+	}
 };
 
 Pipeline::Pipeline(Executor &executor_p)
     : executor(executor_p), ready(false), initialized(false), source(nullptr), sink(nullptr) {
 }
 
+Pipeline::~Pipeline() {
+}
+
 ClientContext &Pipeline::GetClientContext() {
 	return executor.context;
 }
@@ -143,11 +186,25 @@ bool Pipeline::LaunchScanTasks(shared_ptr<Event> &event, idx_t max_threads) {
 	if (max_threads > active_threads) {
 		max_threads = active_threads;
 	}
+	auto &client_config = ClientConfig::GetConfig(executor.context);
+	auto query_max_threads = client_config.query_max_threads;
+	if (query_max_threads > 0 && max_threads > query_max_threads) {
+		max_threads = query_max_threads;
+	}
 	if (max_threads <= 1) {
 		// too small to parallelize
 		return false;
 	}
 
+	if (client_config.adaptive_parallelism) {
+		// start with a single task: the controller launches more tasks while they increase the throughput
+		parallelism_controller = make_uniq<AdaptiveParallelismController>(1, max_threads);
+		vector<unique_ptr<Task>> tasks;
+		tasks.push_back(make_uniq<PipelineTask>(*this, event, parallelism_controller.get()));
+		event->SetTasks(std::move(tasks));
+		return true;
+	}
+
 	// launch a task for every thread
 	vector<unique_ptr<Task>> tasks;
 	for (idx_t i = 0; i < max_threads; i++) {
@@ -193,6 +250,38 @@ void Pipeline::ResetSource(bool force) {
 	}
 }
 
+idx_t Pipeline::RegisterNewBatchIndex() {
+	lock_guard<mutex> guard(batch_lock);
+	// the executor has not fetched anything yet: it holds back the minimum until it has
+	auto index = batch_indexes.empty() ? base_batch_index : *batch_indexes.begin();
+	batch_indexes.insert(index);
+	return index;
+}
+
+idx_t Pipeline::UpdateBatchIndex(idx_t old_index, idx_t new_index) {
+	lock_guard<mutex> guard(batch_lock);
+	auto entry = batch_indexes.find(old_index);
+	if (entry == batch_indexes.end()) {
+		throw InternalException("Pipeline::UpdateBatchIndex - batch index %llu was not registered", old_index);
+	}
+	batch_indexes.erase(entry);
+	batch_indexes.insert(new_index);
+	return *batch_indexes.begin();
+}
+
+void Pipeline::ReleaseBatchIndex(idx_t index) {
+	lock_guard<mutex> guard(batch_lock);
+	auto entry = batch_indexes.find(index);
+	if (entry != batch_indexes.end()) {
+		batch_indexes.erase(entry);
+	}
+}
+
+idx_t Pipeline::GetMinimumBatchIndex() {
+	lock_guard<mutex> guard(batch_lock);
+	return batch_indexes.empty() ? DConstants::INVALID_INDEX : *batch_indexes.begin();
+}
+
 void Pipeline::Ready() {
 	if (ready) {
 		return;
@@ -229,6 +318,17 @@ string Pipeline::ToString() const {
 	return renderer.ToString(*this);
 }
 
+string Pipeline::GetDescription() const {
+	string result;
+	for (auto &op : GetOperators()) {
+		if (!result.empty()) {
+			result += " -> ";
+		}
+		result += op.get().GetName();
+	}
+	return result;
+}
+
 void Pipeline::Print() const {
 	Printer::Print(ToString());
 }
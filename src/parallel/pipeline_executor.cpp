@@ -5,24 +5,51 @@
 namespace duckdb {
 
 PipelineExecutor::PipelineExecutor(ClientContext &context_p, Pipeline &pipeline_p)
-    : pipeline(pipeline_p), thread(context_p), context(context_p, thread, &pipeline_p) {
+    : pipeline(pipeline_p), thread(context_p), context(context_p, thread, &pipeline_p),
+      interrupt_done_signal(make_shared<InterruptDoneSignalState>()), interrupt_state(interrupt_done_signal) {
 	D_ASSERT(pipeline.source_state);
 	local_source_state = pipeline.source->GetLocalSourceState(context, *pipeline.source_state);
+	context.interrupt_state = &interrupt_state;
 	if (pipeline.sink) {
 		local_sink_state = pipeline.sink->GetLocalSinkState(context);
 		requires_batch_index = pipeline.sink->RequiresBatchIndex() && pipeline.source->SupportsBatchIndex();
+		if (requires_batch_index) {
+			current_batch_index = pipeline.RegisterNewBatchIndex();
+		}
 	}
 
-	intermediate_chunks.reserve(pipeline.operators.size());
-	intermediate_states.reserve(pipeline.operators.size());
-	for (idx_t i = 0; i < pipeline.operators.size(); i++) {
-		auto &prev_operator = i == 0 ? *pipeline.source : pipeline.operators[i - 1].get();
-		auto &current_operator = pipeline.operators[i].get();
+	// the builds of the joins in this pipeline have finished: re-plan the order of the probes if they were misestimated
+	join_order = AdaptiveJoinOrder::TryReorder(context.client, *pipeline.source, pipeline.operators);
+	operators = join_order ? join_order->operators : pipeline.operators;
+
+	intermediate_chunks.reserve(operators.size());
+	intermediate_states.reserve(operators.size());
+	for (idx_t i = 0; i < operators.size(); i++) {
+		auto &current_operator = operators[i].get();
 
 		auto chunk = make_uniq<DataChunk>();
-		chunk->Initialize(Allocator::Get(context.client), prev_operator.GetTypes());
+		if (i == 0) {
+			chunk->Initialize(Allocator::Get(context.client), pipeline.source->GetTypes());
+		} else if (!join_order || join_order->EndsChain(i - 1)) {
+			// a re-ordered chain of joins produces the columns in the order of the original plan
+			chunk->Initialize(Allocator::Get(context.client), pipeline.operators[i - 1].get().GetTypes());
+		} else {
+			chunk->Initialize(Allocator::Get(context.client), join_order->output_types[i - 1]);
+		}
 		intermediate_chunks.push_back(std::move(chunk));
 
+		if (join_order) {
+			unique_ptr<DataChunk> reordered_chunk;
+			if (join_order->EndsChain(i)) {
+				reordered_chunk = make_uniq<DataChunk>();
+				reordered_chunk->Initialize(Allocator::Get(context.client), join_order->output_types[i]);
+			}
+			reordered_chunks.push_back(std::move(reordered_chunk));
+			if (!join_order->runtime_info[i].empty()) {
+				context.thread.profiler.AddRuntimeInfo(current_operator, join_order->runtime_info[i]);
+			}
+		}
+
 		auto op_state = current_operator.GetOperatorState(context);
 		intermediate_states.push_back(std::move(op_state));
 
@@ -35,35 +62,60 @@ PipelineExecutor::PipelineExecutor(ClientContext &context_p, Pipeline &pipeline_
 	InitializeChunk(final_chunk);
 }
 
-bool PipelineExecutor::Execute(idx_t max_chunks) {
+PipelineExecutor::~PipelineExecutor() {
+	if (requires_batch_index && !finalized) {
+		// the executor was destroyed before it finished (e.g. because the query was cancelled)
+		pipeline.ReleaseBatchIndex(current_batch_index);
+	}
+}
+
+void PipelineExecutor::SetTaskForInterrupts(weak_ptr<Task> current_task) {
+	interrupt_state = InterruptState(std::move(current_task));
+}
+
+PipelineExecuteResult PipelineExecutor::Execute(idx_t max_chunks) {
 	D_ASSERT(pipeline.sink);
 	bool exhausted_source = false;
-	auto &source_chunk = pipeline.operators.empty() ? final_chunk : *intermediate_chunks[0];
+	auto &source_chunk = operators.empty() ? final_chunk : *intermediate_chunks[0];
 	for (idx_t i = 0; i < max_chunks; i++) {
 		if (IsFinished()) {
 			break;
 		}
-		source_chunk.Reset();
-		FetchFromSource(source_chunk);
-		if (source_chunk.size() == 0) {
-			exhausted_source = true;
-			break;
+		OperatorResultType result;
+		if (!in_process_operators.empty()) {
+			// the sink blocked while the operators still had output left for the current source chunk
+			result = ExecutePushInternal(source_chunk);
+		} else {
+			source_chunk.Reset();
+			auto source_result = FetchFromSource(source_chunk);
+			if (source_result == SourceResultType::BLOCKED) {
+				return PipelineExecuteResult::INTERRUPTED;
+			}
+			if (source_result == SourceResultType::FINISHED) {
+				exhausted_source = true;
+				break;
+			}
+			result = ExecutePushInternal(source_chunk);
 		}
-		auto result = ExecutePushInternal(source_chunk);
 		if (result == OperatorResultType::FINISHED) {
 			D_ASSERT(IsFinished());
 			break;
 		}
+		if (blocked_on_sink) {
+			// the sink cannot accept more input for now: resume once it calls back
+			blocked_on_sink = false;
+			return PipelineExecuteResult::INTERRUPTED;
+		}
 	}
 	if (!exhausted_source && !IsFinished()) {
-		return false;
+		return PipelineExecuteResult::NOT_FINISHED;
 	}
 	PushFinalize();
-	return true;
+	return PipelineExecuteResult::FINISHED;
 }
 
-void PipelineExecutor::Execute() {
-	Execute(NumericLimits<idx_t>::Maximum());
+PipelineExecuteResult PipelineExecutor::Execute() {
+	return Execute(NumericLimits<idx_t>::Maximum());
 }
 
 OperatorResultType PipelineExecutor::ExecutePush(DataChunk &input) { // LCOV_EXCL_START
@@ -107,6 +159,12 @@ OperatorResultType PipelineExecutor::ExecutePushInternal(DataChunk &input, idx_t
 				FinishProcessing();
 				return OperatorResultType::FINISHED;
 			}
+			if (sink_result == SinkResultType::BLOCKED && !finalized) {
+				// the sink consumed the chunk, but wants the pipeline to pause: any output left in the operators is
+				// pushed once the pipeline resumes (while finalizing we keep on pushing the cached output)
+				blocked_on_sink = true;
+				return result;
+			}
 		}
 		if (result == OperatorResultType::NEED_MORE_INPUT) {
 			return OperatorResultType::NEED_MORE_INPUT;
@@ -117,8 +175,8 @@ OperatorResultType PipelineExecutor::ExecutePushInternal(DataChunk &input, idx_t
 // Push all remaining cached operator output through the pipeline
 void PipelineExecutor::FlushCachingOperatorsPush() {
 	idx_t start_idx = IsFinished() ? idx_t(finished_processing_idx) : 0;
-	for (idx_t op_idx = start_idx; op_idx < pipeline.operators.size(); op_idx++) {
-		if (!pipeline.operators[op_idx].get().RequiresFinalExecute()) {
+	for (idx_t op_idx = start_idx; op_idx < operators.size(); op_idx++) {
+		if (!operators[op_idx].get().RequiresFinalExecute()) {
 			continue;
 		}
 
@@ -128,11 +186,13 @@ void PipelineExecutor::FlushCachingOperatorsPush() {
 		do {
 			auto &curr_chunk =
 			    op_idx + 1 >= intermediate_chunks.size() ? final_chunk : *intermediate_chunks[op_idx + 1];
-			auto &current_operator = pipeline.operators[op_idx].get();
+			auto &current_operator = operators[op_idx].get();
+			auto &output_chunk = GetOperatorOutput(op_idx, curr_chunk);
 			StartOperator(current_operator);
-			finalize_result = current_operator.FinalExecute(context, curr_chunk, *current_operator.op_state,
+			finalize_result = current_operator.FinalExecute(context, output_chunk, *current_operator.op_state,
 			                                                *intermediate_states[op_idx]);
-			EndOperator(current_operator, &curr_chunk);
+			EndOperator(current_operator, &output_chunk);
+			FinishOperatorOutput(op_idx, output_chunk, curr_chunk);
 			push_result = ExecutePushInternal(curr_chunk, op_idx + 1);
 		} while (finalize_result != OperatorFinalizeResultType::FINISHED &&
 		         push_result != OperatorResultType::FINISHED);
@@ -156,13 +216,17 @@ void PipelineExecutor::PushFinalize() {
 
 	FlushCachingOperatorsPush();
 
+	if (requires_batch_index) {
+		// this executor will not produce any more batches
+		pipeline.ReleaseBatchIndex(current_batch_index);
+	}
 	D_ASSERT(local_sink_state);
 	// run the combine for the sink
 	pipeline.sink->Combine(context, *pipeline.sink->sink_state, *local_sink_state);
 
 	// flush all query profiler info
 	for (idx_t i = 0; i < intermediate_states.size(); i++) {
-		intermediate_states[i]->Finalize(pipeline.operators[i].get(), context);
+		intermediate_states[i]->Finalize(operators[i].get(), context);
 	}
 	pipeline.executor.Flush(thread);
 	local_sink_state.reset();
@@ -175,16 +239,21 @@ void PipelineExecutor::ExecutePull(DataChunk &result) {
 	auto &executor = pipeline.executor;
 	try {
 		D_ASSERT(!pipeline.sink);
-		auto &source_chunk = pipeline.operators.empty() ? result : *intermediate_chunks[0];
+		auto &source_chunk = operators.empty() ? result : *intermediate_chunks[0];
 		while (result.size() == 0) {
 			if (in_process_operators.empty()) {
 				source_chunk.Reset();
-				FetchFromSource(source_chunk);
-				if (source_chunk.size() == 0) {
+				auto source_result = FetchFromSource(source_chunk);
+				if (source_result == SourceResultType::BLOCKED) {
+					// pulling is not done from a task: wait in place until the source can make progress
+					interrupt_done_signal->Await();
+					continue;
+				}
+				if (source_result == SourceResultType::FINISHED) {
 					break;
 				}
 			}
-			if (!pipeline.operators.empty()) {
+			if (!operators.empty()) {
 				auto state = Execute(source_chunk, result);
 				if (state == OperatorResultType::FINISHED) {
 					break;
@@ -234,14 +303,14 @@ OperatorResultType PipelineExecutor::Execute(DataChunk &input, DataChunk &result
 	if (input.size() == 0) { // LCOV_EXCL_START
 		return OperatorResultType::NEED_MORE_INPUT;
 	} // LCOV_EXCL_STOP
-	D_ASSERT(!pipeline.operators.empty());
+	D_ASSERT(!operators.empty());
 
 	idx_t current_idx;
 	GoToSource(current_idx, initial_idx);
 	if (current_idx == initial_idx) {
 		current_idx++;
 	}
-	if (current_idx > pipeline.operators.size()) {
+	if (current_idx > operators.size()) {
 		result.Reference(input);
 		return OperatorResultType::NEED_MORE_INPUT;
 	}
@@ -263,14 +332,16 @@ OperatorResultType PipelineExecutor::Execute(DataChunk &input, DataChunk &result
 			auto &prev_chunk =
 			    current_intermediate == initial_idx + 1 ? input : *intermediate_chunks[current_intermediate - 1];
 			auto operator_idx = current_idx - 1;
-			auto &current_operator = pipeline.operators[operator_idx].get();
+			auto &current_operator = operators[operator_idx].get();
+			auto &output_chunk = GetOperatorOutput(operator_idx, current_chunk);
 
 			// if current_idx > source_idx, we pass the previous' operators output through the Execute of the current
 			// operator
 			StartOperator(current_operator);
-			auto result = current_operator.Execute(context, prev_chunk, current_chunk, *current_operator.op_state,
+			auto result = current_operator.Execute(context, prev_chunk, output_chunk, *current_operator.op_state,
 			                                       *intermediate_states[current_intermediate - 1]);
-			EndOperator(current_operator, &current_chunk);
+			EndOperator(current_operator, &output_chunk);
+			FinishOperatorOutput(operator_idx, output_chunk, current_chunk);
 			if (result == OperatorResultType::HAVE_MORE_OUTPUT) {
 				// more data remains in this operator
 				// push in-process marker
@@ -297,7 +368,7 @@ OperatorResultType PipelineExecutor::Execute(DataChunk &input, DataChunk &result
 		} else {
 			// we got output! continue to the next operator
 			current_idx++;
-			if (current_idx > pipeline.operators.size()) {
+			if (current_idx > operators.size()) {
 				// if we got output and are at the last operator, we are finished executing for this output chunk
 				// return the data and push it into the chunk
 				break;
@@ -307,9 +378,12 @@ OperatorResultType PipelineExecutor::Execute(DataChunk &input, DataChunk &result
 	return in_process_operators.empty() ? OperatorResultType::NEED_MORE_INPUT : OperatorResultType::HAVE_MORE_OUTPUT;
 }
 
-void PipelineExecutor::FetchFromSource(DataChunk &result) {
+SourceResultType PipelineExecutor::FetchFromSource(DataChunk &result) {
 	StartOperator(*pipeline.source);
-	pipeline.source->GetData(context, result, *pipeline.source_state, *local_source_state);
+	OperatorSourceInput source_input {*pipeline.source_state, *local_source_state, interrupt_state};
+	auto res = pipeline.source->PollData(context, result, source_input);
+	D_ASSERT(res != SourceResultType::HAVE_MORE_OUTPUT || result.size() > 0);
+	source_row_count += result.size();
 	if (result.size() != 0 && requires_batch_index) {
 		auto next_batch_index =
 		    pipeline.source->GetBatchIndex(context, result, *pipeline.source_state, *local_source_state);
@@ -317,8 +391,13 @@ void PipelineExecutor::FetchFromSource(DataChunk &result) {
 		D_ASSERT(local_sink_state->batch_index <= next_batch_index ||
 		         local_sink_state->batch_index == DConstants::INVALID_INDEX);
 		local_sink_state->batch_index = next_batch_index;
+		if (next_batch_index != current_batch_index) {
+			pipeline.UpdateBatchIndex(current_batch_index, next_batch_index);
+			current_batch_index = next_batch_index;
+		}
 	}
 	EndOperator(*pipeline.source, &result);
+	return res;
 }
 
 void PipelineExecutor::InitializeChunk(DataChunk &chunk) {
@@ -326,6 +405,22 @@ void PipelineExecutor::InitializeChunk(DataChunk &chunk) {
 	chunk.Initialize(Allocator::DefaultAllocator(), last_op.GetTypes());
 }
 
+DataChunk &PipelineExecutor::GetOperatorOutput(idx_t operator_idx, DataChunk &chunk) {
+	if (!join_order || !reordered_chunks[operator_idx]) {
+		return chunk;
+	}
+	auto &output = *reordered_chunks[operator_idx];
+	output.Reset();
+	return output;
+}
+
+void PipelineExecutor::FinishOperatorOutput(idx_t operator_idx, DataChunk &output, DataChunk &chunk) {
+	if (&output == &chunk) {
+		return;
+	}
+	join_order->RestoreColumnOrder(operator_idx, output, chunk);
+}
+
 void PipelineExecutor::StartOperator(PhysicalOperator &op) {
 	if (context.client.interrupted) {
 		throw InterruptException();
@@ -1,6 +1,9 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/set.hpp"
+#include "duckdb/common/trace_recorder.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
 
@@ -24,53 +27,341 @@ struct SchedulerThread {
 };
 
 #ifndef DUCKDB_NO_THREADS
-typedef duckdb_moodycamel::ConcurrentQueue<unique_ptr<Task>> concurrent_queue_t;
+//! The scheduling state of a producer, shared with the threads that are executing its tasks
+struct ProducerSchedulingState {
+	ProducerSchedulingState(idx_t priority, idx_t max_threads)
+	    : priority(priority), max_threads(max_threads), running_tasks(0), virtual_time(0) {
+	}
+
+	//! The weight of the producer
+	const idx_t priority;
+	//! The maximum number of tasks of the producer that may run concurrently (0 = no limit)
+	const idx_t max_threads;
+	//! The number of tasks of the producer that are currently running on scheduler threads
+	atomic<idx_t> running_tasks;
+	//! The execution time of the producer scaled by its priority (protected by ConcurrentQueue::producers_lock)
+	double virtual_time;
+	//! The token of the producer while it is registered (protected by ConcurrentQueue::producers_lock)
+	QueueProducerToken *token = nullptr;
+	//! Whether the producer is in ConcurrentQueue::runnable (protected by ConcurrentQueue::producers_lock)
+	bool runnable = false;
+};
+
+//! A queued task together with the scheduling state of the producer that scheduled it
+struct QueuedTask {
+	shared_ptr<Task> task;
+	shared_ptr<ProducerSchedulingState> producer;
+};
+
+typedef duckdb_moodycamel::ConcurrentQueue<QueuedTask> concurrent_queue_t;
 typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
 
-struct ConcurrentQueue {
+//! The NUMA node of the scheduler thread that runs on this thread, or INVALID_INDEX for other threads
+static thread_local idx_t current_worker_node = DConstants::INVALID_INDEX;
+
+//! The task queue of a single NUMA node
+struct NodeQueue {
 	concurrent_queue_t q;
 	lightweight_semaphore_t semaphore;
+};
 
-	void Enqueue(ProducerToken &token, unique_ptr<Task> task);
-	bool DequeueFromProducer(ProducerToken &token, unique_ptr<Task> &task);
+struct ConcurrentQueue {
+	explicit ConcurrentQueue(idx_t node_count);
+
+	//! One queue per NUMA node - without NUMA-aware scheduling there is a single queue
+	vector<unique_ptr<NodeQueue>> nodes;
+	//! The number of nodes that have worker threads assigned to them
+	atomic<idx_t> active_nodes;
+	//! Round-robin counter used to spread tasks scheduled by non-worker threads over the nodes
+	atomic<idx_t> next_node;
+	//! Lock protecting the producer list and the virtual times
+	mutex producers_lock;
+	//! The producers that are currently registered
+	vector<QueueProducerToken *> producers;
+	//! The virtual time of the producer that was served last, new producers start from this time
+	double current_virtual_time = 0;
+	//! The number of registered producers with a non-default priority or a thread limit
+	atomic<idx_t> fair_producers;
+	//! While fair_producers > 0: the producers that might have queued tasks, ordered by virtual time
+	set<std::pair<double, QueueProducerToken *>> runnable;
+
+	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
+	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+	//! Dequeue a task to execute on the given node: tasks are only picked by DequeueFair while any producer has a
+	//! non-default priority or a thread limit, otherwise any task is taken without locking
+	bool Dequeue(idx_t node, shared_ptr<Task> &task, shared_ptr<ProducerSchedulingState> &producer);
+	//! Dequeue any task, preferring the queue of the given node and stealing from the other nodes otherwise
+	bool TryDequeue(idx_t node, QueuedTask &item);
+	//! Dequeue a task of the producer with the smallest virtual time that has not reached its thread limit
+	bool DequeueFair(idx_t node, shared_ptr<Task> &task, shared_ptr<ProducerSchedulingState> &producer);
+	//! Account the execution time of a time slice of a task that was obtained through DequeueFair
+	void FinishTimeSlice(idx_t node, shared_ptr<ProducerSchedulingState> &producer, double elapsed_seconds);
+	void RegisterProducer(QueueProducerToken &token);
+	void UnregisterProducer(QueueProducerToken &token);
+	//! Add a producer to the runnable producers (requires producers_lock)
+	void AddRunnable(ProducerSchedulingState &state);
+	//! Remove a producer from the runnable producers (requires producers_lock)
+	void RemoveRunnable(ProducerSchedulingState &state);
+	//! The node whose queue the calling thread should use
+	idx_t LocalNode() const;
+	void Signal(idx_t n);
 };
 
 struct QueueProducerToken {
-	explicit QueueProducerToken(ConcurrentQueue &queue) : queue_token(queue.q) {
+	QueueProducerToken(ConcurrentQueue &queue, idx_t priority, idx_t max_threads)
+	    : queue(queue), state(make_shared<ProducerSchedulingState>(priority, max_threads)) {
+		for (auto &node : queue.nodes) {
+			queue_tokens.push_back(make_uniq<duckdb_moodycamel::ProducerToken>(node->q));
+		}
+		queue.RegisterProducer(*this);
+	}
+	~QueueProducerToken() {
+		queue.UnregisterProducer(*this);
 	}
 
-	duckdb_moodycamel::ProducerToken queue_token;
+	ConcurrentQueue &queue;
+	//! One producer token per node queue
+	vector<unique_ptr<duckdb_moodycamel::ProducerToken>> queue_tokens;
+	shared_ptr<ProducerSchedulingState> state;
 };
 
-void ConcurrentQueue::Enqueue(ProducerToken &token, unique_ptr<Task> task) {
+ConcurrentQueue::ConcurrentQueue(idx_t node_count) : active_nodes(1), next_node(0), fair_producers(0) {
+	D_ASSERT(node_count > 0);
+	for (idx_t i = 0; i < node_count; i++) {
+		nodes.push_back(make_uniq<NodeQueue>());
+	}
+}
+
+idx_t ConcurrentQueue::LocalNode() const {
+	return current_worker_node < nodes.size() ? current_worker_node : 0;
+}
+
+void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
+	// tasks scheduled by a worker stay on the node of that worker, other tasks are spread over the active nodes
+	idx_t node = current_worker_node;
+	if (node >= nodes.size()) {
+		node = nodes.size() == 1 ? 0 : next_node++ % active_nodes;
+	}
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	if (q.enqueue(token.token->queue_token, std::move(task))) {
-		semaphore.signal();
-	} else {
+	auto &node_queue = *nodes[node];
+	if (!node_queue.q.enqueue(*token.token->queue_tokens[node], QueuedTask {std::move(task), token.token->state})) {
 		throw InternalException("Could not schedule task!");
 	}
+	if (fair_producers > 0) {
+		lock_guard<mutex> guard(producers_lock);
+		AddRunnable(*token.token->state);
+	}
+	node_queue.semaphore.signal();
 }
 
-bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, unique_ptr<Task> &task) {
+bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	return q.try_dequeue_from_producer(token.token->queue_token, task);
+	QueuedTask item;
+	for (idx_t node = 0; node < nodes.size(); node++) {
+		if (nodes[node]->q.try_dequeue_from_producer(*token.token->queue_tokens[node], item)) {
+			task = std::move(item.task);
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ConcurrentQueue::TryDequeue(idx_t node, QueuedTask &item) {
+	if (nodes[node]->q.try_dequeue(item)) {
+		return true;
+	}
+	// no local work: steal from the queues of the other nodes
+	for (idx_t i = 1; i < nodes.size(); i++) {
+		if (nodes[(node + i) % nodes.size()]->q.try_dequeue(item)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ConcurrentQueue::Dequeue(idx_t node, shared_ptr<Task> &task, shared_ptr<ProducerSchedulingState> &producer) {
+	if (fair_producers > 0) {
+		return DequeueFair(node, task, producer);
+	}
+	QueuedTask item;
+	if (!TryDequeue(node, item)) {
+		return false;
+	}
+	task = std::move(item.task);
+	return true;
+}
+
+static bool IsFairProducer(const ProducerSchedulingState &state) {
+	return state.priority != TaskScheduler::DEFAULT_PRIORITY || state.max_threads > 0;
+}
+
+void ConcurrentQueue::AddRunnable(ProducerSchedulingState &state) {
+	if (!state.runnable && state.token) {
+		runnable.insert(std::make_pair(state.virtual_time, state.token));
+		state.runnable = true;
+	}
+}
+
+void ConcurrentQueue::RemoveRunnable(ProducerSchedulingState &state) {
+	if (state.runnable) {
+		runnable.erase(std::make_pair(state.virtual_time, state.token));
+		state.runnable = false;
+	}
+}
+
+void ConcurrentQueue::RegisterProducer(QueueProducerToken &token) {
+	lock_guard<mutex> guard(producers_lock);
+	// start at the current virtual time: the new producer neither monopolizes the threads nor waits for the others
+	token.state->virtual_time = current_virtual_time;
+	token.state->token = &token;
+	producers.push_back(&token);
+	if (IsFairProducer(*token.state) && fair_producers++ == 0) {
+		// the runnable producers are not tracked without fair scheduling: any producer might have queued tasks
+		for (auto &producer : producers) {
+			AddRunnable(*producer->state);
+		}
+	}
+}
+
+void ConcurrentQueue::UnregisterProducer(QueueProducerToken &token) {
+	lock_guard<mutex> guard(producers_lock);
+	for (idx_t i = 0; i < producers.size(); i++) {
+		if (producers[i] == &token) {
+			producers.erase(producers.begin() + i);
+			RemoveRunnable(*token.state);
+			token.state->token = nullptr;
+			if (IsFairProducer(*token.state)) {
+				fair_producers--;
+			}
+			return;
+		}
+	}
+}
+
+bool ConcurrentQueue::DequeueFair(idx_t node, shared_ptr<Task> &task, shared_ptr<ProducerSchedulingState> &producer) {
+	bool limited_producers = false;
+	QueuedTask item;
+	{
+		lock_guard<mutex> guard(producers_lock);
+		// visit the producers by virtual time, skipping producers that have reached their thread limit
+		for (auto entry = runnable.begin(); entry != runnable.end();) {
+			auto &token = *entry->second;
+			auto &state = *token.state;
+			if (state.max_threads > 0 && state.running_tasks >= state.max_threads) {
+				limited_producers = true;
+				entry++;
+				continue;
+			}
+			for (idx_t i = 0; i < nodes.size(); i++) {
+				auto queue_node = (node + i) % nodes.size();
+				if (nodes[queue_node]->q.try_dequeue_from_producer(*token.queue_tokens[queue_node], item)) {
+					task = std::move(item.task);
+					producer = token.state;
+					producer->running_tasks++;
+					current_virtual_time = producer->virtual_time;
+					return true;
+				}
+			}
+			// the producer has no queued tasks: Enqueue adds it again when it schedules a task
+			state.runnable = false;
+			entry = runnable.erase(entry);
+		}
+	}
+	if (limited_producers) {
+		// the remaining tasks might belong to a producer that has reached its limit
+		return false;
+	}
+	// tasks of producers that were destroyed before their queue was drained, or that were scheduled after the
+	// producers were checked
+	if (!TryDequeue(node, item)) {
+		return false;
+	}
+	lock_guard<mutex> guard(producers_lock);
+	auto &state = *item.producer;
+	if (state.max_threads > 0 && state.running_tasks >= state.max_threads) {
+		// the producer reached its limit in the meantime: the task is picked up again once one of its tasks finishes
+		nodes[node]->q.enqueue(std::move(item));
+		return false;
+	}
+	task = std::move(item.task);
+	producer = std::move(item.producer);
+	producer->running_tasks++;
+	current_virtual_time = producer->virtual_time;
+	return true;
+}
+
+void ConcurrentQueue::FinishTimeSlice(idx_t node, shared_ptr<ProducerSchedulingState> &producer,
+                                      double elapsed_seconds) {
+	if (!producer) {
+		return;
+	}
+	{
+		lock_guard<mutex> guard(producers_lock);
+		// reinsert the producer to keep the runnable producers ordered by virtual time
+		auto was_runnable = producer->runnable;
+		RemoveRunnable(*producer);
+		producer->virtual_time += elapsed_seconds * TaskScheduler::DEFAULT_PRIORITY / producer->priority;
+		producer->running_tasks--;
+		if (was_runnable) {
+			AddRunnable(*producer);
+		}
+	}
+	if (producer->max_threads > 0) {
+		// threads that skipped the tasks of this producer because of its limit consumed their signal: wake one up
+		nodes[node]->semaphore.signal();
+	}
+	producer.reset();
+}
+
+//! Execute a dequeued task, accounting its execution time to its producer if it was obtained through DequeueFair
+static void ExecuteTimeSlice(ConcurrentQueue &queue, idx_t node, shared_ptr<Task> &task,
+                             shared_ptr<ProducerSchedulingState> &producer, TaskExecutionMode mode) {
+	if (!producer) {
+		// without weighted producers the task runs to completion, as there is no other producer to yield to
+		if (task->Execute(TaskExecutionMode::PROCESS_ALL) == TaskExecutionResult::TASK_BLOCKED) {
+			task->Deschedule();
+		}
+		task.reset();
+		return;
+	}
+	auto start = high_resolution_clock::now();
+	auto execute_result = task->Execute(mode);
+	auto elapsed = duration_cast<duration<double>>(high_resolution_clock::now() - start).count();
+	queue.FinishTimeSlice(node, producer, elapsed);
+	if (execute_result == TaskExecutionResult::TASK_BLOCKED) {
+		// the task is waiting for a resource: it is rescheduled once the resource is available
+		task->Deschedule();
+	} else if (execute_result == TaskExecutionResult::TASK_NOT_FINISHED) {
+		// the time slice of the task is over: queue it again so the tasks of other producers get a turn
+		task->Requeue();
+	}
+	task.reset();
+}
+
+void ConcurrentQueue::Signal(idx_t n) {
+	for (auto &node : nodes) {
+		node->semaphore.signal(n);
+	}
 }
 
 #else
 struct ConcurrentQueue {
-	std::queue<unique_ptr<Task>> q;
+	explicit ConcurrentQueue(idx_t node_count) {
+	}
+
+	std::queue<shared_ptr<Task>> q;
 	mutex qlock;
 
-	void Enqueue(ProducerToken &token, unique_ptr<Task> task);
-	bool DequeueFromProducer(ProducerToken &token, unique_ptr<Task> &task);
+	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
+	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
 };
 
-void ConcurrentQueue::Enqueue(ProducerToken &token, unique_ptr<Task> task) {
+void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
 	lock_guard<mutex> lock(qlock);
 	q.push(std::move(task));
 }
 
-bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, unique_ptr<Task> &task) {
+bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
 	lock_guard<mutex> lock(qlock);
 	if (q.empty()) {
 		return false;
@@ -81,7 +372,7 @@ bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, unique_ptr<Task>
 }
 
 struct QueueProducerToken {
-	QueueProducerToken(ConcurrentQueue &queue) {
+	QueueProducerToken(ConcurrentQueue &queue, idx_t priority, idx_t max_threads) {
 	}
 };
 #endif
@@ -93,7 +384,10 @@ ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerT
 ProducerToken::~ProducerToken() {
 }
 
-TaskScheduler::TaskScheduler(DatabaseInstance &db) : db(db), queue(make_uniq<ConcurrentQueue>()) {
+TaskScheduler::TaskScheduler(DatabaseInstance &db)
+    : db(db), topology(DBConfig::GetConfig(db).options.numa_aware_scheduling ? NumaTopology::Detect()
+                                                                              : NumaTopology()),
+      queue(make_uniq<ConcurrentQueue>(topology.NodeCount())) {
 }
 
 TaskScheduler::~TaskScheduler() {
@@ -110,30 +404,41 @@ TaskScheduler &TaskScheduler::GetScheduler(DatabaseInstance &db) {
 	return db.GetScheduler();
 }
 
-unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
-	auto token = make_uniq<QueueProducerToken>(*queue);
+unique_ptr<ProducerToken> TaskScheduler::CreateProducer(idx_t priority, idx_t max_threads) {
+	auto token = make_uniq<QueueProducerToken>(*queue, MaxValue<idx_t>(priority, 1), max_threads);
 	return make_uniq<ProducerToken>(*this, std::move(token));
 }
 
-void TaskScheduler::ScheduleTask(ProducerToken &token, unique_ptr<Task> task) {
+void TaskScheduler::ScheduleTask(ProducerToken &token, shared_ptr<Task> task) {
+	auto &recorder = TraceRecorder::Get(db);
+	if (recorder.IsEnabled()) {
+		task->trace_queue_time = recorder.Now();
+	}
 	// Enqueue a task for the given producer token and signal any sleeping threads
 	queue->Enqueue(token, std::move(task));
 }
 
-bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, unique_ptr<Task> &task) {
+bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
 	return queue->DequeueFromProducer(token, task);
 }
 
 void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 #ifndef DUCKDB_NO_THREADS
-	unique_ptr<Task> task;
+	shared_ptr<Task> task;
+	shared_ptr<ProducerSchedulingState> producer;
+	auto node = queue->LocalNode();
+	auto &semaphore = queue->nodes[node]->semaphore;
 	// loop until the marker is set to false
 	while (*marker) {
-		// wait for a signal with a timeout
-		queue->semaphore.wait();
-		if (queue->q.try_dequeue(task)) {
-			task->Execute(TaskExecutionMode::PROCESS_ALL);
-			task.reset();
+		if (queue->nodes.size() == 1) {
+			semaphore.wait();
+		} else {
+			// tasks are only signalled on the node they are scheduled on: wake up periodically to steal work from
+			// the other nodes when this node is idle
+			semaphore.wait(TASK_TIMEOUT_USECS);
+		}
+		if (queue->Dequeue(node, task, producer)) {
+			ExecuteTimeSlice(*queue, node, task, producer, TaskExecutionMode::PROCESS_PARTIAL);
 		}
 	}
 #else
@@ -144,14 +449,15 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 #ifndef DUCKDB_NO_THREADS
 	idx_t completed_tasks = 0;
+	auto node = queue->LocalNode();
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
-		unique_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		shared_ptr<Task> task;
+		shared_ptr<ProducerSchedulingState> producer;
+		if (!queue->Dequeue(node, task, producer)) {
 			return completed_tasks;
 		}
-		task->Execute(TaskExecutionMode::PROCESS_ALL);
-		task.reset();
+		ExecuteTimeSlice(*queue, node, task, producer, TaskExecutionMode::PROCESS_ALL);
 		completed_tasks++;
 	}
 	return completed_tasks;
@@ -162,16 +468,18 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 
 void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 #ifndef DUCKDB_NO_THREADS
-	unique_ptr<Task> task;
+	shared_ptr<Task> task;
+	shared_ptr<ProducerSchedulingState> producer;
+	auto node = queue->LocalNode();
 	for (idx_t i = 0; i < max_tasks; i++) {
-		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		queue->nodes[node]->semaphore.wait(TASK_TIMEOUT_USECS);
+		if (!queue->Dequeue(node, task, producer)) {
 			return;
 		}
 		try {
-			task->Execute(TaskExecutionMode::PROCESS_ALL);
-			task.reset();
+			ExecuteTimeSlice(*queue, node, task, producer, TaskExecutionMode::PROCESS_ALL);
 		} catch (...) {
+			queue->FinishTimeSlice(node, producer, 0);
 			return;
 		}
 	}
@@ -181,7 +489,13 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 }
 
 #ifndef DUCKDB_NO_THREADS
-static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker) {
+static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker, const NumaTopology *topology,
+                               idx_t node) {
+	if (topology->NodeCount() > 1) {
+		// keep the worker (and the memory it first touches) on its node
+		topology->PinCurrentThread(node);
+		current_worker_node = node;
+	}
 	scheduler->ExecuteForever(marker);
 }
 #endif
@@ -208,7 +522,7 @@ void TaskScheduler::SetThreads(int32_t n) {
 
 void TaskScheduler::Signal(idx_t n) {
 #ifndef DUCKDB_NO_THREADS
-	queue->semaphore.signal(n);
+	queue->Signal(n);
 #endif
 }
 
@@ -237,14 +551,17 @@ void TaskScheduler::SetThreadsInternal(int32_t n) {
 		idx_t create_new_threads = new_thread_count - threads.size();
 		for (idx_t i = 0; i < create_new_threads; i++) {
 			// launch a thread and assign it a cancellation marker
+			// with NUMA-aware scheduling the threads are assigned to the nodes in a round-robin fashion
+			auto node = threads.size() % topology.NodeCount();
 			auto marker = unique_ptr<atomic<bool>>(new atomic<bool>(true));
-			auto worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get());
+			auto worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get(), &topology, node);
 			auto thread_wrapper = make_uniq<SchedulerThread>(std::move(worker_thread));
 
 			threads.push_back(std::move(thread_wrapper));
 			markers.push_back(std::move(marker));
 		}
 	}
+	queue->active_nodes = MaxValue<idx_t>(MinValue<idx_t>(threads.size(), topology.NodeCount()), 1);
 #endif
 }
 
@@ -4,7 +4,8 @@
 
 namespace duckdb {
 
-ThreadContext::ThreadContext(ClientContext &context) : profiler(QueryProfiler::Get(context).IsEnabled()) {
+ThreadContext::ThreadContext(ClientContext &context)
+    : profiler(QueryProfiler::Get(context).IsEnabled(), ClientConfig::GetConfig(context).enable_hardware_counters) {
 }
 
 } // namespace duckdb
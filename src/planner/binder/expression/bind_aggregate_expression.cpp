@@ -11,6 +11,7 @@
 #include "duckdb/planner/query_node/bound_select_node.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/function/scalar/generic_functions.hpp"
+#include "duckdb/main/client_config.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/function/function_binder.hpp"
 #include "duckdb/planner/binder.hpp"
@@ -81,6 +82,71 @@ static void NegatePercentileFractions(ClientContext &context, unique_ptr<ParsedE
 	}
 }
 
+//! Rewrites an exact quantile into an approximate quantile, whose (t-digest) state has a bounded size per group
+static bool TryApproximateQuantile(ClientContext &context, const string &name, vector<unique_ptr<Expression>> &children,
+                                   AggregateFunction &bound_function) {
+	const bool continuous = name == "median" || name == "quantile_cont";
+	if (!continuous && name != "quantile_disc" && name != "quantile") {
+		return false;
+	}
+	if (children.empty()) {
+		return false;
+	}
+	// the approximate quantile has to return the same type as the exact quantile
+	switch (children[0]->return_type.id()) {
+	case LogicalTypeId::TINYINT:
+		if (!continuous) {
+			return false;
+		}
+		break;
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::HUGEINT:
+	case LogicalTypeId::DOUBLE:
+		break;
+	default:
+		return false;
+	}
+	double quantile = 0.5;
+	if (name != "median") {
+		if (children.size() != 2 || !children[1]->IsFoldable()) {
+			return false;
+		}
+		auto value = ExpressionExecutor::EvaluateScalar(context, *children[1]);
+		if (value.IsNull() || value.type().id() == LogicalTypeId::LIST) {
+			return false;
+		}
+		quantile = value.GetValue<double>();
+		if (quantile < 0 || quantile > 1) {
+			return false;
+		}
+	} else if (children.size() != 1) {
+		return false;
+	}
+
+	QueryErrorContext error_context(nullptr, 0);
+	auto &func = Catalog::GetSystemCatalog(context).GetEntry<AggregateFunctionCatalogEntry>(
+	    context, DEFAULT_SCHEMA, "approx_quantile", error_context);
+	vector<unique_ptr<Expression>> arguments;
+	if (continuous) {
+		arguments.push_back(BoundCastExpression::AddCastToType(context, std::move(children[0]), LogicalType::DOUBLE));
+	} else {
+		arguments.push_back(std::move(children[0]));
+	}
+	arguments.push_back(make_uniq<BoundConstantExpression>(Value::FLOAT(float(quantile))));
+	children = std::move(arguments);
+
+	string error;
+	FunctionBinder function_binder(context);
+	idx_t best_function = function_binder.BindFunction(func.name, func.functions, children, error);
+	if (best_function == DConstants::INVALID_INDEX) {
+		throw InternalException("Could not bind approx_quantile: %s", error);
+	}
+	bound_function = func.functions.GetFunctionByOffset(best_function);
+	return true;
+}
+
 BindResult BaseSelectBinder::BindAggregate(FunctionExpression &aggr, AggregateFunctionCatalogEntry &func, idx_t depth) {
 	// first bind the child of the aggregate expression (if any)
 	this->bound_aggregate = true;
@@ -207,6 +273,13 @@ BindResult BaseSelectBinder::BindAggregate(FunctionExpression &aggr, AggregateFu
 	// found a matching function!
 	auto bound_function = func.functions.GetFunctionByOffset(best_function);
 
+	// approximate holistic aggregates if requested: replace exact quantiles by their bounded-memory approximation
+	// an ungrouped aggregate has a single state, which does not need a bound on its size: keep it exact
+	if (ClientConfig::GetConfig(context).holistic_aggregate_mode == HolisticAggregateMode::APPROXIMATE &&
+	    !node.groups.group_expressions.empty() && !aggr.distinct && aggr.order_bys->orders.empty()) {
+		TryApproximateQuantile(context, func.name, children, bound_function);
+	}
+
 	// Bind any sort columns, unless the aggregate is order-insensitive
 	unique_ptr<BoundOrderModifier> order_bys;
 	if (!aggr.order_bys->orders.empty()) {
@@ -5,9 +5,45 @@
 #include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/planner/operator/logical_simple.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/storage/statistics/file_statistics_catalog.hpp"
 
 namespace duckdb {
 
+unique_ptr<LogicalOperator> Binder::BindFileScanAnalyze(VacuumInfo &info, BoundTableRef &ref) {
+	if (!info.options.analyze) {
+		return nullptr;
+	}
+	auto plan = CreatePlan(ref);
+	// look through the projections of the view for the scan
+	auto scan = &plan;
+	while ((*scan)->type == LogicalOperatorType::LOGICAL_PROJECTION && (*scan)->children.size() == 1) {
+		scan = &(*scan)->children[0];
+	}
+	if ((*scan)->type != LogicalOperatorType::LOGICAL_GET) {
+		return nullptr;
+	}
+	auto &get = (*scan)->Cast<LogicalGet>();
+	auto key = FileStatisticsCatalog::GetKey(context, get);
+	if (key.empty()) {
+		return nullptr;
+	}
+	if (!info.columns.empty()) {
+		throw BinderException("ANALYZE of a file scan computes the statistics of all columns: a column list "
+		                      "cannot be specified");
+	}
+	info.file_statistics_key = std::move(key);
+	info.columns = get.names;
+	info.types = get.returned_types;
+	// scan all columns of the files
+	get.column_ids.clear();
+	get.projection_ids.clear();
+	for (idx_t col_idx = 0; col_idx < get.returned_types.size(); col_idx++) {
+		get.column_ids.push_back(col_idx);
+	}
+	// the statistics are computed over the files themselves, not over the (projected) view
+	return std::move(*scan);
+}
+
 BoundStatement Binder::Bind(VacuumStatement &stmt) {
 	BoundStatement result;
 
@@ -18,7 +54,18 @@ BoundStatement Binder::Bind(VacuumStatement &stmt) {
 		D_ASSERT(stmt.info->column_id_map.empty());
 		auto bound_table = Bind(*stmt.info->ref);
 		if (bound_table->type != TableReferenceType::BASE_TABLE) {
-			throw InvalidInputException("Can only vacuum/analyze base tables!");
+			// this might be a view over a scan of external files: compute the statistics of the files
+			root = BindFileScanAnalyze(*stmt.info, *bound_table);
+			if (!root) {
+				throw InvalidInputException("Can only vacuum/analyze base tables or views over file scans!");
+			}
+			auto vacuum = make_uniq<LogicalSimple>(LogicalOperatorType::LOGICAL_VACUUM, std::move(stmt.info));
+			vacuum->children.push_back(std::move(root));
+			result.names = {"Success"};
+			result.types = {LogicalType::BOOLEAN};
+			result.plan = std::move(vacuum);
+			properties.return_type = StatementReturnType::NOTHING;
+			return result;
 		}
 		auto ref = unique_ptr_cast<BoundTableRef, BoundBaseTableRef>(std::move(bound_table));
 		auto &table = ref->table;
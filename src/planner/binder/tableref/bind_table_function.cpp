@@ -20,6 +20,7 @@
 #include "duckdb/catalog/catalog_entry/table_function_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/function/table/read_csv.hpp"
+#include "duckdb/storage/statistics/file_statistics_catalog.hpp"
 
 namespace duckdb {
 
@@ -177,6 +178,10 @@ Binder::BindTableFunctionInternal(TableFunction &table_function, const string &f
 	get->named_parameters = named_parameters;
 	get->input_table_types = input_table_types;
 	get->input_table_names = input_table_names;
+	auto file_statistics = FileStatisticsCatalog::Get(context).GetStatistics(context, *get);
+	if (file_statistics && file_statistics->Matches(return_names, return_types)) {
+		get->file_statistics = std::move(file_statistics);
+	}
 	if (table_function.in_out_function && !table_function.projection_pushdown) {
 		get->column_ids.reserve(return_types.size());
 		for (idx_t i = 0; i < return_types.size(); i++) {
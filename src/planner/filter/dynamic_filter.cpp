@@ -0,0 +1,98 @@
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "duckdb/common/field_writer.hpp"
+
+namespace duckdb {
+
+bool DynamicFilterData::SetValue(const Value &new_constant) {
+	D_ASSERT(!new_constant.IsNull());
+	lock_guard<mutex> guard(lock);
+	if (initialized) {
+		bool tighter;
+		switch (comparison_type) {
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			tighter = new_constant < constant;
+			break;
+		case ExpressionType::COMPARE_GREATERTHAN:
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			tighter = new_constant > constant;
+			break;
+		default:
+			throw InternalException("Unsupported comparison type for dynamic filter");
+		}
+		if (!tighter) {
+			return false;
+		}
+	}
+	constant = new_constant;
+	initialized = true;
+	return true;
+}
+
+bool DynamicFilterData::SetCompressedValue(const Value &compressed_value) {
+	if (offset.IsNull()) {
+		return SetValue(compressed_value);
+	}
+	// add the offset back to get a value of the column
+	auto value = compressed_value.GetValue<hugeint_t>() + offset.GetValue<hugeint_t>();
+	return SetValue(Value::HUGEINT(value).DefaultCastAs(offset.type()));
+}
+
+unique_ptr<ConstantFilter> DynamicFilterData::GetFilter() {
+	if (!initialized) {
+		return nullptr;
+	}
+	lock_guard<mutex> guard(lock);
+	if (!initialized) {
+		return nullptr;
+	}
+	return make_uniq<ConstantFilter>(comparison_type, constant);
+}
+
+void DynamicFilterData::Reset() {
+	lock_guard<mutex> guard(lock);
+	initialized = false;
+	constant = Value();
+}
+
+DynamicFilter::DynamicFilter(shared_ptr<DynamicFilterData> filter_data_p)
+    : TableFilter(TableFilterType::DYNAMIC_FILTER), filter_data(std::move(filter_data_p)) {
+}
+
+FilterPropagateResult DynamicFilter::CheckStatistics(BaseStatistics &stats) {
+	auto filter = filter_data->GetFilter();
+	if (!filter) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	auto result = filter->CheckStatistics(stats);
+	if (result == FilterPropagateResult::FILTER_ALWAYS_TRUE) {
+		// the constant can still be tightened
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	return result;
+}
+
+string DynamicFilter::ToString(const string &column_name) {
+	return column_name + ExpressionTypeToOperator(filter_data->comparison_type) + "DYNAMIC";
+}
+
+bool DynamicFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = (DynamicFilter &)other_p;
+	return other.filter_data == filter_data;
+}
+
+void DynamicFilter::Serialize(FieldWriter &writer) const {
+	writer.WriteField(filter_data->comparison_type);
+}
+
+unique_ptr<TableFilter> DynamicFilter::Deserialize(FieldReader &source) {
+	// the filter is no longer connected to the operator that sets it: it never filters anything
+	auto comparison_type = source.ReadRequired<ExpressionType>();
+	return make_uniq<DynamicFilter>(make_shared<DynamicFilterData>(comparison_type));
+}
+
+} // namespace duckdb
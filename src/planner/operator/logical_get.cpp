@@ -7,6 +7,7 @@
 #include "duckdb/function/function_serialization.hpp"
 #include "duckdb/function/table/table_scan.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/statistics/file_statistics_catalog.hpp"
 
 namespace duckdb {
 
@@ -101,7 +102,18 @@ void LogicalGet::ResolveTypes() {
 	}
 }
 
+unique_ptr<BaseStatistics> LogicalGet::GetFileStatistics(column_t column_id) const {
+	if (!file_statistics) {
+		return nullptr;
+	}
+	return file_statistics->GetColumnStatistics(column_id);
+}
+
 idx_t LogicalGet::EstimateCardinality(ClientContext &context) {
+	if (file_statistics) {
+		// the files have been analyzed: we know the exact amount of rows
+		return file_statistics->row_count;
+	}
 	if (function.cardinality) {
 		auto node_stats = function.cardinality(context, bind_data.get());
 		if (node_stats && node_stats->has_estimated_cardinality) {
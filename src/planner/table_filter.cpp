@@ -2,6 +2,7 @@
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 
 namespace duckdb {
@@ -76,6 +77,9 @@ unique_ptr<TableFilter> TableFilter::Deserialize(Deserializer &source) {
 	case TableFilterType::IS_NULL:
 		result = IsNullFilter::Deserialize(reader);
 		break;
+	case TableFilterType::DYNAMIC_FILTER:
+		result = DynamicFilter::Deserialize(reader);
+		break;
 	default:
 		throw NotImplementedException("Unsupported table filter type for deserialization");
 	}
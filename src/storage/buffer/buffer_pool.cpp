@@ -1,6 +1,7 @@
 #include "duckdb/storage/buffer/buffer_pool.hpp"
 #include "duckdb/parallel/concurrentqueue.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/trace_recorder.hpp"
 
 namespace duckdb {
 
@@ -65,6 +66,11 @@ BufferPool::EvictionResult BufferPool::EvictBlocks(idx_t extra_memory, idx_t mem
                                                    unique_ptr<FileBuffer> *buffer) {
 	BufferEvictionNode node;
 	TempBufferPoolReservation r(*this, extra_memory);
+	if (current_memory <= memory_limit) {
+		return {true, std::move(r)};
+	}
+	TraceScope trace("buffer_manager", "evict", 0);
+	idx_t evicted_bytes = 0;
 	while (current_memory > memory_limit) {
 		// get a block to unpin from the queue
 		if (!queue->q.try_dequeue(node)) {
@@ -84,6 +90,8 @@ BufferPool::EvictionResult BufferPool::EvictBlocks(idx_t extra_memory, idx_t mem
 			continue;
 		}
 		// hooray, we can unload the block
+		evicted_bytes += handle->buffer->AllocSize();
+		trace.SetBytes(evicted_bytes);
 		if (buffer && handle->buffer->AllocSize() == extra_memory) {
 			// we can actually re-use the memory directly!
 			*buffer = handle->UnloadAndTakeBlock();
@@ -29,8 +29,8 @@ namespace duckdb {
 
 DataTableInfo::DataTableInfo(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager_p, string schema,
                              string table)
-    : db(db), table_io_manager(std::move(table_io_manager_p)), cardinality(0), schema(std::move(schema)),
-      table(std::move(table)) {
+    : db(db), table_io_manager(std::move(table_io_manager_p)), cardinality(0), data_version(0),
+      schema(std::move(schema)), table(std::move(table)) {
 }
 
 bool DataTableInfo::IsTemporary() const {
@@ -207,7 +207,8 @@ void DataTable::InitializeScanWithOffset(TableScanState &state, const vector<col
 }
 
 idx_t DataTable::MaxThreads(ClientContext &context) {
-	idx_t parallel_scan_vector_count = RowGroup::ROW_GROUP_VECTOR_COUNT;
+	// scans hand out morsels of at least MIN_MORSEL_VECTORS vectors
+	idx_t parallel_scan_vector_count = ParallelCollectionScanState::MIN_MORSEL_VECTORS;
 	if (ClientConfig::GetConfig(context).verify_parallelism) {
 		parallel_scan_vector_count = 1;
 	}
@@ -633,6 +634,7 @@ void DataTable::InitializeLocalAppend(LocalAppendState &state, ClientContext &co
 	}
 	auto &local_storage = LocalStorage::Get(context, db);
 	local_storage.InitializeAppend(state, *this);
+	info->data_version++;
 }
 
 void DataTable::LocalAppend(LocalAppendState &state, TableCatalogEntry &table, ClientContext &context, DataChunk &chunk,
@@ -668,6 +670,7 @@ OptimisticDataWriter &DataTable::CreateOptimisticWriter(ClientContext &context)
 void DataTable::LocalMerge(ClientContext &context, RowGroupCollection &collection) {
 	auto &local_storage = LocalStorage::Get(context, db);
 	local_storage.LocalMerge(*this, collection);
+	info->data_version++;
 }
 
 void DataTable::LocalAppend(TableCatalogEntry &table, ClientContext &context, DataChunk &chunk) {
@@ -942,6 +945,7 @@ idx_t DataTable::Delete(TableCatalogEntry &table, ClientContext &context, Vector
 	auto &transaction = DuckTransaction::Get(context, db);
 	auto &local_storage = LocalStorage::Get(transaction);
 	bool has_delete_constraints = TableHasDeleteConstraints(table);
+	info->data_version++;
 
 	row_identifiers.Flatten(count);
 	auto ids = FlatVector::GetData<row_t>(row_identifiers);
@@ -1102,6 +1106,7 @@ void DataTable::Update(TableCatalogEntry &table, ClientContext &context, Vector
 
 	// now perform the actual update
 	auto &transaction = DuckTransaction::Get(context, db);
+	info->data_version++;
 
 	updates.Flatten();
 	row_ids.Flatten(count);
@@ -1136,6 +1141,7 @@ void DataTable::UpdateColumn(TableCatalogEntry &table, ClientContext &context, V
 
 	// now perform the actual update
 	auto &transaction = DuckTransaction::Get(context, db);
+	info->data_version++;
 
 	updates.Flatten();
 	row_ids.Flatten(updates.size());
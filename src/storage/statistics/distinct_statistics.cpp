@@ -19,7 +19,7 @@ unique_ptr<DistinctStatistics> DistinctStatistics::Copy() const {
 }
 
 void DistinctStatistics::Merge(const DistinctStatistics &other) {
-	log = log->Merge(*other.log);
+	log->MergeInPlace(*other.log);
 	sample_count += other.sample_count;
 	total_count += other.total_count;
 }
@@ -66,11 +66,7 @@ void DistinctStatistics::Update(UnifiedVectorFormat &vdata, const LogicalType &t
 	}
 	sample_count += count;
 
-	uint64_t indices[STANDARD_VECTOR_SIZE];
-	uint8_t counts[STANDARD_VECTOR_SIZE];
-
-	HyperLogLog::ProcessEntries(vdata, type, indices, counts, count);
-	log->AddToLog(vdata, count, indices, counts);
+	log->Update(vdata, type, count);
 }
 
 string DistinctStatistics::ToString() const {
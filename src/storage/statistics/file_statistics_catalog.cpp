@@ -0,0 +1,239 @@
+#include "duckdb/storage/statistics/file_statistics_catalog.hpp"
+
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/serializer/buffered_file_reader.hpp"
+#include "duckdb/common/serializer/buffered_file_writer.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+//! The version of the file statistics catalog file format
+static constexpr const uint64_t FILE_STATISTICS_VERSION = 2;
+
+bool FileStatistics::Matches(const vector<string> &names_p, const vector<LogicalType> &types_p) const {
+	return names == names_p && types == types_p;
+}
+
+unique_ptr<BaseStatistics> FileStatistics::GetColumnStatistics(column_t column_id) const {
+	if (column_id >= column_stats.size() || !column_stats[column_id]) {
+		return nullptr;
+	}
+	auto result = column_stats[column_id]->ToUnique();
+	if (distinct_stats[column_id]) {
+		result->SetDistinctCount(MinValue<idx_t>(distinct_stats[column_id]->GetCount(), row_count));
+	}
+	return result;
+}
+
+void FileStatistics::Serialize(Serializer &serializer) const {
+	serializer.Write<idx_t>(row_count);
+	serializer.Write<uint32_t>(names.size());
+	for (idx_t col_idx = 0; col_idx < names.size(); col_idx++) {
+		serializer.WriteString(names[col_idx]);
+		types[col_idx].Serialize(serializer);
+		serializer.Write<idx_t>(null_counts[col_idx]);
+		serializer.Write<bool>(column_stats[col_idx] ? true : false);
+		if (column_stats[col_idx]) {
+			column_stats[col_idx]->Serialize(serializer);
+		}
+		serializer.WriteOptional(distinct_stats[col_idx]);
+	}
+}
+
+unique_ptr<FileStatistics> FileStatistics::Deserialize(Deserializer &source) {
+	auto result = make_uniq<FileStatistics>();
+	result->row_count = source.Read<idx_t>();
+	auto column_count = source.Read<uint32_t>();
+	for (idx_t col_idx = 0; col_idx < column_count; col_idx++) {
+		result->names.push_back(source.Read<string>());
+		result->types.push_back(LogicalType::Deserialize(source));
+		result->null_counts.push_back(source.Read<idx_t>());
+		auto has_stats = source.Read<bool>();
+		if (has_stats) {
+			result->column_stats.push_back(BaseStatistics::Deserialize(source, result->types.back()).ToUnique());
+		} else {
+			result->column_stats.push_back(nullptr);
+		}
+		result->distinct_stats.push_back(source.ReadOptional<DistinctStatistics>());
+	}
+	return result;
+}
+
+//! Removes the modification times from a key, leaving the function, its parameters and the files
+static string StripModificationTimes(const string &key) {
+	auto lines = StringUtil::Split(key, '\n');
+	string result;
+	for (idx_t line_idx = 0; line_idx < lines.size(); line_idx++) {
+		auto &line = lines[line_idx];
+		result += line_idx == 0 ? line : "\n" + line.substr(0, line.rfind('@'));
+	}
+	return result;
+}
+
+FileStatisticsCatalog::FileStatisticsCatalog(DatabaseInstance &db) : db(db), loaded(false) {
+}
+
+FileStatisticsCatalog &FileStatisticsCatalog::Get(ClientContext &context) {
+	return DatabaseInstance::GetDatabase(context).GetFileStatisticsCatalog();
+}
+
+//! The first line of a key: the scanning function and the parameters it was bound with. The statistics of a scan are
+//! only valid for scans with the same reader options (e.g. a different nullstr changes the NULL counts)
+static string GetFunctionKey(const LogicalGet &get) {
+	string result = get.function.name + "(";
+	for (idx_t param_idx = 0; param_idx < get.parameters.size(); param_idx++) {
+		result += (param_idx > 0 ? ", " : "") + get.parameters[param_idx].ToSQLString();
+	}
+	vector<string> named_parameters;
+	for (auto &entry : get.named_parameters) {
+		named_parameters.push_back(entry.first + "=" + entry.second.ToSQLString());
+	}
+	std::sort(named_parameters.begin(), named_parameters.end());
+	for (auto &named_parameter : named_parameters) {
+		result += ", " + named_parameter;
+	}
+	result += ")";
+	return StringUtil::Replace(result, "\n", " ");
+}
+
+//! Returns the files scanned by a table function, or an empty list if the function does not scan files
+static vector<string> GetFiles(const LogicalGet &get) {
+	if (!get.function.get_files || !get.bind_data) {
+		return vector<string>();
+	}
+	return get.function.get_files(get.bind_data.get());
+}
+
+static string GetKeyInternal(ClientContext &context, const LogicalGet &get, const vector<string> &files) {
+	auto &fs = FileSystem::GetFileSystem(context);
+	string result = GetFunctionKey(get);
+	for (auto &file : files) {
+		time_t last_modified;
+		try {
+			auto handle = fs.OpenFile(file, FileFlags::FILE_FLAGS_READ);
+			last_modified = fs.GetLastModifiedTime(*handle);
+		} catch (Exception &ex) {
+			// we cannot tell whether or not the file has changed: statistics cannot be used
+			return string();
+		}
+		result += "\n" + file + "@" + to_string(int64_t(last_modified));
+	}
+	return result;
+}
+
+string FileStatisticsCatalog::GetKey(ClientContext &context, const LogicalGet &get) {
+	auto files = GetFiles(get);
+	if (files.empty()) {
+		return string();
+	}
+	return GetKeyInternal(context, get, files);
+}
+
+shared_ptr<FileStatistics> FileStatisticsCatalog::GetStatistics(ClientContext &context, const LogicalGet &get) {
+	auto files = GetFiles(get);
+	if (files.empty()) {
+		return nullptr;
+	}
+	// look up the scan without its modification times first: the files are only opened if they were analyzed
+	string file_key = GetFunctionKey(get);
+	for (auto &file : files) {
+		file_key += "\n" + file;
+	}
+	string key;
+	{
+		lock_guard<mutex> guard(lock);
+		LoadInternal(context);
+		auto entry = file_keys.find(file_key);
+		if (entry == file_keys.end()) {
+			return nullptr;
+		}
+		key = entry->second;
+	}
+	if (GetKeyInternal(context, get, files) != key) {
+		// the files have changed since they were analyzed
+		return nullptr;
+	}
+	lock_guard<mutex> guard(lock);
+	auto entry = entries.find(key);
+	if (entry == entries.end()) {
+		return nullptr;
+	}
+	return entry->second;
+}
+
+void FileStatisticsCatalog::SetStatistics(ClientContext &context, const string &key,
+                                          shared_ptr<FileStatistics> statistics) {
+	D_ASSERT(!key.empty());
+	lock_guard<mutex> guard(lock);
+	LoadInternal(context);
+	// drop the statistics of earlier versions of the same files
+	auto files = StripModificationTimes(key);
+	auto entry = file_keys.find(files);
+	if (entry != file_keys.end()) {
+		entries.erase(entry->second);
+	}
+	file_keys[files] = key;
+	entries[key] = std::move(statistics);
+	SaveInternal(context);
+}
+
+string FileStatisticsCatalog::GetPath() {
+	auto &path = db.config.options.database_path;
+	if (path.empty() || path == ":memory:") {
+		return string();
+	}
+	return path + ".file_stats";
+}
+
+void FileStatisticsCatalog::LoadInternal(ClientContext &context) {
+	if (loaded) {
+		return;
+	}
+	loaded = true;
+	auto path = GetPath();
+	auto &fs = FileSystem::GetFileSystem(context);
+	if (path.empty() || !fs.FileExists(path)) {
+		return;
+	}
+	BufferedFileReader reader(fs, path.c_str(), &context);
+	auto version = reader.Read<uint64_t>();
+	if (version != FILE_STATISTICS_VERSION) {
+		// statistics written by a different version: they will be recomputed by the next ANALYZE
+		return;
+	}
+	while (!reader.Finished()) {
+		auto key = reader.Read<string>();
+		file_keys[StripModificationTimes(key)] = key;
+		entries[key] = shared_ptr<FileStatistics>(FileStatistics::Deserialize(reader));
+	}
+}
+
+void FileStatisticsCatalog::SaveInternal(ClientContext &context) {
+	auto path = GetPath();
+	if (path.empty() || db.config.options.access_mode == AccessMode::READ_ONLY) {
+		return;
+	}
+	auto &fs = FileSystem::GetFileSystem(context);
+	// write to a temporary file first, so that the catalog is never left half-written
+	auto temp_path = path + ".tmp";
+	{
+		BufferedFileWriter writer(fs, temp_path,
+		                          FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+		writer.Write<uint64_t>(FILE_STATISTICS_VERSION);
+		for (auto &entry : entries) {
+			writer.WriteString(entry.first);
+			entry.second->Serialize(writer);
+		}
+		writer.Sync();
+	}
+	fs.MoveFile(temp_path, path);
+}
+
+} // namespace duckdb
@@ -7,6 +7,7 @@
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
 
@@ -467,6 +468,15 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &result, const
 		return TemplatedNullSelection<true>(sel, approved_tuple_count, mask);
 	case TableFilterType::IS_NOT_NULL:
 		return TemplatedNullSelection<false>(sel, approved_tuple_count, mask);
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto &dynamic_filter = (const DynamicFilter &)filter;
+		auto constant_filter = dynamic_filter.filter_data->GetFilter();
+		if (!constant_filter) {
+			// the filter has not been set yet
+			return approved_tuple_count;
+		}
+		return FilterSelection(sel, result, *constant_filter, approved_tuple_count, mask);
+	}
 	default:
 		throw InternalException("FIXME: unsupported type for filter selection");
 	}
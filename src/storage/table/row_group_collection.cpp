@@ -2,6 +2,8 @@
 #include "duckdb/storage/table/persistent_table_data.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/parallel/morsel_sizing.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/planner/constraints/bound_not_null_constraint.hpp"
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
@@ -160,6 +162,7 @@ void RowGroupCollection::InitializeParallelScan(ParallelCollectionScanState &sta
 	state.max_row = row_start + total_rows;
 	state.batch_index = 0;
 	state.processed_rows = 0;
+	state.thread_count = 0;
 }
 
 bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollectionScanState &state,
@@ -178,22 +181,33 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 			}
 			collection = state.collection;
 			row_group = state.current_row_group;
+			// hand out a morsel of vectors of the current row group
+			// towards the end of the scan the remaining row groups are split up so idle threads can help finish them
+			idx_t row_group_vectors = (row_group->count + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
+			idx_t morsel_vectors;
 			if (ClientConfig::GetConfig(context).verify_parallelism) {
-				vector_index = state.vector_index;
-				max_row = state.current_row_group->start +
-				          MinValue<idx_t>(state.current_row_group->count,
-				                          STANDARD_VECTOR_SIZE * state.vector_index + STANDARD_VECTOR_SIZE);
-				D_ASSERT(vector_index * STANDARD_VECTOR_SIZE < state.current_row_group->count);
-				state.vector_index++;
-				if (state.vector_index * STANDARD_VECTOR_SIZE >= state.current_row_group->count) {
-					state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
-					state.vector_index = 0;
-				}
+				morsel_vectors = 1;
 			} else {
-				state.processed_rows += state.current_row_group->count;
-				vector_index = 0;
-				max_row = state.current_row_group->start + state.current_row_group->count;
+				if (state.thread_count == 0) {
+					state.thread_count = TaskScheduler::GetScheduler(context).NumberOfThreads();
+				}
+				idx_t scan_position = row_group->start + state.vector_index * STANDARD_VECTOR_SIZE;
+				idx_t remaining_rows = state.max_row > scan_position ? state.max_row - scan_position : 0;
+				idx_t remaining_vectors = (remaining_rows + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
+				morsel_vectors =
+				    MorselSizing::NextMorselSize(remaining_vectors, state.thread_count, RowGroup::ROW_GROUP_VECTOR_COUNT,
+				                                 ParallelCollectionScanState::MIN_MORSEL_VECTORS);
+			}
+			D_ASSERT(state.vector_index < row_group_vectors);
+			morsel_vectors = MinValue<idx_t>(morsel_vectors, row_group_vectors - state.vector_index);
+			vector_index = state.vector_index;
+			max_row = row_group->start +
+			          MinValue<idx_t>(row_group->count, (vector_index + morsel_vectors) * STANDARD_VECTOR_SIZE);
+			state.processed_rows += max_row - (row_group->start + vector_index * STANDARD_VECTOR_SIZE);
+			state.vector_index += morsel_vectors;
+			if (state.vector_index >= row_group_vectors) {
 				state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
+				state.vector_index = 0;
 			}
 			max_row = MinValue<idx_t>(max_row, state.max_row);
 			scan_state.batch_index = ++state.batch_index;
@@ -68,7 +68,7 @@ AdaptiveFilter *CollectionScanState::GetAdaptiveFilter() {
 }
 
 ParallelCollectionScanState::ParallelCollectionScanState()
-    : collection(nullptr), current_row_group(nullptr), processed_rows(0) {
+    : collection(nullptr), current_row_group(nullptr), processed_rows(0), thread_count(0) {
 }
 
 CollectionScanState::CollectionScanState(TableScanState &parent_p)
@@ -245,3 +245,66 @@ TEST_CASE("Test Pending Query Prepared Statements API", "[api][.]") {
 		REQUIRE_THROWS(pending_query->Execute());
 	}
 }
+
+TEST_CASE("Test streaming query results through a bounded buffer", "[api][.]") {
+	DuckDB db;
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("PRAGMA threads=4"));
+	REQUIRE_NO_FAIL(con.Query("PRAGMA verify_parallelism"));
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers AS SELECT i FROM range(500000) tbl(i)"));
+	REQUIRE_NO_FAIL(con.Query("SET streaming_buffer_size='100KB'"));
+
+	SECTION("Insertion order is preserved") {
+		auto result = con.SendQuery("SELECT i FROM integers WHERE i % 3 <> 0");
+		REQUIRE(!result->HasError());
+		int64_t expected = 0;
+		while (true) {
+			auto chunk = result->Fetch();
+			if (!chunk || chunk->size() == 0) {
+				break;
+			}
+			for (idx_t r = 0; r < chunk->size(); r++) {
+				if (expected % 3 == 0) {
+					expected++;
+				}
+				REQUIRE(chunk->GetValue(0, r).GetValue<int64_t>() == expected);
+				expected++;
+			}
+		}
+		REQUIRE(expected == 500000);
+	}
+	SECTION("Insertion order is not preserved") {
+		REQUIRE_NO_FAIL(con.Query("SET preserve_insertion_order=false"));
+		auto result = con.SendQuery("SELECT i FROM integers");
+		REQUIRE(!result->HasError());
+		idx_t count = 0;
+		int64_t sum = 0;
+		while (true) {
+			auto chunk = result->Fetch();
+			if (!chunk || chunk->size() == 0) {
+				break;
+			}
+			for (idx_t r = 0; r < chunk->size(); r++) {
+				sum += chunk->GetValue(0, r).GetValue<int64_t>();
+			}
+			count += chunk->size();
+		}
+		REQUIRE(count == 500000);
+		REQUIRE(sum == 124999750000);
+	}
+	SECTION("Closing the result while the pipeline is blocked") {
+		auto result = con.SendQuery("SELECT i FROM integers");
+		REQUIRE(!result->HasError());
+		auto chunk = result->Fetch();
+		REQUIRE(chunk);
+		REQUIRE(chunk->GetValue(0, 0) == Value::BIGINT(0));
+		// the connection can be used as normal after
+		auto result2 = con.Query("SELECT COUNT(*) FROM integers");
+		REQUIRE(CHECK_COLUMN(result2, 0, {500000}));
+	}
+	SECTION("The buffer can be disabled") {
+		REQUIRE_NO_FAIL(con.Query("SET streaming_buffer_size='0B'"));
+		auto result = con.SendQuery("SELECT SUM(i) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {Value::HUGEINT(124999750000)}));
+	}
+}
@@ -30,7 +30,10 @@ void RequireValueEqual(ConfigurationOption *op, const Value &left, const Value &
 OptionValuePair &GetValueForOption(const string &name) {
 	static unordered_map<string, OptionValuePair> value_map = {
 	    {"access_mode", {Value("READ_ONLY"), Value("read_only")}},
+	    {"adaptive_join_threshold", {Value::DOUBLE(10)}},
+	    {"adaptive_parallelism", {true}},
 	    {"threads", {Value::BIGINT(42), Value::BIGINT(42)}},
+	    {"cardinality_feedback_size", {Value::UBIGINT(64)}},
 	    {"checkpoint_threshold", {"4.2GB"}},
 	    {"debug_checkpoint_abort", {"before_header"}},
 	    {"default_collation", {"nocase"}},
@@ -38,6 +41,7 @@ OptionValuePair &GetValueForOption(const string &name) {
 	    {"default_null_order", {"nulls_first"}},
 	    {"disabled_optimizers", {"extension"}},
 	    {"custom_extension_repository", {"duckdb.org/no-extensions-here", "duckdb.org/no-extensions-here"}},
+	    {"enable_expression_fusion", {false}},
 	    {"enable_fsst_vectors", {true}},
 	    {"enable_object_cache", {true}},
 	    {"enable_profiling", {"json"}},
@@ -46,6 +50,7 @@ OptionValuePair &GetValueForOption(const string &name) {
 	    {"external_threads", {8}},
 	    {"file_search_path", {"test"}},
 	    {"force_compression", {"uncompressed", "Uncompressed"}},
+	    {"holistic_aggregate_mode", {"spill"}},
 	    {"home_directory", {"test"}},
 	    {"integer_division", {true}},
 	    {"extension_directory", {"test"}},
@@ -58,13 +63,18 @@ OptionValuePair &GetValueForOption(const string &name) {
 	    {"null_order", {"nulls_first"}},
 	    {"perfect_ht_threshold", {0}},
 	    {"pivot_limit", {999}},
+	    {"plan_cache_size", {Value::UBIGINT(64)}},
 	    {"preserve_identifier_case", {false}},
 	    {"preserve_insertion_order", {false}},
 	    {"profiler_history_size", {0}},
 	    {"profile_output", {"test"}},
+	    {"profiling_hardware_counters", {true}},
 	    {"profiling_mode", {"detailed"}},
 	    {"enable_progress_bar_print", {false}},
 	    {"progress_bar_time", {0}},
+	    {"query_max_threads", {Value::UBIGINT(2)}},
+	    {"query_priority", {Value::UBIGINT(10)}},
+	    {"streaming_buffer_size", {"1.0MB"}},
 	    {"temp_directory", {"tmp"}},
 	    {"wal_autocheckpoint", {"4.2GB"}},
 	    {"worker_threads", {42}},
@@ -88,6 +98,7 @@ bool OptionIsExcludedFromTest(const string &name) {
 	    "debug_window_mode",
 	    "enable_external_access",    // cant change this while db is running
 	    "allow_unsigned_extensions", // cant change this while db is running
+	    "numa_aware_scheduling",     // cant change this while db is running
 	    "password",
 	    "username",
 	    "user",
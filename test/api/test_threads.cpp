@@ -1,5 +1,6 @@
 #include "catch.hpp"
 #include "test_helpers.hpp"
+#include "duckdb/parallel/numa_topology.hpp"
 
 #include <thread>
 
@@ -28,3 +29,23 @@ TEST_CASE("Test database maximum_threads argument", "[api]") {
 		REQUIRE_THROWS(db = DuckDB(nullptr, &config));
 	}
 }
+
+TEST_CASE("Test NUMA-aware scheduling", "[api]") {
+	auto cpus = NumaTopology::ParseCPUList("0-3,8,10-11");
+	REQUIRE(cpus == duckdb::vector<idx_t>({0, 1, 2, 3, 8, 10, 11}));
+	REQUIRE(NumaTopology::Detect().NodeCount() >= 1);
+
+	DBConfig config;
+	config.options.numa_aware_scheduling = true;
+	config.options.maximum_threads = 4;
+	DuckDB db(nullptr, &config);
+	Connection con(db);
+	REQUIRE(db.NumberOfThreads() == 4);
+
+	auto result = con.Query("SELECT SUM(i) FROM range(10000000) t(i)");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::HUGEINT(49999995000000)}));
+	result = con.Query("SELECT current_setting('numa_aware_scheduling')");
+	REQUIRE(CHECK_COLUMN(result, 0, {true}));
+	// the setting can only be changed on start-up
+	REQUIRE_FAIL(con.Query("SET numa_aware_scheduling=false"));
+}
@@ -1,6 +1,9 @@
 #include "catch.hpp"
 
 #include "arrow/arrow_test_helper.hpp"
+#include "duckdb/common/arrow/arrow_query_result.hpp"
+#include "duckdb/common/arrow/result_arrow_wrapper.hpp"
+#include "duckdb/execution/operator/helper/physical_arrow_collector.hpp"
 
 using namespace duckdb;
 
@@ -123,3 +126,76 @@ TEST_CASE("Test Parquet Files round-trip", "[arrow][.]") {
 		TestParquetRoundtrip(parquet_path);
 	}
 }
+
+static void TestArrowCollector(Connection &con, const string &query, idx_t batch_size, bool zero_copy) {
+	auto &config = ClientConfig::GetConfig(*con.context);
+	config.result_collector = [&](ClientContext &context, PreparedStatementData &data) {
+		return PhysicalArrowCollector::Create(context, data, batch_size, zero_copy);
+	};
+	auto result = con.context->Query(query, false);
+	config.result_collector = nullptr;
+	REQUIRE(!result->HasError());
+	REQUIRE(result->type == QueryResultType::ARROW_RESULT);
+
+	// the record batches are released by the arrow scan
+	auto result_stream = new ResultArrowArrayStreamWrapper(std::move(result), batch_size);
+	auto stream = result_stream->stream;
+	REQUIRE(ArrowTestHelper::RunArrowComparison(con, query, stream));
+}
+
+TEST_CASE("Test parallel arrow result collector", "[arrow]") {
+	DuckDB db;
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("PRAGMA threads=4"));
+	REQUIRE_NO_FAIL(con.Query("PRAGMA verify_parallelism"));
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers AS SELECT i, i::DOUBLE AS d, CASE WHEN i % 7 = 0 THEN NULL ELSE i "
+	                          "END AS n, 'thisisalongstring' || i::VARCHAR AS s, i % 2 = 0 AS b FROM range(50000) "
+	                          "tbl(i)"));
+
+	vector<string> queries {"SELECT * FROM integers", "SELECT i + 1, n * 2, d / 2, s FROM integers WHERE i % 3 = 0",
+	                        "SELECT n, DATE '1992-01-01' + i::INTEGER, TIMESTAMP '1992-01-01' + INTERVAL (i) SECONDS "
+	                        "FROM integers ORDER BY i DESC"};
+	for (auto &query : queries) {
+		for (auto zero_copy : {false, true}) {
+			TestArrowCollector(con, query, 1000, zero_copy);
+			TestArrowCollector(con, query, 100000, zero_copy);
+		}
+	}
+
+	// the record batches respect the batch size
+	auto &config = ClientConfig::GetConfig(*con.context);
+	config.result_collector = [&](ClientContext &context, PreparedStatementData &data) {
+		return PhysicalArrowCollector::Create(context, data, 1000);
+	};
+	auto result = con.context->Query("SELECT * FROM integers", false);
+	config.result_collector = nullptr;
+	REQUIRE(result->type == QueryResultType::ARROW_RESULT);
+	auto &arrow_result = (ArrowQueryResult &)*result;
+	REQUIRE(arrow_result.RowCount() == 50000);
+	for (auto &array : arrow_result.ConsumeArrays()) {
+		REQUIRE(array->arrow_array.length <= 1000);
+	}
+
+	// a single thread receives chunks that are larger than the batch size, and then a smaller last chunk: the rows
+	// of the record batch under construction have to come before the zero-copy record batch of the last chunk
+	REQUIRE_NO_FAIL(con.Query("PRAGMA disable_verify_parallelism"));
+	REQUIRE_NO_FAIL(con.Query("PRAGMA threads=1"));
+	config.result_collector = [&](ClientContext &context, PreparedStatementData &data) {
+		return PhysicalArrowCollector::Create(context, data, 1000, true);
+	};
+	result = con.context->Query("SELECT i FROM integers", false);
+	config.result_collector = nullptr;
+	REQUIRE(result->type == QueryResultType::ARROW_RESULT);
+	int64_t expected = 0;
+	bool in_order = true;
+	for (auto &array : ((ArrowQueryResult &)*result).ConsumeArrays()) {
+		auto &column = *array->arrow_array.children[0];
+		auto data = (const int64_t *)column.buffers[1] + column.offset;
+		for (int64_t row = 0; row < column.length; row++) {
+			in_order = in_order && data[row] == expected;
+			expected++;
+		}
+	}
+	REQUIRE(in_order);
+	REQUIRE(expected == 50000);
+}
@@ -49,3 +49,38 @@ TEST_CASE("Test that hyperloglog works", "[hyperloglog]") {
 	// the result should be identical to the big_hll one
 	REQUIRE(merged->Count() == big_hll.Count());
 }
+
+TEST_CASE("Test vectorized hyperloglog updates and merges", "[hyperloglog]") {
+	// add a million different values, one vector at a time
+	HyperLogLog log;
+	HyperLogLog small_hll[4];
+	Vector input(LogicalType::INTEGER);
+	auto data = FlatVector::GetData<int32_t>(input);
+	idx_t vector_idx = 0;
+	for (idx_t offset = 0; offset < 1000000; offset += STANDARD_VECTOR_SIZE) {
+		idx_t count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, 1000000 - offset);
+		for (idx_t i = 0; i < count; i++) {
+			data[i] = int32_t(offset + i);
+		}
+		// NULL values are not counted
+		FlatVector::SetNull(input, 0, (offset / STANDARD_VECTOR_SIZE) % 2 == 1);
+		log.Update(input, count);
+		small_hll[vector_idx++ % 4].Update(input, count);
+		FlatVector::Validity(input).Reset();
+	}
+	size_t count = log.Count();
+	REQUIRE(count > 950000LL);
+	REQUIRE(count < 1050000LL);
+
+	// merging the small logs results in exactly the same registers
+	auto merged = HyperLogLog::Merge(small_hll, 4);
+	REQUIRE(memcmp(merged->GetPtr(), log.GetPtr(), HyperLogLog::GetSize()) == 0);
+
+	HyperLogLog in_place;
+	for (auto &small : small_hll) {
+		in_place.MergeInPlace(small);
+	}
+	REQUIRE(memcmp(in_place.GetPtr(), log.GetPtr(), HyperLogLog::GetSize()) == 0);
+	REQUIRE(in_place.Count() == log.Count());
+	REQUIRE(log.Merge(in_place)->Count() == log.Count());
+}
@@ -0,0 +1,145 @@
+#include "catch.hpp"
+#include "test_helpers.hpp"
+#include "duckdb/parallel/interrupt.hpp"
+#include "duckdb/parser/parsed_data/create_table_function_info.hpp"
+
+#include <chrono>
+#include <thread>
+
+using namespace duckdb;
+using namespace std;
+
+// Table function that emulates a source waiting for asynchronous I/O:
+// - every other call returns "blocked" instead of data
+// - a background thread makes the interrupt callback after a short delay, after which the function is called again
+struct AsyncRange {
+	struct BindData : public TableFunctionData {
+		explicit BindData(idx_t count) : count(count) {
+		}
+		idx_t count;
+	};
+
+	struct GlobalState : public GlobalTableFunctionState {
+		GlobalState() : position(0) {
+		}
+		~GlobalState() override {
+			lock_guard<mutex> guard(lock);
+			for (auto &thread : io_threads) {
+				if (thread.get_id() == std::this_thread::get_id()) {
+					// the callback held the last reference to the task, and with it to this state
+					thread.detach();
+				} else {
+					thread.join();
+				}
+			}
+		}
+
+		idx_t MaxThreads() const override {
+			return 8;
+		}
+
+		void WakeUpLater(const InterruptState &interrupt_state) {
+			lock_guard<mutex> guard(lock);
+			io_threads.emplace_back([interrupt_state]() {
+				std::this_thread::sleep_for(std::chrono::microseconds(200));
+				interrupt_state.Callback();
+			});
+		}
+
+		atomic<idx_t> position;
+		mutex lock;
+		duckdb::vector<std::thread> io_threads;
+	};
+
+	struct LocalState : public LocalTableFunctionState {
+		bool waited = false;
+	};
+
+	static duckdb::unique_ptr<FunctionData> Bind(ClientContext &context, TableFunctionBindInput &input,
+	                                             duckdb::vector<LogicalType> &return_types,
+	                                             duckdb::vector<string> &names) {
+		return_types.emplace_back(LogicalType::BIGINT);
+		names.emplace_back("i");
+		return make_uniq<BindData>(input.inputs[0].GetValue<int64_t>());
+	}
+
+	static duckdb::unique_ptr<GlobalTableFunctionState> InitGlobal(ClientContext &context,
+	                                                               TableFunctionInitInput &input) {
+		return make_uniq<GlobalState>();
+	}
+
+	static duckdb::unique_ptr<LocalTableFunctionState> InitLocal(ExecutionContext &context,
+	                                                             TableFunctionInitInput &input,
+	                                                             GlobalTableFunctionState *global_state) {
+		return make_uniq<LocalState>();
+	}
+
+	static void Function(ClientContext &context, TableFunctionInput &data, DataChunk &output) {
+		auto &bind_data = data.bind_data->Cast<BindData>();
+		auto &gstate = data.global_state->Cast<GlobalState>();
+		auto &lstate = data.local_state->Cast<LocalState>();
+		if (!lstate.waited && data.interrupt_state) {
+			// "issue an I/O request" and yield the thread until it completes
+			lstate.waited = true;
+			gstate.WakeUpLater(*data.interrupt_state);
+			data.blocked = true;
+			return;
+		}
+		lstate.waited = false;
+		auto start = gstate.position.fetch_add(STANDARD_VECTOR_SIZE);
+		if (start >= bind_data.count) {
+			output.SetCardinality(0);
+			return;
+		}
+		auto count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, bind_data.count - start);
+		auto result_data = FlatVector::GetData<int64_t>(output.data[0]);
+		for (idx_t i = 0; i < count; i++) {
+			result_data[i] = start + i;
+		}
+		output.SetCardinality(count);
+	}
+
+	static void Register(Connection &con) {
+		con.BeginTransaction();
+		auto &catalog = Catalog::GetSystemCatalog(*con.context);
+		TableFunction async_range("async_range", {LogicalType::BIGINT}, AsyncRange::Function, AsyncRange::Bind,
+		                          AsyncRange::InitGlobal, AsyncRange::InitLocal);
+		CreateTableFunctionInfo async_range_info(async_range);
+		catalog.CreateTableFunction(*con.context, async_range_info);
+		con.Commit();
+	}
+};
+
+TEST_CASE("Table function that blocks while waiting for I/O", "[api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	AsyncRange::Register(con);
+
+	for (auto threads : {1, 4}) {
+		REQUIRE_NO_FAIL(con.Query("PRAGMA threads=" + to_string(threads)));
+
+		// materialized, executed by the task scheduler
+		auto result = con.Query("SELECT COUNT(*), SUM(i) FROM async_range(100000)");
+		REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(100000)}));
+		REQUIRE(CHECK_COLUMN(result, 1, {Value::HUGEINT(4999950000)}));
+
+		// pipelines that pull from a blocked source outside of a task wait in place
+		auto streaming_result = con.SendQuery("SELECT i FROM async_range(10000) WHERE i % 1000 = 0");
+		REQUIRE(!streaming_result->HasError());
+		idx_t row_count = 0;
+		while (true) {
+			auto chunk = streaming_result->Fetch();
+			if (!chunk || chunk->size() == 0) {
+				break;
+			}
+			row_count += chunk->size();
+		}
+		REQUIRE(row_count == 10);
+
+		// the result is the same when the pipelines are not executed by a task scheduler thread
+		auto pending = con.PendingQuery("SELECT MAX(i) FROM async_range(50000)");
+		REQUIRE(!pending->HasError());
+		auto pending_result = pending->Execute();
+		REQUIRE(CHECK_COLUMN(pending_result, 0, {Value::BIGINT(49999)}));
+	}
+}
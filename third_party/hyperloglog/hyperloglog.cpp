@@ -1277,6 +1277,12 @@ void AddToSingleLogInternal(UnifiedVectorFormat &vdata, idx_t count, uint64_t in
 	D_ASSERT(hdr->encoding == HLL_DENSE);
 
 	const auto registers = hdr->registers + 1;
+	if (vdata.validity.AllValid()) {
+		for (idx_t i = 0; i < count; i++) {
+			duckdb_hll::hllDenseSet(registers, indices[i], counts[i]);
+		}
+		return;
+	}
 	for (idx_t i = 0; i < count; i++) {
 		if (vdata.validity.RowIsValid(vdata.sel->get_index(i))) {
 			duckdb_hll::hllDenseSet(registers, indices[i], counts[i]);
@@ -1284,4 +1290,52 @@ void AddToSingleLogInternal(UnifiedVectorFormat &vdata, idx_t count, uint64_t in
 	}
 }
 
+//! Every group of 4 registers (of 6 bits) is packed into 3 bytes of the dense representation
+static constexpr const idx_t HLL_REGISTER_GROUPS = HLL_REGISTERS / 4;
+
+static void UnpackDenseRegisters(const uint8_t *packed, uint8_t registers[]) {
+	for (idx_t i = 0; i < HLL_REGISTER_GROUPS; i++) {
+		const uint32_t b0 = packed[3 * i];
+		const uint32_t b1 = packed[3 * i + 1];
+		const uint32_t b2 = packed[3 * i + 2];
+		registers[4 * i] = b0 & HLL_REGISTER_MAX;
+		registers[4 * i + 1] = ((b0 >> 6) | (b1 << 2)) & HLL_REGISTER_MAX;
+		registers[4 * i + 2] = ((b1 >> 4) | (b2 << 4)) & HLL_REGISTER_MAX;
+		registers[4 * i + 3] = b2 >> 2;
+	}
+}
+
+static void PackDenseRegisters(const uint8_t registers[], uint8_t *packed) {
+	for (idx_t i = 0; i < HLL_REGISTER_GROUPS; i++) {
+		const uint32_t r0 = registers[4 * i];
+		const uint32_t r1 = registers[4 * i + 1];
+		const uint32_t r2 = registers[4 * i + 2];
+		const uint32_t r3 = registers[4 * i + 3];
+		packed[3 * i] = uint8_t(r0 | (r1 << 6));
+		packed[3 * i + 1] = uint8_t((r1 >> 2) | (r2 << 4));
+		packed[3 * i + 2] = uint8_t((r2 >> 4) | (r3 << 2));
+	}
+}
+
+void MergeDenseInternal(void *target, void *sources[], idx_t source_count) {
+	static_assert(HLL_REGISTERS % 4 == 0 && HLL_BITS == 6, "MergeDenseInternal assumes 4 registers per 3 bytes");
+	const auto target_hdr = (duckdb_hll::hllhdr *)((duckdb_hll::robj *)target)->ptr;
+	D_ASSERT(target_hdr->encoding == HLL_DENSE);
+	const auto target_registers = target_hdr->registers + 1;
+
+	// unpack the registers into bytes, so that the maximum is computed with (auto-vectorized) byte-wise operations
+	uint8_t max[HLL_REGISTERS];
+	uint8_t registers[HLL_REGISTERS];
+	UnpackDenseRegisters(target_registers, max);
+	for (idx_t source_idx = 0; source_idx < source_count; source_idx++) {
+		const auto source_hdr = (duckdb_hll::hllhdr *)((duckdb_hll::robj *)sources[source_idx])->ptr;
+		D_ASSERT(source_hdr->encoding == HLL_DENSE);
+		UnpackDenseRegisters(source_hdr->registers + 1, registers);
+		for (idx_t i = 0; i < HLL_REGISTERS; i++) {
+			max[i] = registers[i] > max[i] ? registers[i] : max[i];
+		}
+	}
+	PackDenseRegisters(max, target_registers);
+}
+
 } // namespace duckdb
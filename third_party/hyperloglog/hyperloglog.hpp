@@ -49,4 +49,7 @@ void AddToLogsInternal(UnifiedVectorFormat &vdata, idx_t count, uint64_t indices
 
 void AddToSingleLogInternal(UnifiedVectorFormat &vdata, idx_t count, uint64_t indices[], uint8_t counts[], void *log);
 
+//! Merges the registers of the (dense) source logs into the (dense) target log
+void MergeDenseInternal(void *target, void *sources[], idx_t source_count);
+
 } // namespace duckdb